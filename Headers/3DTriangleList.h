@@ -9,9 +9,18 @@
 //      in 3d drawing. For each triangle please store 3 vertex positions, 3 colours, 
 //      and 1 face normal.
 //
+//      Triangles are stored one of two ways. TRIANGLE_STORAGE_AOS keeps whole
+//      Triangles in one vector. TRIANGLE_STORAGE_SOA keeps positions, colours
+//      and face normals in three separate vectors, so a pass that only reads
+//      positions (bounds, culling) only pulls positions through the cache.
+//      GetPositions, GetColors and GetFaceNormals expose those streams.
+//
 //=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 #include <iostream>
+#include <span>
+#include <stdexcept>
 #include <vector>
+#include "Matrix4x4.h"
 #include "Vector3.h"
 
 #ifndef __3D_TRIANGLE_LIST_H_
@@ -51,38 +60,220 @@ struct Triangle
     }
 };
 
+enum TriangleStorage
+{
+    TRIANGLE_STORAGE_AOS,   // A vector of Triangles
+    TRIANGLE_STORAGE_SOA,   // Separate position, colour and face normal vectors
+};
+
 class TriangleList
 {
 public:
+    explicit TriangleList(TriangleStorage _storage = TRIANGLE_STORAGE_AOS)
+        : m_storage(_storage)
+    {
+    }
+
+    TriangleStorage GetStorage() const
+    {
+        return m_storage;
+    }
+
+    // @brief Moves every triangle into the _storage layout. The triangles themselves are unchanged.
+    void SetStorage(TriangleStorage _storage)
+    {
+        if (_storage == m_storage)
+        {
+            return;
+        }
+
+        size_t count = Count();
+        if (_storage == TRIANGLE_STORAGE_SOA)
+        {
+            m_positions.resize(count * 3);
+            m_colors.resize(count * 3);
+            m_faceNormals.resize(count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                const Triangle& triangle = m_triangles[i];
+                for (size_t corner = 0; corner < 3; ++corner)
+                {
+                    m_positions[i * 3 + corner] = triangle.vertices[corner];
+                    m_colors[i * 3 + corner] = triangle.colors[corner];
+                }
+                m_faceNormals[i] = triangle.faceNormal;
+            }
+            m_triangles = std::vector<Triangle>();
+        }
+        else
+        {
+            m_triangles.resize(count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                m_triangles[i] = GetTriangle(i);
+            }
+            m_positions = std::vector<Vector3>();
+            m_colors = std::vector<Color>();
+            m_faceNormals = std::vector<Vector3>();
+        }
+        m_storage = _storage;
+    }
+
+    void Reserve(size_t _triangleCount)
+    {
+        if (m_storage == TRIANGLE_STORAGE_SOA)
+        {
+            m_positions.reserve(_triangleCount * 3);
+            m_colors.reserve(_triangleCount * 3);
+            m_faceNormals.reserve(_triangleCount);
+        }
+        else
+        {
+            m_triangles.reserve(_triangleCount);
+        }
+    }
 
     void AddTriangle(const Vector3& _v0, const Vector3& _v1, const Vector3& _v2,
                         const Color& _c0, const Color& _c1, const Color& _c2,
                         const Vector3& _normal)
     {
-        m_triangles.emplace_back(_v0, _v1, _v2, _c0, _c1, _c2, _normal);
+        if (m_storage == TRIANGLE_STORAGE_SOA)
+        {
+            m_positions.insert(m_positions.end(), { _v0, _v1, _v2 });
+            m_colors.insert(m_colors.end(), { _c0, _c1, _c2 });
+            m_faceNormals.push_back(_normal);
+        }
+        else
+        {
+            m_triangles.emplace_back(_v0, _v1, _v2, _c0, _c1, _c2, _normal);
+        }
+    }
+
+    // @brief Adds a triangle with its face normal generated from the winding order
+    void AddTriangle(const Vector3& _v0, const Vector3& _v1, const Vector3& _v2,
+                        const Color& _c0, const Color& _c1, const Color& _c2)
+    {
+        AddTriangle(_v0, _v1, _v2, _c0, _c1, _c2, CalculateFaceNormal(_v0, _v1, _v2));
+    }
+
+    // @brief Unit normal of the triangle, counter-clockwise winding facing the viewer. Lighting does not
+    // need the last bits, so this uses NormalisedFast. Degenerate triangles get a zero normal.
+    static Vector3 CalculateFaceNormal(const Vector3& _v0, const Vector3& _v1, const Vector3& _v2)
+    {
+        return (_v1 - _v0).Cross(_v2 - _v0).NormalisedFast();
+    }
+
+    // @brief Moves every triangle by _matrix, vertices as points and face normals by the inverse transpose,
+    // renormalised with NormalisedFast. A singular _matrix flattens the triangles, so their normals are
+    // recalculated from the winding order instead. Both storage modes give the same floats; SoA lists go
+    // through the batched TransformPoints and TransformDirections.
+    void Transform(const Matrix4x4& _matrix)
+    {
+        Matrix4x4 inverse;
+        bool isInvertible = _matrix.Inverse(inverse);
+        Matrix4x4 normalMatrix = inverse.Transposed();
+        if (m_storage == TRIANGLE_STORAGE_SOA)
+        {
+            TransformPoints(_matrix, m_positions, m_positions);
+            if (isInvertible)
+            {
+                TransformDirections(normalMatrix, m_faceNormals, m_faceNormals);
+                for (Vector3& normal : m_faceNormals)
+                {
+                    normal = normal.NormalisedFast();
+                }
+            }
+            else
+            {
+                for (size_t i = 0; i < m_faceNormals.size(); ++i)
+                {
+                    m_faceNormals[i] = CalculateFaceNormal(m_positions[i * 3], m_positions[i * 3 + 1], m_positions[i * 3 + 2]);
+                }
+            }
+            return;
+        }
+
+        for (Triangle& triangle : m_triangles)
+        {
+            for (Vector3& vertex : triangle.vertices)
+            {
+                vertex = _matrix.TransformPoint(vertex);
+            }
+            triangle.faceNormal = isInvertible
+                ? normalMatrix.TransformDirection(triangle.faceNormal).NormalisedFast()
+                : CalculateFaceNormal(triangle.vertices[0], triangle.vertices[1], triangle.vertices[2]);
+        }
     }
 
     size_t Count() const
     {
-        return m_triangles.size();
+        return (m_storage == TRIANGLE_STORAGE_SOA) ? m_faceNormals.size() : m_triangles.size();
     }
 
     void Clear()
     {
         m_triangles.clear();
+        m_positions.clear();
+        m_colors.clear();
+        m_faceNormals.clear();
     }
 
-    const Triangle& GetTriangle(size_t _index) const
+    // @brief A copy of triangle _index, gathered from the streams for SoA lists
+    Triangle GetTriangle(size_t _index) const
     {
-        if (_index >= m_triangles.size())
+        if (_index >= Count())
         {
             throw std::out_of_range("TriangleList::GetTriangle: index out of range");
         }
+        if (m_storage == TRIANGLE_STORAGE_SOA)
+        {
+            const Vector3* positions = &m_positions[_index * 3];
+            const Color* colors = &m_colors[_index * 3];
+            return Triangle(positions[0], positions[1], positions[2], colors[0], colors[1], colors[2], m_faceNormals[_index]);
+        }
         return m_triangles[_index];
     }
 
+    // ~~~ SoA streams ~~~
+    // Three entries a triangle in the position and colour streams, triangle i at 3i to 3i + 2, and one
+    // in the face normal stream. Only SoA lists have streams; AoS lists throw std::logic_error.
+
+    std::span<const Vector3> GetPositions() const
+    {
+        ThrowIfNotSoA("TriangleList::GetPositions: only SoA lists have separate streams");
+        return m_positions;
+    }
+
+    std::span<const Color> GetColors() const
+    {
+        ThrowIfNotSoA("TriangleList::GetColors: only SoA lists have separate streams");
+        return m_colors;
+    }
+
+    std::span<const Vector3> GetFaceNormals() const
+    {
+        ThrowIfNotSoA("TriangleList::GetFaceNormals: only SoA lists have separate streams");
+        return m_faceNormals;
+    }
+
 private:
+    void ThrowIfNotSoA(const char* _message) const
+    {
+        if (m_storage != TRIANGLE_STORAGE_SOA)
+        {
+            throw std::logic_error(_message);
+        }
+    }
+
+    TriangleStorage m_storage;
+
+    // TRIANGLE_STORAGE_AOS
     std::vector<Triangle> m_triangles;
+
+    // TRIANGLE_STORAGE_SOA
+    std::vector<Vector3> m_positions;
+    std::vector<Color> m_colors;
+    std::vector<Vector3> m_faceNormals;
 };
 
 
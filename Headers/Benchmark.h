@@ -0,0 +1,79 @@
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//             Benchmark (h)
+//             Author: Christopher A
+//             Date: October 16, 2026
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//  Description:
+//
+//		Small helpers shared by the benchmark functions. Nothing fancy, just a
+//      steady clock stopwatch and a way to stop the optimiser from throwing
+//      away the work we are trying to measure.
+//
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+
+#ifndef     __BENCHMARK_H_
+#define     __BENCHMARK_H_
+
+
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+
+
+class BenchmarkTimer
+{
+public:
+    BenchmarkTimer()
+        : m_start(std::chrono::steady_clock::now())
+    {
+    }
+
+    void Restart()
+    {
+        m_start = std::chrono::steady_clock::now();
+    }
+
+    double GetElapsedNanoseconds() const
+    {
+        std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - m_start;
+        return elapsed.count();
+    }
+
+private:
+    std::chrono::steady_clock::time_point m_start;
+};
+
+
+// Keeps a function out of line, e.g. to measure what a call per operation costs
+#if defined(_MSC_VER)
+#define BENCHMARK_NOINLINE __declspec(noinline)
+#else
+#define BENCHMARK_NOINLINE __attribute__((noinline))
+#endif
+
+
+// @brief Forces the compiler to treat _value as used, so the code producing it is not optimised away.
+template <typename T>
+inline void DoNotOptimise(const T& _value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "g"(&_value) : "memory");
+#else
+    static volatile const void* s_sink = nullptr;
+    s_sink = &_value;
+#endif
+}
+
+
+// @brief Nearest rank percentile, e.g. 99.0 for the sample 99% of the others are at or below.
+// @param _sortedSamples Must be sorted ascending and not empty.
+inline double GetPercentile(const std::vector<double>& _sortedSamples, double _percent)
+{
+    size_t rank = (size_t)(_percent / 100.0 * (double)(_sortedSamples.size() - 1) + 0.5);
+    return _sortedSamples[(rank < _sortedSamples.size()) ? rank : _sortedSamples.size() - 1];
+}
+
+
+
+#endif  //  __BENCHMARK_H_
@@ -0,0 +1,102 @@
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//             Coin Expiry Heap (h)
+//             Author: Christopher A
+//             Date: October 16, 2026
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//  Description:
+//
+//		Binary min-heap of pool slots ordered by the frame they expire on, used
+//      by the CoinObjectPool's RECYCLE_SOONEST_EXPIRING exhaustion policy to
+//      find the coin closest to expiring without looking at every coin.
+//
+//      The heap is indexed: every slot remembers where it sits in the heap, so
+//      a coin picked up early can be taken out in O(log n) as well. Push and
+//      Remove are O(log n), GetSoonestSlot is O(1), and nothing is allocated
+//      outside Reset() and Grow().
+//
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+
+#ifndef     __COIN_EXPIRY_HEAP_H_
+#define     __COIN_EXPIRY_HEAP_H_
+
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+#include "PoolSnapshot.h"
+
+
+
+class CoinExpiryHeap
+{
+public:
+    // @param _slotCapacity Slot indices pushed must be below this.
+    explicit CoinExpiryHeap(size_t _slotCapacity = 0);
+
+    // @brief Empties the heap and sizes it for _slotCapacity slots. Allocates.
+    void Reset(size_t _slotCapacity);
+
+    // @brief Makes room for slots up to _slotCapacity, keeping everything already in the heap. Allocates.
+    void Grow(size_t _slotCapacity);
+
+    // @brief Adds a slot in O(log n). The slot must not already be in the heap.
+    void Push(uint32_t _slot, unsigned int _expiryFrame);
+
+    // @brief Adds several slots that all expire on the same frame. None may already be in the heap.
+    // A batch at least as big as the heap already is rebuilds it in O(n) instead of sifting each one up.
+    void PushBatch(std::span<const uint32_t> _slots, unsigned int _expiryFrame);
+
+    // @brief Takes a slot out in O(log n), wherever it sits. The slot must be in the heap.
+    void Remove(uint32_t _slot);
+
+    // @brief Slot with the earliest expiry frame. The heap must not be empty.
+    uint32_t GetSoonestSlot() const;
+
+    bool IsEmpty() const;
+    size_t GetCount() const;
+
+
+    // ~~~ Snapshots ~~~
+    // The heap always goes across whole. That is 8 bytes per entry, and sift moves touch too many
+    // entries for tracking changed blocks to pay off.
+    size_t GetMaxSnapshotSize() const;
+    void WriteSnapshot(SnapshotWriter& _writer) const;
+
+    // @brief Steps over what ReadSnapshot() would read, checking it without changing anything. Every
+    // slot must be in range and appear once, and every entry must expire no sooner than its parent.
+    // @return false if the data is malformed.
+    bool ValidateSnapshot(SnapshotReader& _reader) const;
+
+    // @return false if the data is malformed.
+    bool ReadSnapshot(SnapshotReader& _reader);
+
+
+private:
+    struct Entry
+    {
+        unsigned int expiryFrame;
+        uint32_t slot;
+    };
+
+    // Frame numbers wrap around, so they are compared by their signed difference
+    static bool IsSooner(const Entry& _a, const Entry& _b) { return (int)(_a.expiryFrame - _b.expiryFrame) < 0; }
+
+    void SiftUp(size_t _index);
+    void SiftDown(size_t _index);
+    void Place(size_t _index, const Entry& _entry);
+
+    // Heap ordered entries, reserved up front so Push never allocates
+    std::vector<Entry> m_entries;
+
+    // Per slot: index into m_entries, or -1 if the slot is not in the heap
+    std::vector<int32_t> m_indexOfSlot;
+
+    // One bit per slot, for ValidateSnapshot() to catch a slot seen twice. Mutable scratch so
+    // validating stays const and never allocates; snapshots are single threaded.
+    mutable std::vector<uint64_t> m_seenSlotBits;
+};
+
+
+
+#endif  //  __COIN_EXPIRY_HEAP_H_
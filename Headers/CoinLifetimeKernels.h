@@ -0,0 +1,50 @@
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//             Coin Lifetime Kernels (h)
+//             Author: Christopher A
+//             Date: October 16, 2026
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//  Description:
+//
+//		Bulk lifetime update used by the CoinObjectPool's DENSE_SWEEP expiry
+//      mode. Every kernel subtracts one from each lifetime in a contiguous
+//      int32 array and writes out the indices of the lifetimes that reached
+//      zero or below, packed together in ascending order.
+//
+//      The SSE2 and AVX2 versions handle 4 and 8 lifetimes per step. All of
+//      them give exactly the same results as the scalar version, which is
+//      also what non-x86 builds use.
+//
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+
+#ifndef     __COIN_LIFETIME_KERNELS_H_
+#define     __COIN_LIFETIME_KERNELS_H_
+
+
+#include <cstddef>
+#include <cstdint>
+#include "CpuFeatures.h"
+
+
+#ifdef CPU_FEATURES_X86
+#define COIN_LIFETIME_KERNELS_X86 1
+#endif
+
+
+
+// Each kernel needs _outExpiredIndices to have room for _count entries.
+// @return Number of indices written to _outExpiredIndices.
+size_t DecrementLifetimesScalar(int32_t* _lifetimes, size_t _count, uint32_t* _outExpiredIndices);
+
+#ifdef COIN_LIFETIME_KERNELS_X86
+size_t DecrementLifetimesSSE2(int32_t* _lifetimes, size_t _count, uint32_t* _outExpiredIndices);
+
+// @brief Only call this when IsAVX2Supported() is true.
+size_t DecrementLifetimesAVX2(int32_t* _lifetimes, size_t _count, uint32_t* _outExpiredIndices);
+#endif
+
+// @brief Runs the fastest kernel this CPU supports. The choice is made once, on the first call.
+size_t DecrementLifetimes(int32_t* _lifetimes, size_t _count, uint32_t* _outExpiredIndices);
+
+
+
+#endif  //  __COIN_LIFETIME_KERNELS_H_
@@ -34,7 +34,24 @@
 #define     __COIN_OBJECT_POOL_H_
 
 
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <span>
 #include <vector>
+#include "CoinExpiryHeap.h"
+#include "CoinSpatialGrid.h"
+#include "LockFreeSlotStack.h"
+#include "ObjectPool.h"
+#include "PoolSnapshot.h"
+#include "Vector3.h"
+
+
+// Set to 0 to compile the pool's telemetry counters out completely
+#ifndef COIN_POOL_ENABLE_TELEMETRY
+#define COIN_POOL_ENABLE_TELEMETRY 1
+#endif
 
 
 enum CoinState
@@ -45,63 +62,547 @@ enum CoinState
 };
 
 
+enum CoinBatchFill
+{
+    // Spawn every requested coin, or none at all if the pool cannot supply them all
+    ALL_OR_NOTHING  = 0,
+
+    // Spawn as many of the requested coins as the pool has free
+    PARTIAL_FILL    = 1,
+};
+
+
+enum CoinExpiryMode
+{
+    // Coins sit in a timing wheel bucket for the frame they expire on. Update() only looks at
+    // the coins expiring that frame, so this wins when few coins expire per frame.
+    TIMING_WHEEL    = 0,
+
+    // Remaining lifetimes are kept in a dense int32 array next to the active list and counted down
+    // by a SIMD kernel every Update(). The cost grows with the active count, but it is a few
+    // straight vector passes with no pointer chasing.
+    DENSE_SWEEP     = 1,
+};
+
+
+enum CoinExhaustionPolicy
+{
+    // The spawn fails and hands back an invalid handle. Nothing is ever allocated after init.
+    FAIL_SPAWN                  = 0,
+
+    // The coin closest to expiring is expired early to make room. It comes off a min-heap keyed on
+    // expiry frame, so finding it is O(1) and removing it O(log n). While this policy is set every
+    // spawn and release also pays O(log n) to keep the heap up to date.
+    RECYCLE_SOONEST_EXPIRING    = 1,
+
+    // The pool grows by CoinObjectPool::GROWTH_CHUNK_SIZE coins. Existing coins and handles stay
+    // valid, but growing allocates, so only use this where an occasional hitch is acceptable.
+    GROW_BY_CHUNK               = 2,
+};
+
+
+enum CoinPoolThreading
+{
+    // Everything must be called from one thread. No synchronisation cost at all.
+    SINGLE_THREADED = 0,
+
+    // TrySpawnCoin and ReleaseCoin are lock-free and may be called from any number of threads.
+    // Update() must still be called from a single thread, and is where spawned and released
+    // coins get registered with (or removed from) the active list and the expiry wheel.
+    CONCURRENT      = 1,
+};
+
+
+
+// @brief Compact 32 bit reference to a coin: a slot index plus the slot's generation.
+// The generation moves on every time a slot is recycled, so a handle kept after its coin was
+// picked up or expired stops resolving, even once the slot holds a new coin. Handles are plain
+// values and can be stored in packed network and replay buffers as they are.
+// The generation wraps after 4096 reuses of the same slot.
+class CoinHandle
+{
+public:
+    static const uint32_t INDEX_BITS        = 20;
+    static const uint32_t INDEX_MASK        = (1u << INDEX_BITS) - 1;
+    static const uint32_t GENERATION_MASK   = (1u << (32 - INDEX_BITS)) - 1;
+
+    // The all-ones index is never handed out, so this value never names a real coin
+    static const uint32_t INVALID_VALUE     = 0xFFFFFFFFu;
+
+    CoinHandle() : m_value(INVALID_VALUE) { }
+    CoinHandle(uint32_t _slot, uint32_t _generation) : m_value(((_generation & GENERATION_MASK) << INDEX_BITS) | (_slot & INDEX_MASK)) { }
+
+    // @brief Rebuilds a handle from GetValue(), e.g. after reading it back from a buffer.
+    static CoinHandle FromValue(uint32_t _value) { CoinHandle handle; handle.m_value = _value; return handle; }
+
+    uint32_t GetValue() const { return m_value; }
+    uint32_t GetSlot() const { return m_value & INDEX_MASK; }
+    uint32_t GetGeneration() const { return m_value >> INDEX_BITS; }
+    bool IsValid() const { return m_value != INVALID_VALUE; }
+
+    bool operator == (const CoinHandle& _other) const { return m_value == _other.m_value; }
+    bool operator != (const CoinHandle& _other) const { return m_value != _other.m_value; }
+
+private:
+    uint32_t m_value;
+};
+
+
+
+// @brief What the pool has been up to, as returned by CoinObjectPool::GetTelemetry().
+// Everything stays zero when COIN_POOL_ENABLE_TELEMETRY is 0.
+// In CONCURRENT mode spawns and pickups are counted when Update() processes them, so they land
+// in the frame they were registered on rather than the exact frame they happened.
+struct CoinPoolTelemetry
+{
+    static const size_t PICKUP_AGE_BUCKET_COUNT = 16;
+    static const unsigned int PICKUP_AGE_BUCKET_FRAMES = 32;
+
+    // Counted between the last two Update() calls, including that Update()'s expiries
+    uint32_t lastFrameSpawns;
+    uint32_t lastFrameReleases;
+    uint32_t lastFrameExpiries;
+
+    uint64_t totalSpawns;
+    uint64_t totalReleases;
+    uint64_t totalExpiries;
+
+    // Number of spawn requests turned away because the pool was empty
+    uint64_t exhaustionCount;
+
+    // Coins expired early by RECYCLE_SOONEST_EXPIRING to make room. Also counted as expiries.
+    uint64_t reclaimedCount;
+
+    // Highest active coin count seen so far
+    size_t activeHighWaterMark;
+
+    // How many frames coins had been alive for when the player picked them up, in buckets of
+    // PICKUP_AGE_BUCKET_FRAMES. The last bucket also holds everything older.
+    uint64_t pickupAgeHistogram[PICKUP_AGE_BUCKET_COUNT];
+
+    CoinPoolTelemetry()
+        : lastFrameSpawns(0), lastFrameReleases(0), lastFrameExpiries(0),
+          totalSpawns(0), totalReleases(0), totalExpiries(0),
+          exhaustionCount(0), reclaimedCount(0), activeHighWaterMark(0), pickupAgeHistogram()
+    {
+    }
+};
+
+
 
 class Coin
 {
+    friend class CoinObjectPool;
+
 public:
 
-    Coin();
-    void Activate(int _maxFrames);
+    // @param _frameClock The owning pool's frame counter, used to work out the remaining lifetime.
+    Coin(const std::atomic<unsigned int>* _frameClock, unsigned int _spawnFrame, int _lifetimeFrames, const Vector3& _position);
     void Deactivate();
 
-    CoinState Update();
+    // @brief FREE while sitting in the pool, ACTIVE while alive, FREED once its lifetime has run out.
+    CoinState GetState() const;
+
+    bool GetIsActive() const;
+
+    // @brief Frames left before this coin expires, worked out from the frame it was spawned on.
+    int GetRemainingLifetimeFrames() const;
 
-    bool GetIsActive();
-    int GetRemainingLifetimeFrames();
+    const Vector3& GetPosition() const;
 
 private:
-    int m_remainingLifetimeFrames;
+    unsigned int GetExpiryFrame() const;
+
+    Vector3 m_position;
+    unsigned int m_spawnFrame;
+    int m_lifetimeFrames;
+
+    // Points at the owning pool's frame counter so the coin can work out its own remaining lifetime.
+    const std::atomic<unsigned int>* m_frameClock;
+
+    // Marks the end of a timing wheel bucket's list
+    static constexpr uint32_t NO_SLOT = 0xFFFFFFFFu;
+
+    // Slots of the neighbours inside the expiry timing wheel bucket this coin is scheduled in.
+    // Slot indices rather than pointers, so the coin's bytes can be snapshotted and restored as they are.
+    uint32_t m_wheelPrev;
+    uint32_t m_wheelNext;
+    unsigned int m_wheelBucket;
 };
 
 
 
 class CoinObjectPool
 {
+    friend class CoinThreadCache;
+
 public:
+    // Coins added each time a GROW_BY_CHUNK pool runs out
+    static const size_t GROWTH_CHUNK_SIZE = 4096;
     
     // @brief Constructor for the CoinObjectPool.
-    // @param _poolSize The total number of coins to pre-allocate.
-    CoinObjectPool(int _poolSize = 10000);
+    // @param _poolSize The total number of coins to pre-allocate. At most CoinHandle::INDEX_MASK.
+    // @param _threading Whether coins may be spawned and released from several threads at once.
+    // @param _gridCellSize Cell size of the pickup grid. Around the usual pickup radius works best.
+    // @param _expiryMode How Update() finds the coins whose lifetime ran out.
+    CoinObjectPool(int _poolSize = 10000, CoinPoolThreading _threading = CoinPoolThreading::SINGLE_THREADED, float _gridCellSize = 4.0f,
+                   CoinExpiryMode _expiryMode = CoinExpiryMode::TIMING_WHEEL);
     ~CoinObjectPool();
 
+    // Coins point back into the pool's frame clock, so the pool cannot be copied.
+    CoinObjectPool(const CoinObjectPool&) = delete;
+    CoinObjectPool& operator = (const CoinObjectPool&) = delete;
+
     
     // @brief Acquires an inactive coin from the pool.
+    // Lock-free in CONCURRENT mode. The coin is usable straight away, but only joins the active
+    // list (and starts counting towards GetActiveCoinCount) at the next Update().
     // @param _lifetimeFrames Number of Frames the coin will exist for before dying of """natural causes""".
-    // @return A pointer to an active Coin object, or nullptr if the pool is exhausted.
-    Coin* TrySpawnCoin(int _lifetimeFrames = 300);
+    //                        Values below 1 are treated as 1.
+    // @param _position Where the coin sits in the world, for CollectCoinsInRadius.
+    // @return A handle to the new coin, or an invalid handle if the pool is exhausted and the
+    //         exhaustion policy could not make room.
+    CoinHandle TrySpawnCoin(int _lifetimeFrames = 300, const Vector3& _position = Vector3());
 
     
-    // @brief Releases an active coin back to the pool.
+    // @brief Releases an active coin back to the pool in O(1).
     // This happens when the player collects it, or when its lifetime expires.
-    // @param _coin A pointer to the Coin object to release. Must not be nullptr.
-    void ReleaseCoin(Coin* _coin);
+    // Lock-free in CONCURRENT mode, where the coin's slot becomes reusable at the next Update().
+    // @return false if the handle is stale (the coin was already released or expired) or invalid.
+    bool ReleaseCoin(CoinHandle _handle);
+
+
+    // @brief Spawns a burst of coins (e.g. a boss dying) in one go.
+    // Slots move between the free and active lists as whole ranges rather than one at a time, the
+    // burst joins its expiry wheel bucket and grid cell as one chain, and in CONCURRENT mode the
+    // whole batch costs a couple of compare-exchanges.
+    // @param _count Number of coins wanted. Capped at the size of _outHandles.
+    // @param _outHandles Receives one handle per spawned coin, from the front.
+    // @param _position Where the whole burst is spawned.
+    // @return Number of coins spawned. The exhaustion policy only steps in when it can make room for
+    //         every coin that is missing; otherwise the burst is filled from the free coins alone.
+    size_t TrySpawnCoins(size_t _count, int _lifetimeFrames, std::span<CoinHandle> _outHandles,
+                         CoinBatchFill _fill = CoinBatchFill::PARTIAL_FILL, const Vector3& _position = Vector3());
+
+    // @brief Releases several coins in one go. Stale and invalid handles are skipped.
+    // @return Number of coins released.
+    size_t ReleaseCoins(std::span<const CoinHandle> _handles);
+
+
+    // @brief Looks the coin up in O(1).
+    // @return The coin, or nullptr if the handle is stale or invalid. In CONCURRENT mode the pointer
+    //         is only safe to use while no other thread can release the coin.
+    Coin* Resolve(CoinHandle _handle) const;
+
+
+    // @brief Finds the coins a player at _center can pick up, using the spatial grid so only
+    // nearby cells are looked at. In CONCURRENT mode call it from the thread that runs Update();
+    // coins spawned since the last Update() are not in the grid yet. A radius too big for the grid
+    // to pay off checks every active coin instead; negative and NaN radii find nothing.
+    // @param _outHandles Receives the handles of coins within _radius. Stops once it is full.
+    // @return Number of handles written.
+    size_t CollectCoinsInRadius(const Vector3& _center, float _radius, std::span<CoinHandle> _outHandles) const;
 
     
-    // @brief Updates the state of all active coins.
-    // This method should be called once per game frame.
-    // It handles coins disappearing after their lifetime expires.
+    // @brief Advances the pool by one frame and releases the coins whose lifetime ran out.
+    // This method should be called once per game frame, always from the same thread.
+    // See CoinExpiryMode for how the expired coins are found.
     void Update();
 
 
+    // In CONCURRENT mode the counts are approximate: a snapshot that other threads may already have changed.
+    // Coins spawned or released since the last Update() are not counted as active or free, and
+    // free slots held by a CoinThreadCache are not counted at all until the cache hands them back.
     size_t GetActiveCoinCount() const;
     size_t GetFreeCoinCount() const;
     size_t GetTotalCoinCount() const;
 
+    // @brief Number of times Update() has been called.
+    unsigned int GetCurrentFrame() const;
+
+
+    // ~~~ Exhaustion ~~~
+    // @brief Chooses what a spawn does when no coin is free. Defaults to FAIL_SPAWN.
+    // @return false if the policy is not available. CONCURRENT pools only support FAIL_SPAWN, as other
+    //         threads cannot safely expire coins or reallocate the pool.
+    bool SetExhaustionPolicy(CoinExhaustionPolicy _policy);
+    CoinExhaustionPolicy GetExhaustionPolicy() const;
+
+    // @brief Adds free coins ahead of a known busy moment, e.g. while a level loads. Coin storage
+    // grows in chunks that never move, so existing coins and handles stay valid. Allocates.
+    // SINGLE_THREADED only. The total is capped at CoinHandle::INDEX_MASK coins.
+    // @return Number of coins added.
+    size_t Grow(size_t _additionalCoins);
+
+
+    // ~~~ Snapshots ~~~
+    // For rollback netcode. A snapshot holds the pool's whole state (coins, free and active lists, expiry
+    // tracking, pickup grid and frame counter), copied into a caller provided buffer a whole array at a
+    // time. Telemetry is left out. SINGLE_THREADED pools only.
+    // Coins are copied as raw bytes, so a snapshot can only be restored into the pool that captured it,
+    // and not across a Grow() or a change of exhaustion policy.
+
+    // @brief Buffer size that every full or delta snapshot of the pool, as it is now, fits in.
+    size_t GetMaxSnapshotSize() const;
+
+    // @brief Captures the whole pool.
+    // @return Bytes written, or 0 if the buffer is too small or the pool is CONCURRENT.
+    size_t CaptureSnapshot(std::span<std::byte> _buffer);
+
+    // @brief Captures only the blocks of coins changed since the last capture or restore, plus the
+    // free and active lists and the expiry tracking, which are always copied whole.
+    // Restoring it needs the pool to be back in the state of that last capture or restore first,
+    // i.e. restore the full snapshot and then every delta after it, in order. Each delta records which
+    // capture it follows, and RestoreSnapshot refuses it unless the pool is in that state, unchanged.
+    // @return Bytes written, or 0 if the buffer is too small or the pool is CONCURRENT.
+    size_t CaptureDeltaSnapshot(std::span<std::byte> _buffer);
+
+    // @brief Puts the pool back into a captured state, full or delta. Handles given out since the
+    // capture stop resolving, and handles that were live at the capture resolve again.
+    // @return false, with the pool untouched, if the snapshot was not captured from this pool as it is now,
+    // is malformed, or is a delta taken against some other state than the pool's current one.
+    bool RestoreSnapshot(std::span<const std::byte> _snapshot);
+
+
+    // ~~~ Telemetry ~~~
+    // Replaces per-coin logging. Read from the thread that runs Update().
+    CoinPoolTelemetry GetTelemetry() const;
+
+    // @brief Writes the telemetry out in a human readable form.
+    void DumpTelemetry(std::ostream& _os) const;
+
+    void ResetTelemetry();
+
+
+private:
+    // One bucket per frame. Must be a power of two and should cover the default 300 frame lifetime,
+    // so that a coin normally sits in its bucket for a single revolution of the wheel.
+    static const unsigned int EXPIRY_WHEEL_SIZE = 512;
+    static const unsigned int EXPIRY_WHEEL_MASK = EXPIRY_WHEEL_SIZE - 1;
+
+    // Per-slot state word: the slot's handle generation above SLOT_STATE_BITS bits of state.
+    // CONCURRENT mode relies on the states to decide which thread gets to release a coin.
+    static const uint32_t SLOT_FREE         = 0;
+    static const uint32_t SLOT_ACTIVE       = 1;
+    static const uint32_t SLOT_RELEASING    = 2;
+    static const uint32_t SLOT_STATE_BITS   = 2;
+    static const uint32_t SLOT_STATE_MASK   = (1u << SLOT_STATE_BITS) - 1;
+
+    // Slots handled per step by the batch APIs, so they can work out of a small stack buffer
+    static const size_t BATCH_CHUNK_SIZE    = 256;
+
+    static uint32_t PackSlotState(uint32_t _generation, uint32_t _state) { return ((_generation & CoinHandle::GENERATION_MASK) << SLOT_STATE_BITS) | _state; }
+    static uint32_t GetSlotGeneration(uint32_t _slotState) { return _slotState >> SLOT_STATE_BITS; }
+
+    // @brief Starts tracking a registered slot's lifetime. The slot must already be in the active list.
+    void ScheduleExpiry(uint32_t _slot);
+
+    // @brief Stops tracking a slot's lifetime. Must run before the slot leaves the active list.
+    void UnscheduleExpiry(uint32_t _slot);
+
+    void UpdateTimingWheel(unsigned int _currentFrame);
+    void UpdateDenseSweep();
+    void ExpireSlot(uint32_t _slot);
+
+    // @brief Adds a constructed coin to the active list, expiry wheel and spatial grid.
+    void RegisterSlot(uint32_t _slot);
+
+    // @brief Marks a freshly constructed coin's slot ACTIVE and returns the handle for it.
+    CoinHandle ActivateSlotState(uint32_t _slot);
+
+    // Telemetry hooks. The per-coin ones are inline so they disappear entirely when telemetry is compiled out.
+    void RecordSpawns(size_t _count);
+    void RecordRecycle(const Coin* _coin, bool _hasExpired);
+    void RecordExhaustion();
+    void RecordReclaim();
+    void EndTelemetryFrame();
+
+    // @brief Applies the exhaustion policy to free up _missingCount more coins.
+    // @return false, having changed nothing, if the policy cannot free that many.
+    bool TryMakeRoom(size_t _missingCount);
+
+    CoinHandle TrySpawnCoinConcurrent(int _lifetimeFrames, const Vector3& _position);
+    bool ReleaseCoinConcurrent(CoinHandle _handle);
+    size_t TrySpawnCoinsConcurrent(size_t _count, int _lifetimeFrames, std::span<CoinHandle> _outHandles, CoinBatchFill _fill, const Vector3& _position);
+    size_t ReleaseCoinsConcurrent(std::span<const CoinHandle> _handles);
+    bool TryBeginConcurrentRelease(uint32_t _slot, uint32_t _generation);
+    void RecycleSlot(uint32_t _slot, bool _hasExpired);
+    void ProcessPendingCoins();
+
+    // Fixed size start of every snapshot. poolId and byteCount are there to reject foreign or truncated buffers.
+    // sequence numbers the captured state, and a delta's baseSequence is the state it was taken against.
+    struct SnapshotHeader
+    {
+        uint64_t poolId;
+        uint64_t byteCount;
+        uint64_t sequence;
+        uint64_t baseSequence;
+        uint32_t isDelta;
+        uint32_t capacity;
+        uint32_t expiryMode;
+        uint32_t exhaustionPolicy;
+        uint32_t currentFrame;
+        uint32_t freeCount;
+        uint32_t activeCount;
+        uint32_t slotBlockCount;
+    };
+
+    size_t WriteSnapshot(std::span<std::byte> _buffer, bool _deltaOnly);
+    bool ValidateSnapshot(std::span<const std::byte> _snapshot) const;
+    static bool AreSlotsInRange(const std::byte* _slotBytes, size_t _count, size_t _capacity);
+    void WriteSlotRange(SnapshotWriter& _writer, uint32_t _firstSlot, size_t _count) const;
+    void ReadSlotRange(SnapshotReader& _reader, uint32_t _firstSlot, size_t _count);
+
+    CoinPoolThreading m_threading;
+    CoinExpiryMode m_expiryMode;
+    CoinExhaustionPolicy m_exhaustionPolicy;
+
+    // Storage, free list and active list. Coins are constructed in place when spawned.
+    // In CONCURRENT mode the free slots are moved out to m_concurrentFreeSlots at init.
+    ObjectPool<Coin> m_coins;
+
+    // CONCURRENT mode only. Spawns and releases made by other threads queue up in the pending
+    // stacks until Update() moves them in and out of the active list and expiry wheel.
+    LockFreeSlotStack m_concurrentFreeSlots;
+    LockFreeSlotStack m_pendingSpawns;
+    LockFreeSlotStack m_pendingReleases;
+
+    // One state word per slot (see PackSlotState), so resolving a handle is a single array lookup
+    std::vector<std::atomic<uint32_t>> m_slotStates;
+
+    // TIMING_WHEEL mode. Head slot of the intrusive list of coins expiring on each frame, indexed by `expiryFrame & EXPIRY_WHEEL_MASK`
+    std::vector<uint32_t> m_expiryWheel;
+
+    // DENSE_SWEEP mode. Frames left for each coin, in the same order as m_coins' active list, and
+    // the active indices found expired by the last sweep.
+    std::vector<int32_t> m_remainingFrames;
+    std::vector<uint32_t> m_expiredActiveIndices;
+
+    // RECYCLE_SOONEST_EXPIRING policy only. Every registered coin ordered by expiry frame.
+    CoinExpiryHeap m_expiryHeap;
+
+    // Registered coins by position, for pickup queries
+    CoinSpatialGrid m_spatialGrid;
+
+    // Blocks of slots whose coin or state changed since the last snapshot capture or restore
+    DirtyBlockSet m_dirtySlots;
+
+    // The last snapshot sequence number handed out, and the one of the state the pool was last captured
+    // at or restored to. Both 0 before the first capture.
+    uint64_t m_lastSnapshotSequence;
+    uint64_t m_baseSnapshotSequence;
+
+    std::atomic<unsigned int> m_currentFrame;
+
+    // Only written by the thread that runs Update(), apart from the exhaustion count which any
+    // spawning thread may bump
+    CoinPoolTelemetry m_telemetry;
+    uint32_t m_frameSpawns;
+    uint32_t m_frameReleases;
+    uint32_t m_frameExpiries;
+    std::atomic<uint64_t> m_exhaustionCount;
+};
+
+
+
+inline void CoinObjectPool::RecordSpawns(size_t _count)
+{
+#if COIN_POOL_ENABLE_TELEMETRY
+    m_frameSpawns += (uint32_t)_count;
+    if (m_coins.GetActiveCount() > m_telemetry.activeHighWaterMark)
+    {
+        m_telemetry.activeHighWaterMark = m_coins.GetActiveCount();
+    }
+#else
+    (void)_count;
+#endif
+}
+
+inline void CoinObjectPool::RecordRecycle(const Coin* _coin, bool _hasExpired)
+{
+#if COIN_POOL_ENABLE_TELEMETRY
+    if (_hasExpired)
+    {
+        ++m_frameExpiries;
+        return;
+    }
+
+    ++m_frameReleases;
+    unsigned int ageFrames = m_currentFrame.load(std::memory_order_relaxed) - _coin->m_spawnFrame;
+    size_t bucket = ageFrames / CoinPoolTelemetry::PICKUP_AGE_BUCKET_FRAMES;
+    ++m_telemetry.pickupAgeHistogram[(bucket < CoinPoolTelemetry::PICKUP_AGE_BUCKET_COUNT) ? bucket : CoinPoolTelemetry::PICKUP_AGE_BUCKET_COUNT - 1];
+#else
+    (void)_coin;
+    (void)_hasExpired;
+#endif
+}
+
+inline void CoinObjectPool::RecordExhaustion()
+{
+#if COIN_POOL_ENABLE_TELEMETRY
+    m_exhaustionCount.fetch_add(1, std::memory_order_relaxed);
+#endif
+}
+
+inline void CoinObjectPool::RecordReclaim()
+{
+#if COIN_POOL_ENABLE_TELEMETRY
+    ++m_telemetry.reclaimedCount;
+#endif
+}
+
+
+
+// @brief Per-thread front end for a CONCURRENT CoinObjectPool (a "magazine").
+// Keeps a small batch of free slots and collects spawns and releases into batches of its own, so
+// most calls only touch memory this thread owns. Whole batches are swapped with the pool at once.
+// Each thread needs its own cache, and a cache must not outlive its pool.
+// On a SINGLE_THREADED pool every call is simply forwarded to the pool.
+class CoinThreadCache
+{
+public:
+    // Number of slots moved between the cache and the pool in one go
+    static const size_t MAGAZINE_SIZE = 32;
+
+    explicit CoinThreadCache(CoinObjectPool& _pool);
+
+    // @brief Flushes, then gives any unused free slots back to the pool.
+    ~CoinThreadCache();
+
+    CoinThreadCache(const CoinThreadCache&) = delete;
+    CoinThreadCache& operator = (const CoinThreadCache&) = delete;
+
+
+    // @brief Same as CoinObjectPool::TrySpawnCoin, but takes the slot from this thread's batch.
+    // The coin is not seen by Update() until its batch is full or Flush() is called.
+    CoinHandle TrySpawnCoin(int _lifetimeFrames = 300, const Vector3& _position = Vector3());
+
+    // @brief Same as CoinObjectPool::ReleaseCoin. The coin may have been spawned by any thread.
+    // Its slot is not recycled until its batch is full or Flush() is called.
+    bool ReleaseCoin(CoinHandle _handle);
+
+    // @brief Hands every batched spawn and release over to the pool, so the next Update() sees them.
+    // Call this at the end of a job, or whenever the pool's counts need to be up to date.
+    void Flush();
+
 
 private:
-    std::vector<Coin> m_allCoins;
-    std::vector<Coin*> m_freeCoins;
-    std::vector<Coin*> m_activeCoins;
+    void PublishSpawns();
+    void PublishReleases();
+
+    CoinObjectPool& m_pool;
+
+    // Free slots owned by this thread, used from the back
+    uint32_t m_freeSlots[MAGAZINE_SIZE];
+    size_t m_freeSlotCount;
+
+    // Spawns and releases not handed to the pool yet, already linked up for a single PushChain()
+    uint32_t m_firstSpawn;
+    uint32_t m_lastSpawn;
+    size_t m_spawnCount;
+    uint32_t m_firstRelease;
+    uint32_t m_lastRelease;
+    size_t m_releaseCount;
 };
 
 
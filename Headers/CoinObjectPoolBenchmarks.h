@@ -0,0 +1,77 @@
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//             Coin Object Pool Benchmarks (h)
+//             Author: Christopher A
+//             Date: October 16, 2026
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//  Description:
+//
+//		Micro benchmarks for the CoinObjectPool. Run with `CppTests --bench`.
+//      Results are written to std::cout.
+//
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+
+#ifndef     __COIN_OBJECT_POOL_BENCHMARKS_H_
+#define     __COIN_OBJECT_POOL_BENCHMARKS_H_
+
+
+
+// @brief Measures the cost of releasing active coins while the pool holds 100 to 100,000 of them:
+// in random pickup order, in slot order, and through the old std::find search, which grows with the
+// coin count. A release does the same work at any count, but it unlinks the coin from the active list,
+// the expiry wheel and its grid cell, whose neighbours are scattered. Once the pool outgrows the cache
+// those are misses, so both orders climb at 100,000 coins, random order roughly twice as much.
+void RunCoinReleaseBenchmark();
+
+// @brief Spawns and releases bursts of 10, 100 and 1,000 coins, one call per coin against
+// TrySpawnCoins / ReleaseCoins, with one Update() per burst. Runs in both threading modes.
+void RunCoinBurstBenchmark();
+
+// @brief 64 players looking for coins to pick up among 10,000 coins, brute force over every
+// coin against CollectCoinsInRadius. Also checks that both find the same coins, and that huge,
+// infinite, negative and NaN radii and non-finite positions give sensible answers.
+// @return true if every check passed.
+bool RunCoinPickupQueryBenchmark();
+
+// @brief Times the DENSE_SWEEP lifetime kernels over 100,000 coins for 300 frames and checks that
+// every SIMD kernel gives exactly the same lifetimes and expired indices as the scalar one.
+// @return true if all kernels agreed.
+bool RunCoinLifetimeKernelBenchmark();
+
+// @brief A wave of 10,000 coins that all expire on the same frame. Times that frame's Update() and
+// a quiet frame's Update() for both expiry modes, then dumps the pool telemetry.
+void RunCoinExpiryWaveBenchmark();
+
+// @brief Sustained overload: 100 coins with a 300 frame lifetime are asked for every frame, three times
+// what a 10,000 coin pool can hold, for 1,200 frames. Compares the exhaustion policies, plus a
+// FAIL_SPAWN pool that was grown to fit up front with an explicit Grow().
+void RunCoinExhaustionBenchmark();
+
+// @brief Rollback netcode pattern on a full 10,000 coin pool: one capture per frame (full every 8th
+// frame, deltas otherwise) while 100 coins are spawned and 100 picked up per frame, then rolling back
+// 8 frames. Times every capture and restore and checks that re-simulating gives the same coins, and
+// that skipped, corrupted and stale deltas, and expiry heaps with a repeated slot or out of order, are
+// refused with the pool left as it was.
+// @return true if the re-simulated frames matched the original ones and every bad snapshot was refused.
+bool RunCoinSnapshotBenchmark();
+
+// @brief Hammers a CONCURRENT pool from 8 threads while another thread runs Update(), and checks
+// that no coin is ever handed to two owners, that released handles go stale, and that every slot
+// comes back afterwards. A quarter of the coins expire after a few frames, so Update() races their
+// owners' releases, and every coin must end exactly once.
+// Every other thread goes through a CoinThreadCache, so both paths run against each other.
+// @return true if the pool stayed consistent.
+bool RunConcurrentCoinPoolStressTest();
+
+// @brief Spawn + release throughput from 1 to 32 threads, for a CONCURRENT pool used directly,
+// the same pool through per-thread CoinThreadCaches, and a SINGLE_THREADED pool behind a std::mutex.
+// Each pool also has one thread running Update() in a loop.
+void RunConcurrentCoinThroughputBenchmark();
+
+// @brief Runs every CoinObjectPool benchmark in turn, carrying on past a failed check so every result
+// is printed.
+// @return true if every benchmark that checks its results passed.
+bool RunCoinObjectPoolBenchmarks();
+
+
+
+#endif  //  __COIN_OBJECT_POOL_BENCHMARKS_H_
@@ -0,0 +1,44 @@
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//             Coin Pool Workloads (h)
+//             Author: Christopher A
+//             Date: October 16, 2026
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//  Description:
+//
+//		Scripted game workloads for judging changes to the CoinObjectPool, run
+//      by the standalone CoinPoolBenchmarks executable.
+//
+//      Each workload plays out a fixed, seeded sequence of frames: enemies
+//      dropping coins, players walking around picking them up, and Update()
+//      once per frame. Every workload runs once per expiry mode, and the
+//      exhaustion workload once per exhaustion policy as well. Each run reports
+//      ns per spawn / release / pickup query / Update(), frame time
+//      percentiles, and cache misses per frame where perf_event is available.
+//
+//      - steady-drip   A few kills a frame, players collecting as they go.
+//      - boss-kill     The drip, plus a boss dropping 2,500 coins every 10 seconds.
+//      - mass-pickup   A nearly full pool, emptied in chunks by a coin magnet.
+//      - exhaustion    Three times more coins asked for than the pool holds,
+//                      under each CoinExhaustionPolicy.
+//
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+
+#ifndef     __COIN_POOL_WORKLOADS_H_
+#define     __COIN_POOL_WORKLOADS_H_
+
+
+#include <cstddef>
+#include <ostream>
+
+
+
+// @brief Runs the workload called _name, or every workload if _name is nullptr.
+// @return Number of workloads run. 0 means no workload has that name.
+size_t RunCoinPoolWorkloads(const char* _name);
+
+// @brief Writes the name of every workload, one per line.
+void ListCoinPoolWorkloads(std::ostream& _os);
+
+
+
+#endif  //  __COIN_POOL_WORKLOADS_H_
@@ -0,0 +1,167 @@
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//             Coin Spatial Grid (h)
+//             Author: Christopher A
+//             Date: October 16, 2026
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//  Description:
+//
+//		Uniform spatial hash grid over pool slots, used by the CoinObjectPool
+//      to answer "which coins are near this player" without looking at every
+//      active coin.
+//
+//      Space is cut into cubic cells of a fixed size. Cells are hashed into a
+//      fixed number of buckets, so the world does not need bounds and memory
+//      only depends on the slot count. Each bucket is an intrusive doubly
+//      linked list threaded through per-slot arrays, which makes Insert and
+//      Remove O(1) and means nothing is allocated after construction, unless
+//      the owning pool grows.
+//
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+
+#ifndef     __COIN_SPATIAL_GRID_H_
+#define     __COIN_SPATIAL_GRID_H_
+
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+#include "PoolSnapshot.h"
+#include "Vector3.h"
+
+
+
+class CoinSpatialGrid
+{
+public:
+    static constexpr uint32_t EMPTY = 0xFFFFFFFFu;
+
+    // @param _slotCapacity Number of slots that may ever be inserted. Slot indices must be below this.
+    // @param _cellSize Edge length of a cell. Roughly the typical query radius works well.
+    CoinSpatialGrid(size_t _slotCapacity, float _cellSize);
+
+    // @brief Makes room for slots up to _slotCapacity. Slots already in the grid stay in it. Allocates.
+    void Grow(size_t _slotCapacity);
+
+    // @brief Adds a slot to the cell containing _position. The slot must not already be in the grid.
+    void Insert(uint32_t _slot, const Vector3& _position);
+
+    // @brief Adds several slots to the cell containing _position, e.g. a burst of coins spawned together.
+    // The cell is only worked out once and the slots join its bucket as one chain. None may already be in the grid.
+    void InsertBatch(std::span<const uint32_t> _slots, const Vector3& _position);
+
+    // @brief Takes a slot out of its cell in O(1). The slot must be in the grid.
+    void Remove(uint32_t _slot);
+
+    // @brief Calls _visitor(slot) for every slot within _radius of _center.
+    // Only the cells overlapping the query sphere's bounding box are visited. Negative and NaN radii
+    // visit nothing.
+    template <typename Visitor>
+    void ForEachSlotInRadius(const Vector3& _center, float _radius, Visitor&& _visitor) const;
+
+    // @brief Number of cells a query of _radius has to visit. A double, since a huge radius covers more
+    // cells than a size_t can count.
+    double GetCellCountInRadius(float _radius) const;
+
+    // @brief Position the slot was inserted with.
+    const Vector3& GetPosition(uint32_t _slot) const;
+
+    float GetCellSize() const;
+
+
+    // ~~~ Snapshots ~~~
+    // @brief Upper bound on the bytes WriteSnapshot() needs.
+    size_t GetMaxSnapshotSize() const;
+
+    // @brief Writes the whole grid, or with _deltaOnly just the blocks of slots and buckets changed since
+    // the last WriteSnapshot() or ReadSnapshot().
+    void WriteSnapshot(SnapshotWriter& _writer, bool _deltaOnly);
+
+    // @brief Steps over what ReadSnapshot() would read, checking it without changing anything.
+    // @return false if the data is malformed.
+    bool ValidateSnapshot(SnapshotReader& _reader) const;
+
+    // @brief Reads back what WriteSnapshot() wrote. A delta must be read into the state it was taken after.
+    // @return false if the data is malformed.
+    bool ReadSnapshot(SnapshotReader& _reader);
+
+
+private:
+    // Cell coordinates are clamped to 21 bits each so a cell fits in one 64 bit key
+    static const int32_t MAX_CELL_COORDINATE = (1 << 20) - 1;
+
+    // Bucket links, bucket, cell key and position of one slot, as WriteSlotRange() writes them
+    static const size_t SNAPSHOT_BYTES_PER_SLOT = sizeof(uint32_t) * 3 + sizeof(uint64_t) + sizeof(Vector3);
+
+    int32_t GetCellCoordinate(float _position) const;
+    static uint64_t PackCellKey(int32_t _x, int32_t _y, int32_t _z);
+    static size_t GetBucketCount(size_t _slotCapacity);
+    uint32_t GetBucket(int32_t _x, int32_t _y, int32_t _z) const;
+
+    void WriteSlotRange(SnapshotWriter& _writer, uint32_t _firstSlot, size_t _count) const;
+    void ReadSlotRange(SnapshotReader& _reader, uint32_t _firstSlot, size_t _count);
+
+    float m_cellSize;
+    float m_inverseCellSize;
+    uint32_t m_bucketMask;
+
+    // Head slot of each bucket's list
+    std::vector<uint32_t> m_bucketHeads;
+
+    // Per slot: list links, bucket, exact cell (buckets are shared by several cells) and position
+    std::vector<uint32_t> m_nextInBucket;
+    std::vector<uint32_t> m_prevInBucket;
+    std::vector<uint32_t> m_bucketOfSlot;
+    std::vector<uint64_t> m_cellKeyOfSlot;
+    std::vector<Vector3> m_positions;
+
+    // Blocks of slots and buckets written to since the last snapshot, for delta snapshots
+    DirtyBlockSet m_dirtySlots;
+    DirtyBlockSet m_dirtyBuckets;
+};
+
+
+
+// @brief Calls _visitor(slot) for every slot within _radius of _center.
+// Only the cells overlapping the query sphere's bounding box are visited.
+template <typename Visitor>
+void CoinSpatialGrid::ForEachSlotInRadius(const Vector3& _center, float _radius, Visitor&& _visitor) const
+{
+    // Negative and NaN radii contain nothing
+    if ((_radius >= 0.0f) == false)
+    {
+        return;
+    }
+
+    const float radiusSqr = _radius * _radius;
+    const int32_t minX = GetCellCoordinate(_center.GetX() - _radius);
+    const int32_t maxX = GetCellCoordinate(_center.GetX() + _radius);
+    const int32_t minY = GetCellCoordinate(_center.GetY() - _radius);
+    const int32_t maxY = GetCellCoordinate(_center.GetY() + _radius);
+    const int32_t minZ = GetCellCoordinate(_center.GetZ() - _radius);
+    const int32_t maxZ = GetCellCoordinate(_center.GetZ() + _radius);
+
+    for (int32_t z = minZ; z <= maxZ; ++z)
+    {
+        for (int32_t y = minY; y <= maxY; ++y)
+        {
+            for (int32_t x = minX; x <= maxX; ++x)
+            {
+                // Several cells can share a bucket, so the exact cell is checked too. Otherwise a
+                // slot would be reported once for every visited cell that hashes to its bucket.
+                const uint64_t cellKey = PackCellKey(x, y, z);
+                for (uint32_t slot = m_bucketHeads[GetBucket(x, y, z)]; slot != EMPTY; slot = m_nextInBucket[slot])
+                {
+                    if (m_cellKeyOfSlot[slot] == cellKey && (m_positions[slot] - _center).MagnitudeSqr() <= radiusSqr)
+                    {
+                        _visitor(slot);
+                    }
+                }
+            }
+        }
+    }
+}
+
+
+
+#endif  //  __COIN_SPATIAL_GRID_H_
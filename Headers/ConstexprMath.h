@@ -0,0 +1,107 @@
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//             Constexpr Math (h)
+//             Author: Christopher A
+//             Date: October 16, 2026
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//  Description:
+//
+//		std::abs and std::sqrt only become constexpr in C++23 and C++26, so the
+//      vector types use these instead. At runtime they are exactly std::abs
+//      and std::sqrt; during constant evaluation they fall back to plain code.
+//      ApproximateReciprocalSqrt is the odd one out: fast and approximate at
+//      runtime, exact at compile time.
+//
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+
+#ifndef     __CONSTEXPR_MATH_H_
+#define     __CONSTEXPR_MATH_H_
+
+
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+#if defined(_M_X64) || defined(__x86_64__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1) || defined(__SSE__)
+#define CONSTEXPR_MATH_SSE 1
+#include <xmmintrin.h>
+#endif
+
+
+
+template <typename T>
+constexpr T ConstexprAbs(T _value)
+{
+    if (std::is_constant_evaluated())
+    {
+        return (_value < (T)0) ? -_value : _value;
+    }
+    return (T)std::abs(_value);
+}
+
+
+// @brief Newton's method from above, stopping once a step no longer gets smaller. Should agree with
+// std::sqrt, though the last bit is not guaranteed.
+constexpr double ConstexprSqrtNewton(double _value)
+{
+    if (_value != _value || _value <= 0.0 || _value == std::numeric_limits<double>::infinity())
+    {
+        return (_value < 0.0) ? std::numeric_limits<double>::quiet_NaN() : _value;
+    }
+
+    double estimate = (_value > 1.0) ? _value : 1.0;
+    while (true)
+    {
+        double next = 0.5 * (estimate + _value / estimate);
+        if (next >= estimate)
+        {
+            return estimate;
+        }
+        estimate = next;
+    }
+}
+
+
+// @brief sqrt for any arithmetic T, in T. Integers are rounded towards zero, like static_cast<T>(std::sqrt(x)).
+template <typename T>
+constexpr T ConstexprSqrt(T _value)
+{
+    if (std::is_constant_evaluated())
+    {
+        return static_cast<T>(ConstexprSqrtNewton(static_cast<double>(_value)));
+    }
+
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        return std::sqrt(_value);
+    }
+    else
+    {
+        return static_cast<T>(std::sqrt(static_cast<double>(_value)));
+    }
+}
+
+
+
+// Vectors with a squared length under this come out of the NormalisedFast functions as zero. It is
+// EPSILON squared, so it agrees with Normalised()'s magnitude < EPSILON check.
+#define FAST_NORMALISE_MIN_MAGNITUDE_SQR 1e-14f
+
+
+// @brief 1 / sqrt(_value) to about 1e-6 relative error, from rsqrtss's 12 bit estimate plus one
+// Newton-Raphson step. Exact where SSE is not available and at compile time. Positive normal floats only;
+// zero, denormals and infinity give garbage.
+constexpr float ApproximateReciprocalSqrt(float _value)
+{
+#if CONSTEXPR_MATH_SSE
+    if (std::is_constant_evaluated() == false)
+    {
+        float estimate = _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(_value)));
+        return estimate * (1.5f - 0.5f * _value * estimate * estimate);
+    }
+#endif
+    return 1.0f / ConstexprSqrt(_value);
+}
+
+
+
+#endif  //  __CONSTEXPR_MATH_H_
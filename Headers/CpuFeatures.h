@@ -0,0 +1,43 @@
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//             CPU Features (h)
+//             Author: Christopher A
+//             Date: October 16, 2026
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//  Description:
+//
+//		Runtime CPU feature checks for the SIMD kernels, so one build can pick
+//      the widest instruction set the machine it runs on actually has.
+//
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+
+#ifndef     __CPU_FEATURES_H_
+#define     __CPU_FEATURES_H_
+
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define CPU_FEATURES_X86 1
+#endif
+
+
+// MSVC lets AVX2 intrinsics be used anywhere; GCC and Clang need the function marked for them
+#if defined(__GNUC__) || defined(__clang__)
+#define CPU_TARGET_AVX2 __attribute__((target("avx2")))
+#define CPU_TARGET_AVX2_FMA __attribute__((target("avx2,fma")))
+#define CPU_TARGET_AVX2_F16C __attribute__((target("avx2,f16c")))
+#else
+#define CPU_TARGET_AVX2
+#define CPU_TARGET_AVX2_FMA
+#define CPU_TARGET_AVX2_F16C
+#endif
+
+
+
+#ifdef CPU_FEATURES_X86
+bool IsAVX2Supported();
+bool IsFMASupported();
+bool IsF16CSupported();
+#endif
+
+
+
+#endif  //  __CPU_FEATURES_H_
@@ -34,9 +34,22 @@ Vector3 GetPointOnCubicBezierCurve(const Vector3& _pointStart, const Vector3& _t
 
 
 
+// @brief Derivative of the Cubic Bezier curve at 't', normalised. Direction only, so this uses
+// NormalisedFast. A curve that stops dead at 't' (e.g. coincident control points) gives zero.
+Vector3 GetTangentOnCubicBezierCurve(const Vector3& _pointStart, const Vector3& _tangentPoint1,
+                                    const Vector3& _tangentPoint2, const Vector3& _endPoint,
+                                    float _t);
+
+
+
 // @brief This function chains multiple Cubic Bezier curves to interpolate an arbitrary number of points.
+// A NaN _globalTime counts as 0.
 Vector3 GetPointOnInterpolatedBezierSpline(const std::vector<Vector3>& _points, float _globalTime);
 
+// @brief Direction of travel along the spline at _globalTime, normalised with NormalisedFast.
+// Zero for fewer than two points. A NaN _globalTime counts as 0.
+Vector3 GetTangentOnInterpolatedBezierSpline(const std::vector<Vector3>& _points, float _globalTime);
+
 // @brief Clears the console screen using ANSI escape codes
 void ClearConsole();
 
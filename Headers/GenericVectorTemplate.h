@@ -34,12 +34,24 @@
 //
 //=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 
+#ifndef     __GENERIC_VECTOR_TEMPLATE_H_
+#define     __GENERIC_VECTOR_TEMPLATE_H_
+
+
 #ifndef EPSILON
 #define EPSILON 0.0000001
 #endif
 
 #include <iostream>
 #include <array>
+#include <cassert>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "ConstexprMath.h"
+#include "VectorDivisionPolicy.h"
+#include "VectorDotKernels.h"
 
 
 template <int N, typename T = float>
@@ -52,57 +64,273 @@ std::ostream& operator << (std::ostream& _os, const Vector<N, T>& _vec);
 
 
 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//              Expression Templates
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// The element-wise operators (+, -, * scalar, / scalar, unary -) do not compute anything themselves.
+// They return a small node describing the operation, and the whole tree is evaluated one component at
+// a time, in a single loop, only when it is stored into a Vector. So
+//
+//      Vector<16> result = a + b * s - c;
+//
+// is one loop writing result directly, rather than three loops and two temporary Vectors.
+//
+// Nodes hold Vectors by reference and other nodes by value. Keep the result of an expression in a
+// Vector, not an auto, or it can outlive the Vectors it refers to.
+
+// @brief Base of Vector and of every expression node. Derived has to provide GetComponent(int).
+template <typename Derived, int N, typename T>
+class VectorExpression
+{
+public:
+    constexpr const Derived& GetDerived() const
+    {
+        return static_cast<const Derived&>(*this);
+    }
+
+    // @brief Evaluates the expression into a Vector, e.g. (a + b).Eval().Magnitude()
+    constexpr Vector<N, T> Eval() const
+    {
+        return Vector<N, T>(*this);
+    }
+};
+
+
+// @brief Calls _function(i) for every i in [0, N). Short vectors get it fully unrolled, which lets the
+// compiler keep small results in registers; -O2 will not unroll a loop over a std::array on its own.
+template <int N, typename Function>
+constexpr void ForEachVectorComponent(Function&& _function)
+{
+    if constexpr (N <= 16)
+    {
+        [&]<int... Indices>(std::integer_sequence<int, Indices...>)
+        {
+            (_function(Indices), ...);
+        }(std::make_integer_sequence<int, N>());
+    }
+    else
+    {
+        for (int i = 0; i < N; ++i)
+        {
+            _function(i);
+        }
+    }
+}
+
+
+// Vectors are referred to, other nodes are small and copied
+template <typename Expression>
+struct VectorOperandStorage
+{
+    typedef const Expression Type;
+};
+
+template <int N, typename T>
+struct VectorOperandStorage<Vector<N, T>>
+{
+    typedef const Vector<N, T>& Type;
+};
+
+
+struct VectorAddOperation
+{
+    template <typename T>
+    static constexpr T Apply(T _left, T _right) { return (T)(_left + _right); }
+};
+
+struct VectorSubtractOperation
+{
+    template <typename T>
+    static constexpr T Apply(T _left, T _right) { return (T)(_left - _right); }
+};
+
+
+// @brief _left Operation _right, component by component
+template <typename Left, typename Right, typename Operation, int N, typename T>
+class VectorBinaryExpression : public VectorExpression<VectorBinaryExpression<Left, Right, Operation, N, T>, N, T>
+{
+public:
+    constexpr VectorBinaryExpression(const Left& _left, const Right& _right)
+        : m_left(_left), m_right(_right)
+    {
+    }
+
+    constexpr T GetComponent(int _index) const
+    {
+        return Operation::Apply(m_left.GetComponent(_index), m_right.GetComponent(_index));
+    }
+
+private:
+    typename VectorOperandStorage<Left>::Type m_left;
+    typename VectorOperandStorage<Right>::Type m_right;
+};
+
+
+// @brief _operand * _scalar
+template <typename Operand, int N, typename T>
+class VectorScaleExpression : public VectorExpression<VectorScaleExpression<Operand, N, T>, N, T>
+{
+public:
+    constexpr VectorScaleExpression(const Operand& _operand, T _scalar)
+        : m_operand(_operand), m_scalar(_scalar)
+    {
+    }
+
+    constexpr T GetComponent(int _index) const
+    {
+        return (T)(m_operand.GetComponent(_index) * m_scalar);
+    }
+
+private:
+    typename VectorOperandStorage<Operand>::Type m_operand;
+    T m_scalar;
+};
+
+
+// @brief _operand / _scalar, with a (nearly) zero _scalar handled as Policy says. The divisor is checked
+// once, when the node is made, not per component.
+template <VectorDivisionPolicy Policy, typename Operand, int N, typename T>
+class VectorQuotientExpression : public VectorExpression<VectorQuotientExpression<Policy, Operand, N, T>, N, T>
+{
+public:
+    constexpr VectorQuotientExpression(const Operand& _operand, T _scalar)
+        : m_operand(_operand), m_divisor(_scalar), m_isSafe(true)
+    {
+        CheckVectorDivisor<Policy>(_scalar);
+        if constexpr (Policy == VECTOR_DIVISION_SATURATE)
+        {
+            // The quotient is selected away rather than divided by infinity, so an infinite or NaN component
+            // still gives exactly zero, as Vector3::Divide does. Integers may not divide by zero even to
+            // throw the result away, so an unsafe divisor is also swapped for 1
+            m_isSafe = IsSafeVectorDivisor(_scalar);
+            m_divisor = m_isSafe ? _scalar : (T)1;
+        }
+    }
+
+    constexpr T GetComponent(int _index) const
+    {
+        if constexpr (Policy == VECTOR_DIVISION_SATURATE)
+        {
+            return m_isSafe ? (T)(m_operand.GetComponent(_index) / m_divisor) : (T)0;
+        }
+        return (T)(m_operand.GetComponent(_index) / m_divisor);
+    }
+
+private:
+    typename VectorOperandStorage<Operand>::Type m_operand;
+    T m_divisor;
+    bool m_isSafe;
+};
+
+
+// @brief -_operand
+template <typename Operand, int N, typename T>
+class VectorNegateExpression : public VectorExpression<VectorNegateExpression<Operand, N, T>, N, T>
+{
+public:
+    constexpr explicit VectorNegateExpression(const Operand& _operand)
+        : m_operand(_operand)
+    {
+    }
+
+    constexpr T GetComponent(int _index) const
+    {
+        return (T)(-m_operand.GetComponent(_index));
+    }
+
+private:
+    typename VectorOperandStorage<Operand>::Type m_operand;
+};
+
+
+
 template <int N, typename T>
-class Vector 
+class Vector : public VectorExpression<Vector<N, T>, N, T>
 {
 public:
 
     // @brief Default constructor: Initializes all components to zero
-    Vector();
+    constexpr Vector();
 
     // @brief Variadic template constructor: Initializes with up to N arguments
     // Extra arguments are ignored, missing arguments are filled with zero.
     template <typename... Args>
-    explicit Vector(Args... _args);
+        requires (std::is_arithmetic_v<Args> && ...)
+    constexpr explicit Vector(Args... _args);
 
-    T GetX() const;
-    T GetY() const;
-    T GetZ() const;
-    T GetW() const;
+    // @brief Evaluates an expression such as a + b * s straight into the new Vector, in one loop.
+    template <typename Expression>
+    constexpr Vector(const VectorExpression<Expression, N, T>& _expression);
 
-    Vector& SetX(const T& _val);
-    Vector& SetY(const T& _val);
-    Vector& SetZ(const T& _val);
-    Vector& SetW(const T& _val);
+    template <typename Expression>
+    constexpr Vector& operator = (const VectorExpression<Expression, N, T>& _expression);
 
-    // ~~~ Operators ~~~
-    T& operator [] (int _index);
-    const T& operator [] (int _index) const;
+    // Only exist when N is large enough, e.g. GetZ() on a Vector<2> does not compile
+    constexpr T GetX() const requires (N >= 1);
+    constexpr T GetY() const requires (N >= 2);
+    constexpr T GetZ() const requires (N >= 3);
+    constexpr T GetW() const requires (N >= 4);
+
+    constexpr Vector& SetX(const T& _val) requires (N >= 1);
+    constexpr Vector& SetY(const T& _val) requires (N >= 2);
+    constexpr Vector& SetZ(const T& _val) requires (N >= 3);
+    constexpr Vector& SetW(const T& _val) requires (N >= 4);
+
+    // @brief Component Index, checked at compile time.
+    template <int Index>
+        requires (Index >= 0 && Index < N)
+    constexpr T& Get();
+    template <int Index>
+        requires (Index >= 0 && Index < N)
+    constexpr const T& Get() const;
+
+    // @brief Component _index. Throws std::out_of_range if there is no such component.
+    constexpr T& At(int _index);
+    constexpr const T& At(int _index) const;
 
-    Vector operator + () const;
-    Vector operator - () const;
+    // ~~~ Operators ~~~
+    // @brief Component _index. Only asserted in range, so a release build does a plain load; an out of
+    // range index in a constant expression does not compile. Use At() for an index that needs checking.
+    constexpr T& operator [] (int _index);
+    constexpr const T& operator [] (int _index) const;
 
-    Vector operator + (const Vector& _other) const;
-    Vector operator - (const Vector& _other) const;
+    // @brief Component _index, unchecked. What expressions read Vectors through.
+    constexpr T GetComponent(int _index) const;
 
-    Vector operator * (T _scalar) const;
-    Vector operator / (T _scalar) const;
+    // Binary -, +, * and / and unary - are the expression operators below the class
+    constexpr Vector operator + () const;
 
-    Vector& operator += (const Vector& _other);
-    Vector& operator -= (const Vector& _other);
-    Vector& operator *= (T _scalar);
-    Vector& operator /= (T _scalar);
+    template <typename Expression>
+    constexpr Vector& operator += (const VectorExpression<Expression, N, T>& _expression);
+    template <typename Expression>
+    constexpr Vector& operator -= (const VectorExpression<Expression, N, T>& _expression);
+    constexpr Vector& operator *= (T _scalar);
+    constexpr Vector& operator /= (T _scalar);
 
-    bool operator == (const Vector& _other) const;
-    bool operator != (const Vector& _other) const;
+    constexpr bool operator == (const Vector& _other) const;
+    constexpr bool operator != (const Vector& _other) const;
 
     // ~~~ Vector Functions ~~~
-    T Dot(const Vector& _other) const;
-    T Magnitude() const;
-    T MagnitudeSqr() const;
-    Vector& Normalise();
-    Vector Normalised() const;
-    Vector<N, T> Cross(const Vector<N, T>& _other) const;
+    // Dot and MagnitudeSqr on float vectors of VECTOR_DOT_KERNEL_MIN_COMPONENTS or more run the
+    // SIMD kernels in VectorDotKernels.h, which sum in a different order than a constant evaluation.
+    constexpr T Dot(const Vector& _other) const;
+
+    // @brief Dot() summed in double for float vectors, for long or badly conditioned sums. Any other T gets Dot().
+    constexpr T DotAccurate(const Vector& _other) const;
+    constexpr T Magnitude() const;
+    constexpr T MagnitudeSqr() const;
+    constexpr Vector& Normalise();
+    constexpr Vector Normalised() const;
+
+    // @brief Normalised() to within about 1e-6 relative error, using rsqrtss for float vectors.
+    // Any other T gets the exact Normalised().
+    constexpr Vector NormalisedFast() const;
+    constexpr Vector<N, T> Cross(const Vector<N, T>& _other) const requires (N == 3);
+
+    // @brief *this / _scalar, with a _scalar within EPSILON of zero handled as Policy says. operator / and
+    // operator /= use VECTOR_DIVISION_DEFAULT_POLICY. See VectorDivisionPolicy.h.
+    template <VectorDivisionPolicy Policy>
+    constexpr Vector Divide(T _scalar) const;
 
     // ~~~ Friend Declarations for Global Operators ~~~
     template <int M, typename U>
@@ -113,3 +341,449 @@ private:
     std::array<T, N> m_components;
 };
 
+
+
+// Everything is defined here rather than in a cpp, constexpr throughout, so any N and T can be used
+// and the compiler can inline the operators into hot loops.
+
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//              Constructors
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// @brief Default constructor: Initializes all components to zero
+template <int N, typename T>
+constexpr Vector<N, T>::Vector()
+{
+    m_components.fill((T)0);
+}
+
+// @brief Variadic template constructor: Initializes with up to N arguments
+// Extra arguments are ignored, missing arguments are filled with zero.
+template <int N, typename T>
+template <typename... Args>
+    requires (std::is_arithmetic_v<Args> && ...)
+constexpr Vector<N, T>::Vector(Args... _args) 
+    : m_components()
+{
+    const int ArgsCount = sizeof...(_args);
+    static_assert(ArgsCount <= N, "Too many arguments for Vector constructor. Exceeds component dimensions.");
+    std::array<T, ArgsCount> tempArgs = { static_cast<T>(_args)... };
+    for (int i = 0; i < ArgsCount; ++i)
+    {
+        m_components[i] = tempArgs[i];
+    }
+}
+
+// @brief Evaluates an expression such as a + b * s straight into the new Vector, in one loop.
+// m_components is left uninitialised, as every component is written exactly once.
+template <int N, typename T>
+template <typename Expression>
+constexpr Vector<N, T>::Vector(const VectorExpression<Expression, N, T>& _expression)
+{
+    const Expression& expression = _expression.GetDerived();
+    ForEachVectorComponent<N>([&](int _index) { m_components[_index] = expression.GetComponent(_index); });
+}
+
+// *this is often part of the expression too (sum = sum + v * s). Writing into it while the expression
+// still reads it through a reference makes the compiler reload every operand after every store, so the
+// result goes into a local first, which stays in registers, and is copied over at the end.
+template <int N, typename T>
+template <typename Expression>
+constexpr Vector<N, T>& Vector<N, T>::operator = (const VectorExpression<Expression, N, T>& _expression)
+{
+    const Expression& expression = _expression.GetDerived();
+    std::array<T, N> result;
+    ForEachVectorComponent<N>([&](int _index) { result[_index] = expression.GetComponent(_index); });
+    m_components = result;
+    return *this;
+}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//              Getters / Setters
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+template <int N, typename T>
+constexpr T Vector<N, T>::GetX() const requires (N >= 1)
+{
+    return m_components[0];
+}
+
+template <int N, typename T>
+constexpr T Vector<N, T>::GetY() const requires (N >= 2)
+{
+    return m_components[1];
+}
+
+template <int N, typename T>
+constexpr T Vector<N, T>::GetZ() const requires (N >= 3)
+{
+    return m_components[2];
+}
+
+template <int N, typename T>
+constexpr T Vector<N, T>::GetW() const requires (N >= 4)
+{
+    return m_components[3];
+}
+
+template <int N, typename T>
+constexpr Vector<N, T>& Vector<N, T>::SetX(const T& _val) requires (N >= 1)
+{
+    m_components[0] = _val;
+    return *this;
+}
+
+template <int N, typename T>
+constexpr Vector<N, T>& Vector<N, T>::SetY(const T& _val) requires (N >= 2)
+{
+    m_components[1] = _val;
+    return *this;
+}
+
+template <int N, typename T>
+constexpr Vector<N, T>& Vector<N, T>::SetZ(const T& _val) requires (N >= 3)
+{
+    m_components[2] = _val;
+    return *this;
+}
+
+template <int N, typename T>
+constexpr Vector<N, T>& Vector<N, T>::SetW(const T& _val) requires (N >= 4)
+{
+    m_components[3] = _val;
+    return *this;
+}
+
+template <int N, typename T>
+template <int Index>
+    requires (Index >= 0 && Index < N)
+constexpr T& Vector<N, T>::Get()
+{
+    return m_components[Index];
+}
+
+template <int N, typename T>
+template <int Index>
+    requires (Index >= 0 && Index < N)
+constexpr const T& Vector<N, T>::Get() const
+{
+    return m_components[Index];
+}
+
+template <int N, typename T>
+constexpr T& Vector<N, T>::At(int _index)
+{
+    if (_index < 0 || _index >= N)
+    {
+        throw std::out_of_range("Vector::At: index out of bounds");
+    }
+    return m_components[_index];
+}
+
+template <int N, typename T>
+constexpr const T& Vector<N, T>::At(int _index) const
+{
+    if (_index < 0 || _index >= N)
+    {
+        throw std::out_of_range("Vector::At: index out of bounds");
+    }
+    return m_components[_index];
+}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//              Operators
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+template <int N, typename T>
+constexpr T& Vector<N, T>::operator [] (int _index)
+{
+    assert(_index >= 0 && _index < N && "Vector::operator []: index out of bounds");
+    return m_components[_index];
+}
+
+template <int N, typename T>
+constexpr const T& Vector<N, T>::operator [] (int _index) const
+{
+    assert(_index >= 0 && _index < N && "Vector::operator []: index out of bounds");
+    return m_components[_index];
+}
+
+template <int N, typename T>
+constexpr Vector<N, T> Vector<N, T>::operator + () const
+{
+    return *this;
+}
+
+template <int N, typename T>
+constexpr T Vector<N, T>::GetComponent(int _index) const
+{
+    return m_components[_index];
+}
+
+template <int N, typename T>
+template <VectorDivisionPolicy Policy>
+constexpr Vector<N, T> Vector<N, T>::Divide(T _scalar) const
+{
+    return VectorQuotientExpression<Policy, Vector, N, T>(*this, _scalar);
+}
+
+template <int N, typename T>
+template <typename Expression>
+constexpr Vector<N, T>& Vector<N, T>::operator += (const VectorExpression<Expression, N, T>& _expression)
+{
+    const Expression& expression = _expression.GetDerived();
+    ForEachVectorComponent<N>([&](int _index) { m_components[_index] += expression.GetComponent(_index); });
+    return *this;
+}
+
+template <int N, typename T>
+template <typename Expression>
+constexpr Vector<N, T>& Vector<N, T>::operator -= (const VectorExpression<Expression, N, T>& _expression)
+{
+    const Expression& expression = _expression.GetDerived();
+    ForEachVectorComponent<N>([&](int _index) { m_components[_index] -= expression.GetComponent(_index); });
+    return *this;
+}
+
+template <int N, typename T>
+constexpr Vector<N, T>& Vector<N, T>::operator *= (T _scalar)
+{
+    for (int i = 0; i < N; ++i)
+    {
+        m_components[i] *= _scalar;
+    }
+    return *this;
+}
+
+template <int N, typename T>
+constexpr Vector<N, T>& Vector<N, T>::operator /= (T _scalar)
+{
+    return *this = *this / _scalar;
+}
+
+template <int N, typename T>
+constexpr bool Vector<N, T>::operator == (const Vector& _other) const
+{
+    for (int i = 0; i < N; ++i)
+    {
+        if (ConstexprAbs(m_components[i] - _other.m_components[i]) > 0.0f)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <int N, typename T>
+constexpr bool Vector<N, T>::operator != (const Vector& _other) const
+{
+    return (*this == _other) == false;
+}
+
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//              Vector Functions
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+template <int N, typename T>
+constexpr T Vector<N, T>::Dot(const Vector& _other) const
+{
+    if constexpr (std::is_same_v<T, float> && N >= VECTOR_DOT_KERNEL_MIN_COMPONENTS)
+    {
+        if (std::is_constant_evaluated() == false)
+        {
+            return DotFloats(m_components.data(), _other.m_components.data(), N);
+        }
+    }
+
+    T sum = (T)0;
+    for (int i = 0; i < N; ++i)
+    {
+        sum += m_components[i] * _other.m_components[i];
+    }
+    return sum;
+}
+
+template <int N, typename T>
+constexpr T Vector<N, T>::DotAccurate(const Vector& _other) const
+{
+    if constexpr (std::is_same_v<T, float>)
+    {
+        if (std::is_constant_evaluated() == false)
+        {
+            return DotFloatsAccurate(m_components.data(), _other.m_components.data(), N);
+        }
+
+        double sum = 0.0;
+        for (int i = 0; i < N; ++i)
+        {
+            sum += (double)m_components[i] * _other.m_components[i];
+        }
+        return (float)sum;
+    }
+    else
+    {
+        return Dot(_other);
+    }
+}
+
+template <int N, typename T>
+constexpr T Vector<N, T>::Magnitude() const
+{
+    T magSqr = MagnitudeSqr();
+    T mag = ConstexprSqrt(magSqr);
+    return mag;
+}
+
+template <int N, typename T>
+constexpr T Vector<N, T>::MagnitudeSqr() const
+{
+    if constexpr (std::is_same_v<T, float> && N >= VECTOR_DOT_KERNEL_MIN_COMPONENTS)
+    {
+        if (std::is_constant_evaluated() == false)
+        {
+            return DotFloats(m_components.data(), m_components.data(), N);
+        }
+    }
+
+    T magSqr = (T)0;
+    for (int i = 0; i < N; ++i)
+    {
+        magSqr += m_components[i] * m_components[i];
+    }
+    return magSqr;
+}
+
+template <int N, typename T>
+constexpr Vector<N, T>& Vector<N, T>::Normalise()
+{
+    T mag = Magnitude();
+    if (ConstexprAbs(mag) < EPSILON)
+    {
+        return *this; // Vector.zero
+    }
+    return *this /= mag;
+}
+
+template <int N, typename T>
+constexpr Vector<N, T> Vector<N, T>::Normalised() const
+{
+    T mag = Magnitude();
+    if (ConstexprAbs(mag) < EPSILON)
+    {
+        return Vector(); // Vector.Zero
+    }
+    return *this / mag;
+}
+
+template <int N, typename T>
+constexpr Vector<N, T> Vector<N, T>::NormalisedFast() const
+{
+    if constexpr (std::is_same_v<T, float>)
+    {
+        T magSqr = MagnitudeSqr();
+        if (magSqr < FAST_NORMALISE_MIN_MAGNITUDE_SQR)
+        {
+            return Vector(); // Vector.Zero
+        }
+        return *this * ApproximateReciprocalSqrt(magSqr);
+    }
+    else
+    {
+        return Normalised();
+    }
+}
+
+// Any arithmetic T. Narrow integers are promoted for the products and then cast back to T, as the other operators do.
+template <int N, typename T>
+constexpr Vector<N, T> Vector<N, T>::Cross(const Vector<N, T>& _other) const requires (N == 3)
+{
+    return Vector<N, T>((T)(m_components[1] * _other.m_components[2] - m_components[2] * _other.m_components[1]),
+                        (T)(m_components[2] * _other.m_components[0] - m_components[0] * _other.m_components[2]),
+                        (T)(m_components[0] * _other.m_components[1] - m_components[1] * _other.m_components[0]));
+}
+
+
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//              Global Operators
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Any Vector or expression on either side, as long as N and T match. The scalar is a type_identity_t
+// so that, as before, it converts to T (e.g. Vector<3, float> * 2) rather than having to be exactly T.
+template <typename Left, typename Right, int N, typename T>
+constexpr VectorBinaryExpression<Left, Right, VectorAddOperation, N, T>
+    operator + (const VectorExpression<Left, N, T>& _left, const VectorExpression<Right, N, T>& _right)
+{
+    return VectorBinaryExpression<Left, Right, VectorAddOperation, N, T>(_left.GetDerived(), _right.GetDerived());
+}
+
+template <typename Left, typename Right, int N, typename T>
+constexpr VectorBinaryExpression<Left, Right, VectorSubtractOperation, N, T>
+    operator - (const VectorExpression<Left, N, T>& _left, const VectorExpression<Right, N, T>& _right)
+{
+    return VectorBinaryExpression<Left, Right, VectorSubtractOperation, N, T>(_left.GetDerived(), _right.GetDerived());
+}
+
+template <typename Operand, int N, typename T>
+constexpr VectorScaleExpression<Operand, N, T>
+    operator * (const VectorExpression<Operand, N, T>& _operand, std::type_identity_t<T> _scalar)
+{
+    return VectorScaleExpression<Operand, N, T>(_operand.GetDerived(), _scalar);
+}
+
+template <typename Operand, int N, typename T>
+constexpr VectorQuotientExpression<VECTOR_DIVISION_DEFAULT_POLICY, Operand, N, T>
+    operator / (const VectorExpression<Operand, N, T>& _operand, std::type_identity_t<T> _scalar)
+{
+    return VectorQuotientExpression<VECTOR_DIVISION_DEFAULT_POLICY, Operand, N, T>(_operand.GetDerived(), _scalar);
+}
+
+template <typename Operand, int N, typename T>
+constexpr VectorNegateExpression<Operand, N, T> operator - (const VectorExpression<Operand, N, T>& _operand)
+{
+    return VectorNegateExpression<Operand, N, T>(_operand.GetDerived());
+}
+
+template <int N, typename T>
+std::ostream& operator << (std::ostream& _os, const Vector<N, T>& _vec)
+{
+    _os << "(";
+    for (size_t i = 0; i < N; ++i)
+    {
+        _os << _vec.m_components[i];
+        if (i < (N - 1))
+        {
+            _os << ", ";
+        }
+    }
+    _os << ")";
+    return _os;
+}
+
+
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//              Global Functions
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// @brief _outDots[i] = _query.Dot(_vectors[i]), bit for bit, e.g. for a nearest neighbour scan. Long
+// vectors go through DotFloatsBatch, which loads each part of _query once for every pair of vectors.
+template <int N>
+void DotBatch(const Vector<N, float>& _query, std::type_identity_t<std::span<const Vector<N, float>>> _vectors, float* _outDots)
+{
+    static_assert(sizeof(Vector<N, float>) == N * sizeof(float), "DotBatch reads Vectors as one array of floats");
+    if constexpr (N >= VECTOR_DOT_KERNEL_MIN_COMPONENTS)
+    {
+        if (_vectors.empty() == false)
+        {
+            DotFloatsBatch(&_query[0], &_vectors[0][0], N, _vectors.size(), N, _outDots);
+        }
+    }
+    else
+    {
+        for (size_t i = 0; i < _vectors.size(); ++i)
+        {
+            _outDots[i] = _query.Dot(_vectors[i]);
+        }
+    }
+}
+
+
+
+#endif  //  __GENERIC_VECTOR_TEMPLATE_H_
@@ -0,0 +1,175 @@
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//             Lock Free Slot Stack (h)
+//             Author: Christopher A
+//             Date: October 16, 2026
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//  Description:
+//
+//		Lock-free stack of pool slot indices (a Treiber stack), used by the
+//      concurrent mode of the CoinObjectPool.
+//
+//      The stack is intrusive: every slot has a "next" entry, so pushing and
+//      popping never allocates. The head packs the top slot together with a
+//      tag that changes on every modification. That stops the classic ABA
+//      problem, where a thread reads head A -> B, other threads pop A and B
+//      and push A back, and the first thread's compare-exchange then succeeds
+//      and installs B, a slot that is no longer free.
+//
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+
+#ifndef     __LOCK_FREE_SLOT_STACK_H_
+#define     __LOCK_FREE_SLOT_STACK_H_
+
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+
+
+class LockFreeSlotStack
+{
+public:
+    static constexpr uint32_t EMPTY = 0xFFFFFFFFu;
+
+    // @param _slotCapacity Number of slots that may ever be pushed. Slot indices must be below this.
+    explicit LockFreeSlotStack(size_t _slotCapacity)
+        : m_head(Pack(0, EMPTY)),
+          m_size(0),
+          m_next(_slotCapacity, EMPTY)
+    {
+    }
+
+    LockFreeSlotStack(const LockFreeSlotStack&) = delete;
+    LockFreeSlotStack& operator = (const LockFreeSlotStack&) = delete;
+
+
+    void Push(uint32_t _slot)
+    {
+        PushChain(_slot, _slot, 1);
+    }
+
+    // @brief Pushes several slots with a single compare-exchange.
+    // The caller must already have linked _first to _last together with SetNext().
+    void PushChain(uint32_t _first, uint32_t _last, size_t _count)
+    {
+        uint64_t head = m_head.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            SetNext(_last, GetSlot(head));
+            if (m_head.compare_exchange_weak(head, Pack(GetTag(head) + 1, _first), std::memory_order_release, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        m_size.fetch_add((int64_t)_count, std::memory_order_relaxed);
+    }
+
+    // @return false if the stack was empty.
+    bool TryPop(uint32_t& _outSlot)
+    {
+        uint64_t head = m_head.load(std::memory_order_acquire);
+        for (;;)
+        {
+            uint32_t slot = GetSlot(head);
+            if (slot == EMPTY)
+            {
+                return false;
+            }
+
+            // `slot` may be popped and reused by another thread while we read its next entry. That is fine:
+            // the head's tag will have moved on and the compare-exchange below fails.
+            uint64_t newHead = Pack(GetTag(head) + 1, GetNext(slot));
+            if (m_head.compare_exchange_weak(head, newHead, std::memory_order_acquire, std::memory_order_acquire))
+            {
+                m_size.fetch_sub(1, std::memory_order_relaxed);
+                _outSlot = slot;
+                return true;
+            }
+        }
+    }
+
+    // @brief Pops up to _maxCount slots with a single compare-exchange.
+    // @return Number of slots written to _outSlots, 0 if the stack was empty.
+    size_t TryPopChain(uint32_t* _outSlots, size_t _maxCount)
+    {
+        uint64_t head = m_head.load(std::memory_order_acquire);
+        for (;;)
+        {
+            size_t count = 0;
+            uint32_t slot = GetSlot(head);
+            while (slot != EMPTY && count < _maxCount)
+            {
+                _outSlots[count++] = slot;
+                slot = GetNext(slot);
+            }
+
+            if (count == 0)
+            {
+                return 0;
+            }
+
+            // Every push and pop bumps the tag, so if it is unchanged the chain we just walked was
+            // not touched by anyone else in the meantime.
+            if (m_head.compare_exchange_weak(head, Pack(GetTag(head) + 1, slot), std::memory_order_acquire, std::memory_order_acquire))
+            {
+                m_size.fetch_sub((int64_t)count, std::memory_order_relaxed);
+                return count;
+            }
+        }
+    }
+
+    // @brief Detaches the whole stack in one step and returns its top slot (or EMPTY).
+    // Walk the returned chain with GetNext() until EMPTY. Meant for a single consumer.
+    uint32_t TakeAll()
+    {
+        uint64_t head = m_head.load(std::memory_order_acquire);
+        while (GetSlot(head) != EMPTY
+            && m_head.compare_exchange_weak(head, Pack(GetTag(head) + 1, EMPTY), std::memory_order_acquire, std::memory_order_acquire) == false)
+        {
+        }
+
+        uint32_t first = GetSlot(head);
+        int64_t takenCount = 0;
+        for (uint32_t slot = first; slot != EMPTY; slot = GetNext(slot))
+        {
+            ++takenCount;
+        }
+        m_size.fetch_sub(takenCount, std::memory_order_relaxed);
+        return first;
+    }
+
+    uint32_t GetNext(uint32_t _slot)
+    {
+        return std::atomic_ref<uint32_t>(m_next[_slot]).load(std::memory_order_relaxed);
+    }
+
+    // @brief Links _slot to _next. Only call this for slots the calling thread currently owns.
+    void SetNext(uint32_t _slot, uint32_t _next)
+    {
+        std::atomic_ref<uint32_t>(m_next[_slot]).store(_next, std::memory_order_relaxed);
+    }
+
+    // @brief Number of slots on the stack. Only exact when no other thread is pushing or popping.
+    size_t GetApproximateSize() const
+    {
+        int64_t size = m_size.load(std::memory_order_relaxed);
+        return (size > 0) ? (size_t)size : 0;
+    }
+
+
+private:
+    static uint64_t Pack(uint32_t _tag, uint32_t _slot) { return ((uint64_t)_tag << 32) | _slot; }
+    static uint32_t GetTag(uint64_t _head) { return (uint32_t)(_head >> 32); }
+    static uint32_t GetSlot(uint64_t _head) { return (uint32_t)_head; }
+
+    // Head and size are written by every push and pop, keep them away from anything else
+    alignas(64) std::atomic<uint64_t> m_head;
+    std::atomic<int64_t> m_size;
+    alignas(64) std::vector<uint32_t> m_next;
+};
+
+
+
+#endif  //  __LOCK_FREE_SLOT_STACK_H_
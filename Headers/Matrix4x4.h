@@ -0,0 +1,482 @@
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//             Matrix4x4 (h)
+//             Author: Christopher A
+//             Date: October 16, 2026
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//  Description:
+//
+//		A 4x4 float transform on the same conventions as Vector3: constexpr
+//      throughout, private storage, and SSE paths (under VECTOR3_ENABLE_SIMD)
+//      that give bit for bit the same floats as the plain float code.
+//
+//      - Column vectors: a point p is transformed as M * p, so A * B applies
+//        B first, then A. Storage is column major, one SSE register per
+//        column, which is also what GetData() hands to a GPU.
+//      - TransformPoint and TransformDirection treat the matrix as affine and
+//        do not divide by w.
+//      - TransformPoints / TransformDirections run a whole array through
+//        the widest of scalar, SSE2 and AVX2 the CPU has, in place if wanted,
+//        and match TransformPoint / TransformDirection bit for bit.
+//
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+
+#ifndef     __MATRIX4X4_H_
+#define     __MATRIX4X4_H_
+
+
+#include <cstddef>
+#include <iosfwd>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include "ConstexprMath.h"
+#include "Quaternion.h"
+#include "Vector3.h"
+
+#if VECTOR3_ENABLE_SIMD
+#include <emmintrin.h>
+#endif
+
+
+
+class Matrix4x4
+{
+public:
+    // @brief The identity matrix.
+    constexpr Matrix4x4();
+
+    // @brief The affine transform taking the x, y and z axes to _xAxis, _yAxis and _zAxis, then moving by _translation.
+    constexpr Matrix4x4(const Vector3& _xAxis, const Vector3& _yAxis, const Vector3& _zAxis, const Vector3& _translation);
+
+    // @brief From 16 floats in row major order, i.e. as the matrix is written out on paper.
+    static constexpr Matrix4x4 FromRows(const float (&_rows)[16]);
+
+    static constexpr Matrix4x4 Translation(const Vector3& _translation);
+    static constexpr Matrix4x4 Scale(const Vector3& _scale);
+
+    // @brief The rotation _rotation makes. _rotation must be unit length.
+    static constexpr Matrix4x4 Rotation(const Quaternion& _rotation);
+
+    // @brief Scale, then rotate, then translate, in one matrix. The same as Translation * Rotation * Scale,
+    // without the two multiplies.
+    static constexpr Matrix4x4 Compose(const Vector3& _translation, const Quaternion& _rotation, const Vector3& _scale);
+
+    constexpr float Get(size_t _row, size_t _column) const;
+    constexpr Matrix4x4& Set(size_t _row, size_t _column, float _value);
+
+    // @brief The 16 floats in column major order.
+    constexpr const float* GetData() const;
+
+    constexpr Matrix4x4 Transposed() const;
+    constexpr float Determinant() const;
+
+    // @brief Writes the inverse to _outInverse.
+    // @return false, leaving _outInverse alone, if the matrix is singular, i.e. |Determinant()| is below FLT_MIN.
+    constexpr bool Inverse(Matrix4x4& _outInverse) const;
+
+    // @brief M * (x, y, z, 1) without the divide by w.
+    constexpr Vector3 TransformPoint(const Vector3& _point) const;
+
+    // @brief M * (x, y, z, 0), i.e. without the translation. Normals need the inverse transpose instead
+    // wherever the matrix scales unevenly.
+    constexpr Vector3 TransformDirection(const Vector3& _direction) const;
+
+    // ~~~ Operators ~~~
+    constexpr Matrix4x4 operator * (const Matrix4x4& _other) const;
+    constexpr Matrix4x4& operator *= (const Matrix4x4& _other);
+    constexpr bool operator == (const Matrix4x4& _other) const;
+    constexpr bool operator != (const Matrix4x4& _other) const;
+
+
+private:
+    // @brief Every cofactor, transposed and laid out as columns, so the inverse is this times 1 / Determinant().
+    constexpr void GetAdjugate(float (&_outAdjugate)[4][4]) const;
+
+#if VECTOR3_ENABLE_SIMD
+    // Row Row of GetAdjugate's LEFT, RIGHT and KEY columns, a lane each
+    struct CofactorLanes
+    {
+        __m128 left;
+        __m128 right;
+        __m128 key;
+    };
+
+    template <int Row>
+    CofactorLanes GetCofactorLanes() const;
+
+    static Matrix4x4 FromRegisters(__m128 _c0, __m128 _c1, __m128 _c2, __m128 _c3);
+    __m128 ToRegister(size_t _column) const;
+#endif
+
+    // m_columns[column][row]
+    alignas(16) float m_columns[4][4];
+};
+
+
+
+constexpr Matrix4x4::Matrix4x4() :
+    m_columns{ { 1.0f, 0.0f, 0.0f, 0.0f }, { 0.0f, 1.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 1.0f, 0.0f }, { 0.0f, 0.0f, 0.0f, 1.0f } }
+{
+}
+
+constexpr Matrix4x4::Matrix4x4(const Vector3& _xAxis, const Vector3& _yAxis, const Vector3& _zAxis, const Vector3& _translation) :
+    m_columns{ { _xAxis.GetX(), _xAxis.GetY(), _xAxis.GetZ(), 0.0f },
+                { _yAxis.GetX(), _yAxis.GetY(), _yAxis.GetZ(), 0.0f },
+                { _zAxis.GetX(), _zAxis.GetY(), _zAxis.GetZ(), 0.0f },
+                { _translation.GetX(), _translation.GetY(), _translation.GetZ(), 1.0f } }
+{
+}
+
+constexpr Matrix4x4 Matrix4x4::FromRows(const float (&_rows)[16])
+{
+    Matrix4x4 result;
+    for (size_t row = 0; row < 4; ++row)
+    {
+        for (size_t column = 0; column < 4; ++column)
+        {
+            result.m_columns[column][row] = _rows[row * 4 + column];
+        }
+    }
+    return result;
+}
+
+constexpr Matrix4x4 Matrix4x4::Translation(const Vector3& _translation)
+{
+    return Matrix4x4(Vector3(1.0f, 0.0f, 0.0f), Vector3(0.0f, 1.0f, 0.0f), Vector3(0.0f, 0.0f, 1.0f), _translation);
+}
+
+constexpr Matrix4x4 Matrix4x4::Scale(const Vector3& _scale)
+{
+    return Matrix4x4(Vector3(_scale.GetX(), 0.0f, 0.0f), Vector3(0.0f, _scale.GetY(), 0.0f), Vector3(0.0f, 0.0f, _scale.GetZ()), Vector3());
+}
+
+constexpr Matrix4x4 Matrix4x4::Rotation(const Quaternion& _rotation)
+{
+    return Compose(Vector3(), _rotation, Vector3(1.0f, 1.0f, 1.0f));
+}
+
+constexpr Matrix4x4 Matrix4x4::Compose(const Vector3& _translation, const Quaternion& _rotation, const Vector3& _scale)
+{
+    float x = _rotation.GetX();
+    float y = _rotation.GetY();
+    float z = _rotation.GetZ();
+    float w = _rotation.GetW();
+    float xx = x * x, yy = y * y, zz = z * z;
+    float xy = x * y, xz = x * z, yz = y * z;
+    float wx = w * x, wy = w * y, wz = w * z;
+
+    Vector3 xAxis(1.0f - 2.0f * (yy + zz), 2.0f * (xy + wz), 2.0f * (xz - wy));
+    Vector3 yAxis(2.0f * (xy - wz), 1.0f - 2.0f * (xx + zz), 2.0f * (yz + wx));
+    Vector3 zAxis(2.0f * (xz + wy), 2.0f * (yz - wx), 1.0f - 2.0f * (xx + yy));
+    return Matrix4x4(xAxis * _scale.GetX(), yAxis * _scale.GetY(), zAxis * _scale.GetZ(), _translation);
+}
+
+
+constexpr float Matrix4x4::Get(size_t _row, size_t _column) const
+{
+    return m_columns[_column][_row];
+}
+
+constexpr Matrix4x4& Matrix4x4::Set(size_t _row, size_t _column, float _value)
+{
+    m_columns[_column][_row] = _value;
+    return *this;
+}
+
+constexpr const float* Matrix4x4::GetData() const
+{
+    return &m_columns[0][0];
+}
+
+constexpr Matrix4x4 Matrix4x4::Transposed() const
+{
+    Matrix4x4 result;
+    for (size_t column = 0; column < 4; ++column)
+    {
+        for (size_t row = 0; row < 4; ++row)
+        {
+            result.m_columns[column][row] = m_columns[row][column];
+        }
+    }
+    return result;
+}
+
+constexpr void Matrix4x4::GetAdjugate(float (&_outAdjugate)[4][4]) const
+{
+    // Lane by lane the SSE path in Inverse. Lane i of the 2x2 determinants pairs columns LEFT[i] and RIGHT[i],
+    // and lane i of each 3x3 cofactor expands along column KEY[i], so one set of 2x2s serves all four lanes.
+    const size_t LEFT[4] = { 2, 2, 1, 1 };
+    const size_t RIGHT[4] = { 3, 3, 3, 2 };
+    const size_t KEY[4] = { 1, 0, 0, 0 };
+    for (size_t lane = 0; lane < 4; ++lane)
+    {
+        const float* l = m_columns[LEFT[lane]];
+        const float* r = m_columns[RIGHT[lane]];
+        const float* k = m_columns[KEY[lane]];
+        float rows23 = l[2] * r[3] - r[2] * l[3];
+        float rows13 = l[1] * r[3] - r[1] * l[3];
+        float rows12 = l[1] * r[2] - r[1] * l[2];
+        float rows03 = l[0] * r[3] - r[0] * l[3];
+        float rows02 = l[0] * r[2] - r[0] * l[2];
+        float rows01 = l[0] * r[1] - r[0] * l[1];
+
+        float sign = (lane % 2 == 0) ? 1.0f : -1.0f;
+        _outAdjugate[0][lane] = (k[1] * rows23 - k[2] * rows13 + k[3] * rows12) * sign;
+        _outAdjugate[1][lane] = (k[0] * rows23 - k[2] * rows03 + k[3] * rows02) * -sign;
+        _outAdjugate[2][lane] = (k[0] * rows13 - k[1] * rows03 + k[3] * rows01) * sign;
+        _outAdjugate[3][lane] = (k[0] * rows12 - k[1] * rows02 + k[2] * rows01) * -sign;
+    }
+}
+
+constexpr float Matrix4x4::Determinant() const
+{
+    // Column 0 against the first row of the adjugate, added in pairs as Inverse's SSE path does
+    float adjugate[4][4] = {};
+    GetAdjugate(adjugate);
+    const float* c0 = m_columns[0];
+    return (c0[0] * adjugate[0][0] + c0[1] * adjugate[1][0]) + (c0[2] * adjugate[2][0] + c0[3] * adjugate[3][0]);
+}
+
+constexpr bool Matrix4x4::Inverse(Matrix4x4& _outInverse) const
+{
+#if VECTOR3_ENABLE_SIMD
+    if (std::is_constant_evaluated() == false)
+    {
+        CofactorLanes row0 = GetCofactorLanes<0>();
+        CofactorLanes row1 = GetCofactorLanes<1>();
+        CofactorLanes row2 = GetCofactorLanes<2>();
+        CofactorLanes row3 = GetCofactorLanes<3>();
+        auto twoByTwo = [](const CofactorLanes& _a, const CofactorLanes& _b) { return _mm_sub_ps(_mm_mul_ps(_a.left, _b.right), _mm_mul_ps(_a.right, _b.left)); };
+        __m128 rows23 = twoByTwo(row2, row3);
+        __m128 rows13 = twoByTwo(row1, row3);
+        __m128 rows12 = twoByTwo(row1, row2);
+        __m128 rows03 = twoByTwo(row0, row3);
+        __m128 rows02 = twoByTwo(row0, row2);
+        __m128 rows01 = twoByTwo(row0, row1);
+
+        auto cofactors = [](__m128 _k0, __m128 _pair0, __m128 _k1, __m128 _pair1, __m128 _k2, __m128 _pair2, __m128 _sign)
+        {
+            return _mm_mul_ps(_mm_add_ps(_mm_sub_ps(_mm_mul_ps(_k0, _pair0), _mm_mul_ps(_k1, _pair1)), _mm_mul_ps(_k2, _pair2)), _sign);
+        };
+        const __m128 evenSign = _mm_set_ps(-1.0f, 1.0f, -1.0f, 1.0f);
+        const __m128 oddSign = _mm_set_ps(1.0f, -1.0f, 1.0f, -1.0f);
+        __m128 adjugate0 = cofactors(row1.key, rows23, row2.key, rows13, row3.key, rows12, evenSign);
+        __m128 adjugate1 = cofactors(row0.key, rows23, row2.key, rows03, row3.key, rows02, oddSign);
+        __m128 adjugate2 = cofactors(row0.key, rows13, row1.key, rows03, row3.key, rows01, evenSign);
+        __m128 adjugate3 = cofactors(row0.key, rows12, row1.key, rows02, row2.key, rows01, oddSign);
+
+        // (p0 + p1) + (p2 + p3) over column 0 times the adjugate's first row, as in Determinant
+        __m128 firstRow = _mm_shuffle_ps(_mm_shuffle_ps(adjugate0, adjugate1, _MM_SHUFFLE(0, 0, 0, 0)),
+                                            _mm_shuffle_ps(adjugate2, adjugate3, _MM_SHUFFLE(0, 0, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+        __m128 products = _mm_mul_ps(ToRegister(0), firstRow);
+        __m128 pairs = _mm_add_ps(products, _mm_shuffle_ps(products, products, _MM_SHUFFLE(2, 3, 0, 1)));
+        float determinant = _mm_cvtss_f32(_mm_add_ss(pairs, _mm_movehl_ps(pairs, pairs)));
+        if ((ConstexprAbs(determinant) >= std::numeric_limits<float>::min()) == false)
+        {
+            return false;
+        }
+        __m128 reciprocal = _mm_set1_ps(1.0f / determinant);
+        _outInverse = FromRegisters(_mm_mul_ps(adjugate0, reciprocal), _mm_mul_ps(adjugate1, reciprocal),
+                                    _mm_mul_ps(adjugate2, reciprocal), _mm_mul_ps(adjugate3, reciprocal));
+        return true;
+    }
+#endif
+    float adjugate[4][4] = {};
+    GetAdjugate(adjugate);
+    const float* c0 = m_columns[0];
+    float determinant = (c0[0] * adjugate[0][0] + c0[1] * adjugate[1][0]) + (c0[2] * adjugate[2][0] + c0[3] * adjugate[3][0]);
+
+    // NaN fails the comparison too
+    if ((ConstexprAbs(determinant) >= std::numeric_limits<float>::min()) == false)
+    {
+        return false;
+    }
+    float reciprocal = 1.0f / determinant;
+    for (size_t column = 0; column < 4; ++column)
+    {
+        for (size_t row = 0; row < 4; ++row)
+        {
+            _outInverse.m_columns[column][row] = adjugate[column][row] * reciprocal;
+        }
+    }
+    return true;
+}
+
+constexpr Vector3 Matrix4x4::TransformPoint(const Vector3& _point) const
+{
+#if VECTOR3_ENABLE_SIMD
+    if (std::is_constant_evaluated() == false)
+    {
+        // ((c0 * x + c1 * y) + c2 * z) + c3, then w cleared back to the 0 Vector3 keeps there
+        __m128 point = _point.ToRegister();
+        __m128 sum = _mm_add_ps(_mm_mul_ps(ToRegister(0), _mm_shuffle_ps(point, point, _MM_SHUFFLE(0, 0, 0, 0))),
+                                _mm_mul_ps(ToRegister(1), _mm_shuffle_ps(point, point, _MM_SHUFFLE(1, 1, 1, 1))));
+        sum = _mm_add_ps(sum, _mm_mul_ps(ToRegister(2), _mm_shuffle_ps(point, point, _MM_SHUFFLE(2, 2, 2, 2))));
+        sum = _mm_add_ps(sum, ToRegister(3));
+        return Vector3::FromRegister(_mm_and_ps(sum, _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1))));
+    }
+#endif
+    float x = _point.GetX();
+    float y = _point.GetY();
+    float z = _point.GetZ();
+    return Vector3(m_columns[0][0] * x + m_columns[1][0] * y + m_columns[2][0] * z + m_columns[3][0],
+                    m_columns[0][1] * x + m_columns[1][1] * y + m_columns[2][1] * z + m_columns[3][1],
+                    m_columns[0][2] * x + m_columns[1][2] * y + m_columns[2][2] * z + m_columns[3][2]);
+}
+
+constexpr Vector3 Matrix4x4::TransformDirection(const Vector3& _direction) const
+{
+#if VECTOR3_ENABLE_SIMD
+    if (std::is_constant_evaluated() == false)
+    {
+        __m128 direction = _direction.ToRegister();
+        __m128 sum = _mm_add_ps(_mm_mul_ps(ToRegister(0), _mm_shuffle_ps(direction, direction, _MM_SHUFFLE(0, 0, 0, 0))),
+                                _mm_mul_ps(ToRegister(1), _mm_shuffle_ps(direction, direction, _MM_SHUFFLE(1, 1, 1, 1))));
+        sum = _mm_add_ps(sum, _mm_mul_ps(ToRegister(2), _mm_shuffle_ps(direction, direction, _MM_SHUFFLE(2, 2, 2, 2))));
+        return Vector3::FromRegister(_mm_and_ps(sum, _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1))));
+    }
+#endif
+    float x = _direction.GetX();
+    float y = _direction.GetY();
+    float z = _direction.GetZ();
+    return Vector3(m_columns[0][0] * x + m_columns[1][0] * y + m_columns[2][0] * z,
+                    m_columns[0][1] * x + m_columns[1][1] * y + m_columns[2][1] * z,
+                    m_columns[0][2] * x + m_columns[1][2] * y + m_columns[2][2] * z);
+}
+
+
+// ~~~ Operators ~~~
+constexpr Matrix4x4 Matrix4x4::operator * (const Matrix4x4& _other) const
+{
+#if VECTOR3_ENABLE_SIMD
+    if (std::is_constant_evaluated() == false)
+    {
+        // Column j is this matrix's columns weighted by _other's column j, summed in the scalar order
+        __m128 c0 = ToRegister(0);
+        __m128 c1 = ToRegister(1);
+        __m128 c2 = ToRegister(2);
+        __m128 c3 = ToRegister(3);
+        auto column = [&](size_t _column)
+        {
+            __m128 weights = _other.ToRegister(_column);
+            __m128 sum = _mm_add_ps(_mm_mul_ps(c0, _mm_shuffle_ps(weights, weights, _MM_SHUFFLE(0, 0, 0, 0))),
+                                    _mm_mul_ps(c1, _mm_shuffle_ps(weights, weights, _MM_SHUFFLE(1, 1, 1, 1))));
+            sum = _mm_add_ps(sum, _mm_mul_ps(c2, _mm_shuffle_ps(weights, weights, _MM_SHUFFLE(2, 2, 2, 2))));
+            return _mm_add_ps(sum, _mm_mul_ps(c3, _mm_shuffle_ps(weights, weights, _MM_SHUFFLE(3, 3, 3, 3))));
+        };
+        return FromRegisters(column(0), column(1), column(2), column(3));
+    }
+#endif
+    Matrix4x4 result;
+    for (size_t column = 0; column < 4; ++column)
+    {
+        const float* weights = _other.m_columns[column];
+        for (size_t row = 0; row < 4; ++row)
+        {
+            result.m_columns[column][row] = m_columns[0][row] * weights[0] + m_columns[1][row] * weights[1]
+                + m_columns[2][row] * weights[2] + m_columns[3][row] * weights[3];
+        }
+    }
+    return result;
+}
+
+constexpr Matrix4x4& Matrix4x4::operator *= (const Matrix4x4& _other)
+{
+    return *this = *this * _other;
+}
+
+constexpr bool Matrix4x4::operator == (const Matrix4x4& _other) const
+{
+    for (size_t column = 0; column < 4; ++column)
+    {
+        for (size_t row = 0; row < 4; ++row)
+        {
+            if ((ConstexprAbs(m_columns[column][row] - _other.m_columns[column][row]) < EPSILON) == false)
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+constexpr bool Matrix4x4::operator != (const Matrix4x4& _other) const
+{
+    return (*this == _other) == false;
+}
+
+
+#if VECTOR3_ENABLE_SIMD
+template <int Row>
+inline Matrix4x4::CofactorLanes Matrix4x4::GetCofactorLanes() const
+{
+    __m128 c0 = ToRegister(0);
+    __m128 c1 = ToRegister(1);
+    __m128 c2 = ToRegister(2);
+    __m128 c3 = ToRegister(3);
+    __m128 right = _mm_shuffle_ps(c3, c2, _MM_SHUFFLE(Row, Row, Row, Row));
+    __m128 key = _mm_shuffle_ps(c1, c0, _MM_SHUFFLE(Row, Row, Row, Row));
+    return { _mm_shuffle_ps(c2, c1, _MM_SHUFFLE(Row, Row, Row, Row)),
+                _mm_shuffle_ps(right, right, _MM_SHUFFLE(2, 0, 0, 0)),
+                _mm_shuffle_ps(key, key, _MM_SHUFFLE(2, 2, 2, 0)) };
+}
+
+inline Matrix4x4 Matrix4x4::FromRegisters(__m128 _c0, __m128 _c1, __m128 _c2, __m128 _c3)
+{
+    Matrix4x4 result;
+    _mm_store_ps(result.m_columns[0], _c0);
+    _mm_store_ps(result.m_columns[1], _c1);
+    _mm_store_ps(result.m_columns[2], _c2);
+    _mm_store_ps(result.m_columns[3], _c3);
+    return result;
+}
+
+inline __m128 Matrix4x4::ToRegister(size_t _column) const
+{
+    return _mm_load_ps(m_columns[_column]);
+}
+#endif
+
+
+
+// Stream insertion operator for printing Matrix4x4, one row per line
+std::ostream& operator << (std::ostream& _os, const Matrix4x4& _matrix);
+
+
+
+// ~~~ Batched transforms ~~~
+// Outputs may be the same array as the input. Each function transforms as many vectors as both spans hold.
+
+enum TransformKernelSet
+{
+    TRANSFORM_SCALAR_KERNELS    = 0,
+    TRANSFORM_SSE2_KERNELS      = 1,
+    TRANSFORM_AVX2_KERNELS      = 2,
+};
+
+
+// One instruction set's version of every kernel
+struct TransformKernels
+{
+    const char* name;
+    void (*transformPoints)(const Matrix4x4& _matrix, const Vector3* _in, Vector3* _out, size_t _count);
+    void (*transformDirections)(const Matrix4x4& _matrix, const Vector3* _in, Vector3* _out, size_t _count);
+};
+
+
+// @return The kernels for _set, or nullptr if this CPU or build does not have that instruction set.
+const TransformKernels* GetTransformKernels(TransformKernelSet _set);
+
+// The functions below use the widest kernels this CPU supports.
+
+// @brief _out[i] = _matrix.TransformPoint(_in[i])
+// @return Number of points written.
+size_t TransformPoints(const Matrix4x4& _matrix, std::span<const Vector3> _in, std::span<Vector3> _out);
+
+// @brief _out[i] = _matrix.TransformDirection(_in[i])
+// @return Number of directions written.
+size_t TransformDirections(const Matrix4x4& _matrix, std::span<const Vector3> _in, std::span<Vector3> _out);
+
+
+
+#endif  //  __MATRIX4X4_H_
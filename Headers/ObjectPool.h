@@ -0,0 +1,480 @@
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//             Object Pool (h)
+//             Author: Christopher A
+//             Date: October 16, 2026
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//  Description:
+//
+//		Generic version of the CoinObjectPool design, so projectiles, particles,
+//      damage numbers etc. don't each need their own hand written pool.
+//
+//      - All memory is allocated when the pool is created. Nothing is allocated
+//        after that, unless a runtime sized pool is explicitly told to Grow().
+//      - Objects live in raw aligned storage and are constructed in place by
+//        Spawn(args...), so T does not need a default constructor.
+//      - Free slots are kept on a stack, active slots in a densely packed list.
+//        Both Spawn and Release are O(1).
+//      - The capacity can either be given at runtime (ObjectPool<T>) or fixed at
+//        compile time (ObjectPool<T, 256>), in which case the storage lives
+//        inside the pool object itself.
+//      - Runtime sized pools keep their objects in power of two sized chunks.
+//        Growing adds chunks, so objects already in the pool never move.
+//
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+
+#ifndef     __OBJECT_POOL_H_
+#define     __OBJECT_POOL_H_
+
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <span>
+#include <utility>
+#include <vector>
+
+
+
+// @brief Backing memory for an ObjectPool with a compile-time capacity.
+template <typename T, size_t Capacity>
+class ObjectPoolStorage
+{
+public:
+    explicit ObjectPoolStorage(size_t /*_capacity*/) { }
+
+    size_t GetCapacity() const { return Capacity; }
+    uint32_t* GetFreeSlots() { return m_freeSlots; }
+    uint32_t* GetActiveSlots() { return m_activeSlots; }
+    int32_t* GetActiveIndexOfSlots() { return m_activeIndexOfSlots; }
+
+    unsigned char* GetSlotAddress(uint32_t _slot) const
+    {
+        return m_objectBytes + sizeof(T) * _slot;
+    }
+
+    // @brief Number of slots from _slot onwards that sit next to each other in memory.
+    size_t GetContiguousSlotCount(uint32_t _slot) const
+    {
+        return Capacity - _slot;
+    }
+
+    bool TryGetSlotIndex(const unsigned char* _objectBytes, uint32_t& _outSlot) const
+    {
+        if (_objectBytes < m_objectBytes || _objectBytes >= m_objectBytes + sizeof(T) * Capacity)
+        {
+            return false;
+        }
+
+        size_t byteOffset = (size_t)(_objectBytes - m_objectBytes);
+        if (byteOffset % sizeof(T) != 0)
+        {
+            return false;
+        }
+
+        _outSlot = (uint32_t)(byteOffset / sizeof(T));
+        return true;
+    }
+
+private:
+    // Mutable because a const pool still hands out non-const objects, the same as the runtime layout
+    alignas(T) mutable unsigned char m_objectBytes[sizeof(T) * Capacity];
+    uint32_t m_freeSlots[Capacity];
+    uint32_t m_activeSlots[Capacity];
+    int32_t m_activeIndexOfSlots[Capacity];
+};
+
+
+// @brief Backing memory for an ObjectPool whose capacity is chosen at runtime.
+// Objects live in chunks of a power of two slot count, the first power of two that fits the starting
+// capacity. A slot's address is then a shift, a mask and one lookup in the small chunk table.
+template <typename T>
+class ObjectPoolStorage<T, 0>
+{
+public:
+    explicit ObjectPoolStorage(size_t _capacity)
+        : m_capacity(0),
+          m_chunkShift(0)
+    {
+        while (((size_t)1 << m_chunkShift) < _capacity)
+        {
+            ++m_chunkShift;
+        }
+        m_chunkMask = ((size_t)1 << m_chunkShift) - 1;
+        Grow(_capacity);
+    }
+
+    ~ObjectPoolStorage()
+    {
+        for (unsigned char* chunk : m_chunks)
+        {
+            ::operator delete(chunk, std::align_val_t(alignof(T)));
+        }
+    }
+
+    ObjectPoolStorage(const ObjectPoolStorage&) = delete;
+    ObjectPoolStorage& operator = (const ObjectPoolStorage&) = delete;
+
+    size_t GetCapacity() const { return m_capacity; }
+    uint32_t* GetFreeSlots() { return m_freeSlots.data(); }
+    uint32_t* GetActiveSlots() { return m_activeSlots.data(); }
+    int32_t* GetActiveIndexOfSlots() { return m_activeIndexOfSlots.data(); }
+
+    unsigned char* GetSlotAddress(uint32_t _slot) const
+    {
+        return m_chunks[_slot >> m_chunkShift] + sizeof(T) * (_slot & m_chunkMask);
+    }
+
+    // @brief Number of slots from _slot onwards that sit next to each other in memory.
+    size_t GetContiguousSlotCount(uint32_t _slot) const
+    {
+        return (m_chunkMask + 1) - (_slot & m_chunkMask);
+    }
+
+    bool TryGetSlotIndex(const unsigned char* _objectBytes, uint32_t& _outSlot) const
+    {
+        const size_t chunkSlotCount = m_chunkMask + 1;
+        for (size_t chunkIndex = 0; chunkIndex < m_chunks.size(); ++chunkIndex)
+        {
+            const unsigned char* chunkBegin = m_chunks[chunkIndex];
+            if (_objectBytes < chunkBegin || _objectBytes >= chunkBegin + sizeof(T) * chunkSlotCount)
+            {
+                continue;
+            }
+
+            size_t byteOffset = (size_t)(_objectBytes - chunkBegin);
+            size_t slot = (chunkIndex << m_chunkShift) + byteOffset / sizeof(T);
+            if (byteOffset % sizeof(T) != 0 || slot >= m_capacity)
+            {
+                return false;
+            }
+
+            _outSlot = (uint32_t)slot;
+            return true;
+        }
+        return false;
+    }
+
+    // @brief Adds _additionalCapacity slots. New chunks are allocated only once the last one is full.
+    // The slot bookkeeping arrays may reallocate, so views into them must be fetched again.
+    void Grow(size_t _additionalCapacity)
+    {
+        m_capacity += _additionalCapacity;
+        while ((m_chunks.size() << m_chunkShift) < m_capacity)
+        {
+            m_chunks.push_back(static_cast<unsigned char*>(::operator new(sizeof(T) << m_chunkShift, std::align_val_t(alignof(T)))));
+        }
+
+        m_freeSlots.resize(m_capacity);
+        m_activeSlots.resize(m_capacity);
+        m_activeIndexOfSlots.resize(m_capacity, -1);
+    }
+
+private:
+    size_t m_capacity;
+    size_t m_chunkShift;
+    size_t m_chunkMask;
+    std::vector<unsigned char*> m_chunks;
+    std::vector<uint32_t> m_freeSlots;
+    std::vector<uint32_t> m_activeSlots;
+    std::vector<int32_t> m_activeIndexOfSlots;
+};
+
+
+
+template <typename T, size_t Capacity = 0>
+class ObjectPool
+{
+public:
+
+    // @brief Pre-allocates every slot in the pool.
+    // @param _capacity Number of objects for runtime sized pools. Ignored when Capacity is set at compile time.
+    explicit ObjectPool(size_t _capacity = Capacity)
+        : m_storage(_capacity),
+          m_freeSlots(m_storage.GetFreeSlots()),
+          m_activeSlots(m_storage.GetActiveSlots()),
+          m_activeIndexOfSlots(m_storage.GetActiveIndexOfSlots()),
+          m_freeCount(0),
+          m_activeCount(0)
+    {
+        PushNewFreeSlots(0, m_storage.GetCapacity());
+    }
+
+    ~ObjectPool()
+    {
+        // Objects still alive when the pool dies need their destructors run
+        for (size_t i = 0; i < m_activeCount; ++i)
+        {
+            GetSlot(m_activeSlots[i])->~T();
+        }
+    }
+
+    // Objects point into the pool's storage, so the pool cannot be copied.
+    ObjectPool(const ObjectPool&) = delete;
+    ObjectPool& operator = (const ObjectPool&) = delete;
+
+    // @brief Adds _additionalCapacity free slots to a runtime sized pool. Existing objects do not move,
+    // so pointers to them stay valid. Allocates, so call it at a point where that is acceptable.
+    void Grow(size_t _additionalCapacity) requires (Capacity == 0)
+    {
+        size_t oldCapacity = GetCapacity();
+        m_storage.Grow(_additionalCapacity);
+        m_freeSlots = m_storage.GetFreeSlots();
+        m_activeSlots = m_storage.GetActiveSlots();
+        m_activeIndexOfSlots = m_storage.GetActiveIndexOfSlots();
+        PushNewFreeSlots(oldCapacity, GetCapacity());
+    }
+
+
+    // @brief Constructs a new object in a free slot, forwarding _args to T's constructor.
+    // @return A pointer to the new object, or nullptr if the pool is exhausted.
+    template <typename... Args>
+    T* Spawn(Args&&... _args)
+    {
+        uint32_t slot = 0;
+        if (TryAcquireSlot(slot) == false)
+        {
+            return nullptr;
+        }
+
+        T* object = ConstructInSlot(slot, std::forward<Args>(_args)...);
+        ActivateSlot(slot);
+        return object;
+    }
+
+    // @brief Destroys an active object and returns its slot to the free stack in O(1).
+    // @return false if _object is not an active object of this pool.
+    bool Release(T* _object)
+    {
+        uint32_t slot = 0;
+        if (TryGetSlotIndex(_object, slot) == false || IsSlotActive(slot) == false)
+        {
+            return false;
+        }
+
+        DeactivateSlot(slot);
+        DestroyInSlot(slot);
+        ReturnSlot(slot);
+        return true;
+    }
+
+
+    // ~~~ Slot Level API ~~~
+    // Spawn() and Release() are made out of these steps. They are public for owners that need to
+    // split them up, e.g. construct objects on worker threads and register them as active later.
+    // An acquired slot must eventually be handed back with ReturnSlot().
+
+    // @brief Pops a free slot without constructing anything in it.
+    bool TryAcquireSlot(uint32_t& _outSlot)
+    {
+        if (m_freeCount == 0)
+        {
+            return false;
+        }
+
+        _outSlot = m_freeSlots[--m_freeCount];
+        return true;
+    }
+
+    // @brief Pops up to _count free slots in one step.
+    // @return The acquired slots. The view points into the free stack, so use it before
+    //         anything is returned to the pool.
+    std::span<const uint32_t> AcquireSlots(size_t _count)
+    {
+        if (_count > m_freeCount)
+        {
+            _count = m_freeCount;
+        }
+
+        m_freeCount -= _count;
+        return std::span<const uint32_t>(m_freeSlots + m_freeCount, _count);
+    }
+
+    template <typename... Args>
+    T* ConstructInSlot(uint32_t _slot, Args&&... _args)
+    {
+        return new (GetSlotAddress(_slot)) T(std::forward<Args>(_args)...);
+    }
+
+    // @brief Appends a constructed slot to the active list.
+    void ActivateSlot(uint32_t _slot)
+    {
+        m_activeIndexOfSlots[_slot] = (int32_t)m_activeCount;
+        m_activeSlots[m_activeCount++] = _slot;
+    }
+
+    // @brief Appends several constructed slots to the active list in one go.
+    void ActivateSlots(std::span<const uint32_t> _slots)
+    {
+        std::copy(_slots.begin(), _slots.end(), m_activeSlots + m_activeCount);
+        for (size_t i = 0; i < _slots.size(); ++i)
+        {
+            m_activeIndexOfSlots[_slots[i]] = (int32_t)(m_activeCount + i);
+        }
+        m_activeCount += _slots.size();
+    }
+
+    // @brief Removes a slot from the active list in O(1). The object in it stays alive.
+    void DeactivateSlot(uint32_t _slot)
+    {
+        // Swap the last active slot into the hole. Order of the active list does not matter.
+        int32_t activeIndex = m_activeIndexOfSlots[_slot];
+        uint32_t lastSlot = m_activeSlots[--m_activeCount];
+        m_activeSlots[activeIndex] = lastSlot;
+        m_activeIndexOfSlots[lastSlot] = activeIndex;
+        m_activeIndexOfSlots[_slot] = -1;
+    }
+
+    void DestroyInSlot(uint32_t _slot)
+    {
+        GetSlot(_slot)->~T();
+    }
+
+    // @brief Pushes an acquired, empty slot back onto the free stack.
+    void ReturnSlot(uint32_t _slot)
+    {
+        m_freeSlots[m_freeCount++] = _slot;
+    }
+
+    // @brief Pushes several acquired, empty slots back onto the free stack in one go.
+    void ReturnSlots(std::span<const uint32_t> _slots)
+    {
+        std::copy(_slots.begin(), _slots.end(), m_freeSlots + m_freeCount);
+        m_freeCount += _slots.size();
+    }
+
+
+    // @brief True if _object points at a live object owned by this pool.
+    bool IsActive(const T* _object) const
+    {
+        uint32_t slot = 0;
+        return TryGetSlotIndex(_object, slot) && IsSlotActive(slot);
+    }
+
+    bool IsSlotActive(uint32_t _slot) const
+    {
+        return _slot < GetCapacity() && m_activeIndexOfSlots[_slot] >= 0;
+    }
+
+    // @brief Active objects are densely packed. Valid indices are [0, GetActiveCount()).
+    T* GetActive(size_t _activeIndex) const
+    {
+        return GetSlot(m_activeSlots[_activeIndex]);
+    }
+
+    // @brief Slot stored at _activeIndex of the active list.
+    uint32_t GetActiveSlot(size_t _activeIndex) const
+    {
+        return m_activeSlots[_activeIndex];
+    }
+
+    // @brief Position of _slot in the active list, or -1 if the slot is not active.
+    int32_t GetActiveIndex(uint32_t _slot) const
+    {
+        return m_activeIndexOfSlots[_slot];
+    }
+
+    // @brief Maps an object pointer back to its slot index. Fails for pointers this pool does not own.
+    bool TryGetSlotIndex(const T* _object, uint32_t& _outSlot) const
+    {
+        return m_storage.TryGetSlotIndex(reinterpret_cast<const unsigned char*>(_object), _outSlot);
+    }
+
+    // @brief The object living in _slot. Only valid while the slot is active.
+    T* GetSlot(uint32_t _slot) const
+    {
+        return std::launder(reinterpret_cast<T*>(GetSlotAddress(_slot)));
+    }
+
+    size_t GetActiveCount() const { return m_activeCount; }
+    size_t GetFreeCount() const { return m_freeCount; }
+    size_t GetCapacity() const { return m_storage.GetCapacity(); }
+
+
+    // ~~~ Snapshot Support ~~~
+    // Raw access for owners that save and restore the whole pool, e.g. for rollback netcode.
+    // Only usable when T can be copied byte by byte and overwritten without running its destructor.
+
+    // @brief Copies the bytes of slots [_firstSlot, _firstSlot + _count) out, whether they hold an object or not.
+    void CopySlotBytesOut(uint32_t _firstSlot, size_t _count, void* _destination) const
+    {
+        unsigned char* destination = static_cast<unsigned char*>(_destination);
+        while (_count > 0)
+        {
+            size_t runCount = std::min(_count, m_storage.GetContiguousSlotCount(_firstSlot));
+            std::memcpy(destination, GetSlotAddress(_firstSlot), sizeof(T) * runCount);
+            destination += sizeof(T) * runCount;
+            _firstSlot += (uint32_t)runCount;
+            _count -= runCount;
+        }
+    }
+
+    // @brief Overwrites the bytes of slots [_firstSlot, _firstSlot + _count) with ones from CopySlotBytesOut.
+    void CopySlotBytesIn(uint32_t _firstSlot, size_t _count, const void* _source)
+    {
+        const unsigned char* source = static_cast<const unsigned char*>(_source);
+        while (_count > 0)
+        {
+            size_t runCount = std::min(_count, m_storage.GetContiguousSlotCount(_firstSlot));
+            std::memcpy(GetSlotAddress(_firstSlot), source, sizeof(T) * runCount);
+            source += sizeof(T) * runCount;
+            _firstSlot += (uint32_t)runCount;
+            _count -= runCount;
+        }
+    }
+
+    std::span<const uint32_t> GetFreeSlots() const { return std::span<const uint32_t>(m_freeSlots, m_freeCount); }
+    std::span<const uint32_t> GetActiveSlots() const { return std::span<const uint32_t>(m_activeSlots, m_activeCount); }
+
+    // @brief Replaces the free and active lists with raw copies of GetFreeSlots() and GetActiveSlots() saved
+    // earlier. Between them they must hold every slot exactly once, and the slot bytes must already match.
+    // The slot to active index map is rebuilt from them.
+    void RestoreSlotLists(const void* _freeSlotBytes, size_t _freeCount, const void* _activeSlotBytes, size_t _activeCount)
+    {
+        std::memcpy(m_freeSlots, _freeSlotBytes, sizeof(uint32_t) * _freeCount);
+        m_freeCount = _freeCount;
+        for (size_t i = 0; i < m_freeCount; ++i)
+        {
+            m_activeIndexOfSlots[m_freeSlots[i]] = -1;
+        }
+
+        std::memcpy(m_activeSlots, _activeSlotBytes, sizeof(uint32_t) * _activeCount);
+        m_activeCount = _activeCount;
+        for (size_t i = 0; i < m_activeCount; ++i)
+        {
+            m_activeIndexOfSlots[m_activeSlots[i]] = (int32_t)i;
+        }
+    }
+
+
+private:
+    unsigned char* GetSlotAddress(uint32_t _slot) const
+    {
+        return m_storage.GetSlotAddress(_slot);
+    }
+
+    // @brief Puts the slots [_begin, _end) on the free stack so that the lowest of them is handed out first.
+    void PushNewFreeSlots(size_t _begin, size_t _end)
+    {
+        for (size_t slot = _end; slot > _begin; --slot)
+        {
+            m_freeSlots[m_freeCount++] = (uint32_t)(slot - 1);
+            m_activeIndexOfSlots[slot - 1] = -1;
+        }
+    }
+
+    ObjectPoolStorage<T, Capacity> m_storage;
+
+    // Cached views into m_storage, shared by the fixed and runtime capacity layouts
+    uint32_t* m_freeSlots;
+    uint32_t* m_activeSlots;
+    int32_t* m_activeIndexOfSlots;
+
+    size_t m_freeCount;
+    size_t m_activeCount;
+};
+
+
+
+#endif  //  __OBJECT_POOL_H_
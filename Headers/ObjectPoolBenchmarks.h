@@ -0,0 +1,27 @@
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//             Object Pool Benchmarks (h)
+//             Author: Christopher A
+//             Date: October 16, 2026
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//  Description:
+//
+//		Micro benchmarks for the generic ObjectPool. Run with `CppTests --bench`.
+//      Results are written to std::cout.
+//
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+
+#ifndef     __OBJECT_POOL_BENCHMARKS_H_
+#define     __OBJECT_POOL_BENCHMARKS_H_
+
+
+
+// @brief Keeps 10,000 projectiles alive and replaces random ones, comparing ObjectPool
+// (runtime and compile-time capacity) against new/delete and a swap-and-pop std::vector.
+void RunObjectPoolChurnBenchmark();
+
+// @brief Runs every ObjectPool benchmark in turn.
+void RunObjectPoolBenchmarks();
+
+
+
+#endif  //  __OBJECT_POOL_BENCHMARKS_H_
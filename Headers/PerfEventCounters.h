@@ -0,0 +1,67 @@
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//             Perf Event Counters (h)
+//             Author: Christopher A
+//             Date: October 16, 2026
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//  Description:
+//
+//		Hardware cache miss counters for the benchmarks, read through Linux's
+//      perf_event_open. Counts only this thread in user space.
+//
+//      On other platforms, or where the kernel does not allow it (containers,
+//      perf_event_paranoid, virtual machines without a PMU), the counters are
+//      simply unavailable and the benchmarks report them as n/a.
+//
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+
+#ifndef     __PERF_EVENT_COUNTERS_H_
+#define     __PERF_EVENT_COUNTERS_H_
+
+
+#include <cstdint>
+
+
+
+enum PerfCounter
+{
+    // Misses in the last level cache, i.e. trips out to memory
+    PERF_COUNTER_CACHE_MISSES       = 0,
+
+    // Loads that missed the L1 data cache
+    PERF_COUNTER_L1D_READ_MISSES    = 1,
+
+    PERF_COUNTER_COUNT              = 2,
+};
+
+
+
+class PerfEventCounters
+{
+public:
+    // @brief Opens every counter the platform allows. Counting only begins at Start().
+    PerfEventCounters();
+    ~PerfEventCounters();
+
+    // The counters own file descriptors, so they cannot be copied.
+    PerfEventCounters(const PerfEventCounters&) = delete;
+    PerfEventCounters& operator = (const PerfEventCounters&) = delete;
+
+    bool IsAvailable(PerfCounter _counter) const;
+
+    // @brief Zeroes and starts every available counter.
+    void Start();
+
+    // @brief Stops the counters and reads them, for GetCount().
+    void Stop();
+
+    // @brief Events counted between the last Start() and Stop(). 0 if the counter is unavailable.
+    uint64_t GetCount(PerfCounter _counter) const;
+
+private:
+    int m_fileDescriptors[PERF_COUNTER_COUNT];
+    uint64_t m_counts[PERF_COUNTER_COUNT];
+};
+
+
+
+#endif  //  __PERF_EVENT_COUNTERS_H_
@@ -0,0 +1,172 @@
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//             Pool Snapshot (h)
+//             Author: Christopher A
+//             Date: October 16, 2026
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//  Description:
+//
+//		Building blocks for capturing pool state into caller provided buffers,
+//      used by the CoinObjectPool's snapshots for rollback netcode.
+//
+//      - SnapshotWriter / SnapshotReader walk a byte buffer. Every array goes
+//        across as one memcpy, and running off the end of the buffer is
+//        detected rather than written past.
+//      - DirtyBlockSet remembers which blocks of 16 slots changed since it was
+//        last cleared, so delta snapshots only copy those blocks.
+//
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+
+#ifndef     __POOL_SNAPSHOT_H_
+#define     __POOL_SNAPSHOT_H_
+
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <vector>
+
+
+
+class SnapshotWriter
+{
+public:
+    explicit SnapshotWriter(std::span<std::byte> _buffer) : m_buffer(_buffer), m_size(0), m_hasOverflowed(false) { }
+
+    // @brief Claims the next _byteCount bytes of the buffer for the caller to fill in.
+    // @return nullptr once the buffer is too small. Every later call then fails as well.
+    std::byte* Reserve(size_t _byteCount)
+    {
+        if (m_hasOverflowed || _byteCount > m_buffer.size() - m_size)
+        {
+            m_hasOverflowed = true;
+            return nullptr;
+        }
+
+        std::byte* destination = m_buffer.data() + m_size;
+        m_size += _byteCount;
+        return destination;
+    }
+
+    void Write(const void* _source, size_t _byteCount)
+    {
+        std::byte* destination = Reserve(_byteCount);
+        if (destination != nullptr && _byteCount > 0)
+        {
+            std::memcpy(destination, _source, _byteCount);
+        }
+    }
+
+    template <typename T>
+    void WriteValue(const T& _value) { Write(&_value, sizeof(T)); }
+
+    size_t GetSize() const { return m_size; }
+    bool HasOverflowed() const { return m_hasOverflowed; }
+
+private:
+    std::span<std::byte> m_buffer;
+    size_t m_size;
+    bool m_hasOverflowed;
+};
+
+
+
+class SnapshotReader
+{
+public:
+    explicit SnapshotReader(std::span<const std::byte> _buffer) : m_buffer(_buffer), m_size(0), m_hasOverflowed(false) { }
+
+    // @brief Steps over the next _byteCount bytes and returns where they start.
+    // @return nullptr once the buffer runs out. Every later call then fails as well.
+    const std::byte* Take(size_t _byteCount)
+    {
+        if (m_hasOverflowed || _byteCount > m_buffer.size() - m_size)
+        {
+            m_hasOverflowed = true;
+            return nullptr;
+        }
+
+        const std::byte* source = m_buffer.data() + m_size;
+        m_size += _byteCount;
+        return source;
+    }
+
+    void Read(void* _destination, size_t _byteCount)
+    {
+        const std::byte* source = Take(_byteCount);
+        if (source != nullptr && _byteCount > 0)
+        {
+            std::memcpy(_destination, source, _byteCount);
+        }
+    }
+
+    template <typename T>
+    T ReadValue() { T value{}; Read(&value, sizeof(T)); return value; }
+
+    size_t GetSize() const { return m_size; }
+    bool HasOverflowed() const { return m_hasOverflowed; }
+
+private:
+    std::span<const std::byte> m_buffer;
+    size_t m_size;
+    bool m_hasOverflowed;
+};
+
+
+
+// @brief One bit per block of BLOCK_SIZE slots, set when anything in the block changes.
+class DirtyBlockSet
+{
+public:
+    static const uint32_t BLOCK_SHIFT   = 4;
+    static const uint32_t BLOCK_SIZE    = 1u << BLOCK_SHIFT;
+
+    explicit DirtyBlockSet(size_t _slotCount = 0) { Resize(_slotCount); }
+
+    static size_t GetBlockCount(size_t _slotCount) { return (_slotCount + BLOCK_SIZE - 1) >> BLOCK_SHIFT; }
+
+    // @brief Makes room for _slotCount slots. Blocks that are already marked stay marked.
+    void Resize(size_t _slotCount) { m_words.resize((GetBlockCount(_slotCount) + 63) / 64, 0); }
+
+    void Mark(uint32_t _slot)
+    {
+        uint32_t block = _slot >> BLOCK_SHIFT;
+        m_words[block >> 6] |= (uint64_t)1 << (block & 63);
+    }
+
+    void Clear() { std::fill(m_words.begin(), m_words.end(), 0); }
+
+    size_t GetMarkedBlockCount() const
+    {
+        size_t count = 0;
+        for (uint64_t word : m_words)
+        {
+            count += (size_t)std::popcount(word);
+        }
+        return count;
+    }
+
+    // @brief Calls _visitor(block) for every marked block, lowest first.
+    template <typename Visitor>
+    void ForEachMarkedBlock(Visitor&& _visitor) const
+    {
+        for (size_t wordIndex = 0; wordIndex < m_words.size(); ++wordIndex)
+        {
+            uint64_t word = m_words[wordIndex];
+            while (word != 0)
+            {
+                _visitor((uint32_t)(wordIndex * 64 + (size_t)std::countr_zero(word)));
+                word &= word - 1;
+            }
+        }
+    }
+
+private:
+    std::vector<uint64_t> m_words;
+};
+
+
+
+#endif  //  __POOL_SNAPSHOT_H_
@@ -0,0 +1,323 @@
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//             Quantized Vector (h)
+//             Author: Christopher A
+//             Date: October 16, 2026
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//  Description:
+//
+//		Compact storage for large arrays of Vector<N, float>, e.g. vertex
+//      streams or network state, at half or a quarter of the bytes.
+//
+//      - Vector<N, Half>: IEEE 754 half precision, 11 significant bits, up to
+//        65504. Half is storage only; convert to Vector<N, float> for maths.
+//      - Vector<N, int16_t> with a VectorQuantization: each component is
+//        offset + q * scale for q in [-32767, 32767], so values in a known
+//        range keep 16 bits of precision spread evenly over it.
+//      - The batch kernels convert whole arrays with F16C / AVX2 or SSE2 where
+//        the CPU has them. Every kernel set gives the same bits as the inline
+//        single vector conversions, which round to nearest even like F16C.
+//
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+
+#ifndef     __QUANTIZED_VECTOR_H_
+#define     __QUANTIZED_VECTOR_H_
+
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include "GenericVectorTemplate.h"
+
+
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//              Half
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// @brief float to IEEE half bits, rounded to nearest even. Too large gives infinity, NaN stays a (quiet) NaN.
+constexpr uint16_t FloatToHalfBits(float _value)
+{
+    uint32_t bits = std::bit_cast<uint32_t>(_value);
+    uint32_t sign = (bits >> 16) & 0x8000u;
+    uint32_t magnitude = bits & 0x7FFFFFFFu;
+
+    if (magnitude > 0x7F800000u)
+    {
+        // NaN: quiet, keeping the top of the payload, as vcvtps2ph does
+        return (uint16_t)(sign | 0x7E00u | ((magnitude >> 13) & 0x03FFu));
+    }
+    if (magnitude >= 0x47800000u)
+    {
+        // 65536 and up, and infinity. 65520 to 65536 round up to infinity below.
+        return (uint16_t)(sign | 0x7C00u);
+    }
+
+    uint32_t exponent = magnitude >> 23;
+    if (exponent < 113)
+    {
+        // Below 2^-14: a half subnormal, in units of 2^-24
+        if (exponent < 102)
+        {
+            return (uint16_t)sign;
+        }
+        uint32_t mantissa = (magnitude & 0x007FFFFFu) | 0x00800000u;
+        uint32_t shift = 126 - exponent;
+        uint32_t roundUp = (1u << (shift - 1)) - 1 + ((mantissa >> shift) & 1u);
+        return (uint16_t)(sign | ((mantissa + roundUp) >> shift));
+    }
+
+    // Rebias the exponent from 127 to 15 and drop 13 mantissa bits, rounding to nearest even by adding
+    // just under half, plus the bit that is kept, so there is no branch. A carry out of the mantissa
+    // correctly bumps the exponent, up to infinity.
+    uint32_t rebiased = magnitude - (112u << 23);
+    uint32_t roundUp = 0x0FFFu + ((rebiased >> 13) & 1u);
+    return (uint16_t)(sign | ((rebiased + roundUp) >> 13));
+}
+
+// @brief IEEE half bits to float. Exact, as every half is a float.
+constexpr float HalfBitsToFloat(uint16_t _bits)
+{
+    uint32_t sign = (uint32_t)(_bits & 0x8000u) << 16;
+    uint32_t exponent = (_bits >> 10) & 0x1Fu;
+    uint32_t mantissa = _bits & 0x03FFu;
+
+    if (exponent == 0x1Fu)
+    {
+        // Infinity, or NaN with its payload, made quiet as vcvtph2ps does
+        uint32_t quiet = (mantissa != 0) ? 0x00400000u : 0u;
+        return std::bit_cast<float>(sign | 0x7F800000u | quiet | (mantissa << 13));
+    }
+    if (exponent == 0)
+    {
+        // Zero or subnormal: mantissa * 2^-24
+        float magnitude = (float)mantissa * (1.0f / 16777216.0f);
+        return std::bit_cast<float>(sign | std::bit_cast<uint32_t>(magnitude));
+    }
+    return std::bit_cast<float>(sign | ((exponent + 112u) << 23) | (mantissa << 13));
+}
+
+
+// IEEE 754 half precision float, for storage. Converts explicitly to and from float and has no arithmetic.
+class Half
+{
+public:
+    constexpr Half() = default;
+    constexpr explicit Half(float _value)
+        : m_bits(FloatToHalfBits(_value))
+    {
+    }
+
+    constexpr explicit operator float() const
+    {
+        return HalfBitsToFloat(m_bits);
+    }
+
+    constexpr uint16_t GetBits() const
+    {
+        return m_bits;
+    }
+
+    static constexpr Half FromBits(uint16_t _bits)
+    {
+        Half half;
+        half.m_bits = _bits;
+        return half;
+    }
+
+    // Compares bits, so 0 != -0 and a NaN equals itself
+    constexpr bool operator == (const Half& _other) const = default;
+
+private:
+    uint16_t m_bits = 0;
+};
+
+static_assert(sizeof(Half) == 2, "Half must be 2 bytes to be converted in place by the kernels");
+
+
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//              Normalised int16_t
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+static const int16_t QUANTIZED_COMPONENT_MAX = 32767;
+
+// value = offset + q * scale
+struct VectorQuantization
+{
+    float scale;
+    float offset;
+
+    // 1 / scale, so encoding is a multiply
+    float inverseScale;
+
+    // @brief Spreads [_min, _max] over the whole int16_t range, -32767 to 32767.
+    static constexpr VectorQuantization ForRange(float _min, float _max)
+    {
+        float scale = (_max - _min) * 0.5f / (float)QUANTIZED_COMPONENT_MAX;
+        return { scale, (_min + _max) * 0.5f, 1.0f / scale };
+    }
+
+    // @brief The largest error Dequantize(Quantize(x)) has for x in range: half a step, plus float rounding.
+    constexpr float GetMaxError() const
+    {
+        float magnitude = ConstexprAbs(offset) + scale * (float)QUANTIZED_COMPONENT_MAX;
+        return scale * 0.5f + magnitude * 4.0f * std::numeric_limits<float>::epsilon();
+    }
+};
+
+
+// @brief round((_value - offset) / scale), clamped to [-32767, 32767], rounding halves to even as cvtps2dq
+// does. NaN quantizes to -32767.
+constexpr int16_t QuantizeComponent(float _value, const VectorQuantization& _quantization)
+{
+    float scaled = (_value - _quantization.offset) * _quantization.inverseScale;
+
+    // In the same order as maxps / minps, which is also what sends NaN to the low end
+    scaled = (scaled > -(float)QUANTIZED_COMPONENT_MAX) ? scaled : -(float)QUANTIZED_COMPONENT_MAX;
+    scaled = (scaled < (float)QUANTIZED_COMPONENT_MAX) ? scaled : (float)QUANTIZED_COMPONENT_MAX;
+
+    // Round half to even without touching the rounding mode: adding 1.5 * 2^23 leaves no fraction bits
+    // in the float, for any |scaled| < 2^22
+    const float roundingBias = 12582912.0f;
+    return (int16_t)((scaled + roundingBias) - roundingBias);
+}
+
+constexpr float DequantizeComponent(int16_t _value, const VectorQuantization& _quantization)
+{
+    return (float)_value * _quantization.scale + _quantization.offset;
+}
+
+
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//              Single Vectors
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+template <int N>
+constexpr Vector<N, Half> ToHalfVector(const Vector<N, float>& _vector)
+{
+    Vector<N, Half> result;
+    for (int i = 0; i < N; ++i)
+    {
+        result[i] = Half(_vector[i]);
+    }
+    return result;
+}
+
+template <int N>
+constexpr Vector<N, float> ToFloatVector(const Vector<N, Half>& _vector)
+{
+    Vector<N, float> result;
+    for (int i = 0; i < N; ++i)
+    {
+        result[i] = (float)_vector[i];
+    }
+    return result;
+}
+
+template <int N>
+constexpr Vector<N, int16_t> QuantizeVector(const Vector<N, float>& _vector, const VectorQuantization& _quantization)
+{
+    Vector<N, int16_t> result;
+    for (int i = 0; i < N; ++i)
+    {
+        result[i] = QuantizeComponent(_vector[i], _quantization);
+    }
+    return result;
+}
+
+template <int N>
+constexpr Vector<N, float> DequantizeVector(const Vector<N, int16_t>& _vector, const VectorQuantization& _quantization)
+{
+    Vector<N, float> result;
+    for (int i = 0; i < N; ++i)
+    {
+        result[i] = DequantizeComponent(_vector[i], _quantization);
+    }
+    return result;
+}
+
+
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//              Batch Kernels
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Each converts _count floats. Outputs must not overlap inputs.
+
+enum VectorQuantizationKernelSet
+{
+    QUANTIZATION_SCALAR_KERNELS     = 0,
+    QUANTIZATION_SSE2_KERNELS       = 1,
+    QUANTIZATION_AVX2_F16C_KERNELS  = 2,
+};
+
+
+// One instruction set's version of every kernel. SSE2 has no half conversion, so its halves are scalar.
+struct VectorQuantizationKernels
+{
+    const char* name;
+    void (*encodeHalfs)(const float* _in, Half* _out, size_t _count);
+    void (*decodeHalfs)(const Half* _in, float* _out, size_t _count);
+    void (*quantize)(const float* _in, int16_t* _out, size_t _count, const VectorQuantization& _quantization);
+    void (*dequantize)(const int16_t* _in, float* _out, size_t _count, const VectorQuantization& _quantization);
+};
+
+
+// @return The kernels for _set, or nullptr if this CPU or build does not have that instruction set.
+const VectorQuantizationKernels* GetVectorQuantizationKernels(VectorQuantizationKernelSet _set);
+
+// The functions below use the widest kernels this CPU supports.
+void EncodeHalfs(const float* _in, Half* _out, size_t _count);
+void DecodeHalfs(const Half* _in, float* _out, size_t _count);
+void QuantizeFloats(const float* _in, int16_t* _out, size_t _count, const VectorQuantization& _quantization);
+void DequantizeFloats(const int16_t* _in, float* _out, size_t _count, const VectorQuantization& _quantization);
+
+
+// ~~~ Whole arrays of Vectors ~~~
+// Each converts up to the smaller of the two spans, as one flat array of components.
+
+template <int N>
+void EncodeHalfVectors(std::span<const Vector<N, float>> _in, std::span<Vector<N, Half>> _out)
+{
+    static_assert(sizeof(Vector<N, float>) == N * sizeof(float) && sizeof(Vector<N, Half>) == N * sizeof(Half), "Vectors must be plain arrays of components");
+    size_t count = (_in.size() < _out.size()) ? _in.size() : _out.size();
+    if (count > 0)
+    {
+        EncodeHalfs(&_in[0][0], &_out[0][0], count * N);
+    }
+}
+
+template <int N>
+void DecodeHalfVectors(std::span<const Vector<N, Half>> _in, std::span<Vector<N, float>> _out)
+{
+    static_assert(sizeof(Vector<N, float>) == N * sizeof(float) && sizeof(Vector<N, Half>) == N * sizeof(Half), "Vectors must be plain arrays of components");
+    size_t count = (_in.size() < _out.size()) ? _in.size() : _out.size();
+    if (count > 0)
+    {
+        DecodeHalfs(&_in[0][0], &_out[0][0], count * N);
+    }
+}
+
+template <int N>
+void QuantizeVectors(std::span<const Vector<N, float>> _in, std::span<Vector<N, int16_t>> _out, const VectorQuantization& _quantization)
+{
+    static_assert(sizeof(Vector<N, float>) == N * sizeof(float) && sizeof(Vector<N, int16_t>) == N * sizeof(int16_t), "Vectors must be plain arrays of components");
+    size_t count = (_in.size() < _out.size()) ? _in.size() : _out.size();
+    if (count > 0)
+    {
+        QuantizeFloats(&_in[0][0], &_out[0][0], count * N, _quantization);
+    }
+}
+
+template <int N>
+void DequantizeVectors(std::span<const Vector<N, int16_t>> _in, std::span<Vector<N, float>> _out, const VectorQuantization& _quantization)
+{
+    static_assert(sizeof(Vector<N, float>) == N * sizeof(float) && sizeof(Vector<N, int16_t>) == N * sizeof(int16_t), "Vectors must be plain arrays of components");
+    size_t count = (_in.size() < _out.size()) ? _in.size() : _out.size();
+    if (count > 0)
+    {
+        DequantizeFloats(&_in[0][0], &_out[0][0], count * N, _quantization);
+    }
+}
+
+
+
+#endif  //  __QUANTIZED_VECTOR_H_
@@ -0,0 +1,230 @@
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//             Quaternion (h)
+//             Author: Christopher A
+//             Date: October 16, 2026
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//  Description:
+//
+//		A rotation quaternion x, y, z, w, on the same conventions as Vector3:
+//      constexpr throughout, private components, and SSE paths that give bit
+//      for bit the same floats as the plain float code.
+//
+//      a * b is the rotation b followed by a, so (a * b).Rotate(v) is
+//      a.Rotate(b.Rotate(v)) to within rounding. Matrix4x4::Rotation turns a
+//      quaternion into a matrix.
+//
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+
+#ifndef     __QUATERNION_H_
+#define     __QUATERNION_H_
+
+
+#include <cmath>
+#include <iosfwd>
+#include <type_traits>
+#include "ConstexprMath.h"
+#include "Vector3.h"
+
+
+
+class Quaternion
+{
+public:
+    // @brief The identity, no rotation.
+    constexpr Quaternion();
+    constexpr Quaternion(float _x, float _y, float _z, float _w);
+
+    // @brief A rotation of _radians about _axis, counter-clockwise looking down the axis. _axis must be unit length.
+    static Quaternion FromAxisAngle(const Vector3& _axis, float _radians);
+
+    constexpr float GetX() const;
+    constexpr float GetY() const;
+    constexpr float GetZ() const;
+    constexpr float GetW() const;
+
+    constexpr float Dot(const Quaternion& _other) const;
+    constexpr float Magnitude() const;
+    constexpr float MagnitudeSqr() const;
+
+    // @brief This quaternion at unit length. Quaternions too short to normalise give the identity.
+    constexpr Quaternion Normalised() const;
+
+    // @brief (-x, -y, -z, w), the inverse of a unit quaternion.
+    constexpr Quaternion Conjugate() const;
+
+    // @brief The inverse of any quaternion. Quaternions too short to invert give the identity.
+    constexpr Quaternion Inverse() const;
+
+    // @brief _vector rotated by this quaternion, which must be unit length.
+    constexpr Vector3 Rotate(const Vector3& _vector) const;
+
+    // ~~~ Operators ~~~
+    constexpr Quaternion operator * (const Quaternion& _other) const;
+    constexpr Quaternion& operator *= (const Quaternion& _other);
+    constexpr bool operator == (const Quaternion& _other) const;
+    constexpr bool operator != (const Quaternion& _other) const;
+
+
+private:
+#if VECTOR3_ENABLE_SIMD
+    static Quaternion FromRegister(__m128 _xyzw);
+    __m128 ToRegister() const;
+#endif
+
+    alignas(16) float m_components[4];
+};
+
+
+
+constexpr Quaternion::Quaternion() :
+    m_components{ 0.0f, 0.0f, 0.0f, 1.0f }
+{
+}
+
+constexpr Quaternion::Quaternion(float _x, float _y, float _z, float _w) :
+    m_components{ _x, _y, _z, _w }
+{
+}
+
+inline Quaternion Quaternion::FromAxisAngle(const Vector3& _axis, float _radians)
+{
+    float halfSin = std::sin(_radians * 0.5f);
+    return Quaternion(_axis.GetX() * halfSin, _axis.GetY() * halfSin, _axis.GetZ() * halfSin, std::cos(_radians * 0.5f));
+}
+
+
+constexpr float Quaternion::GetX() const
+{
+    return m_components[0];
+}
+
+constexpr float Quaternion::GetY() const
+{
+    return m_components[1];
+}
+
+constexpr float Quaternion::GetZ() const
+{
+    return m_components[2];
+}
+
+constexpr float Quaternion::GetW() const
+{
+    return m_components[3];
+}
+
+constexpr float Quaternion::Dot(const Quaternion& _other) const
+{
+    return m_components[0] * _other.m_components[0] + m_components[1] * _other.m_components[1]
+        + m_components[2] * _other.m_components[2] + m_components[3] * _other.m_components[3];
+}
+
+constexpr float Quaternion::Magnitude() const
+{
+    return ConstexprSqrt(MagnitudeSqr());
+}
+
+constexpr float Quaternion::MagnitudeSqr() const
+{
+    return Dot(*this);
+}
+
+constexpr Quaternion Quaternion::Normalised() const
+{
+    float mag = Magnitude();
+    if (ConstexprAbs(mag) < EPSILON)
+    {
+        return Quaternion();
+    }
+    return Quaternion(m_components[0] / mag, m_components[1] / mag, m_components[2] / mag, m_components[3] / mag);
+}
+
+constexpr Quaternion Quaternion::Conjugate() const
+{
+    return Quaternion(-m_components[0], -m_components[1], -m_components[2], m_components[3]);
+}
+
+constexpr Quaternion Quaternion::Inverse() const
+{
+    float magSqr = MagnitudeSqr();
+    if (ConstexprAbs(magSqr) < EPSILON)
+    {
+        return Quaternion();
+    }
+    return Quaternion(-m_components[0] / magSqr, -m_components[1] / magSqr, -m_components[2] / magSqr, m_components[3] / magSqr);
+}
+
+constexpr Vector3 Quaternion::Rotate(const Vector3& _vector) const
+{
+    // v + w * t + q x t with t = 2 * (q x v): q * v * q^-1 multiplied out, two crosses instead of two
+    // quaternion products. Vector3's own SSE paths do the work.
+    Vector3 axis(m_components[0], m_components[1], m_components[2]);
+    Vector3 twiceCross = axis.Cross(_vector) * 2.0f;
+    return _vector + twiceCross * m_components[3] + axis.Cross(twiceCross);
+}
+
+
+// ~~~ Operators ~~~
+constexpr Quaternion Quaternion::operator * (const Quaternion& _other) const
+{
+    const float* a = m_components;
+    const float* b = _other.m_components;
+#if VECTOR3_ENABLE_SIMD
+    if (std::is_constant_evaluated() == false)
+    {
+        // One column of the Hamilton product per component of a, e.g. ax * (bw, -bz, by, -bx), summed in the
+        // scalar version's order. Flipping a sign bit is exact, so adding -p gives the same bits as subtracting p.
+        __m128 other = _other.ToRegister();
+        __m128 wTerm = _mm_mul_ps(_mm_set1_ps(a[3]), other);
+        __m128 xTerm = _mm_mul_ps(_mm_set1_ps(a[0]), _mm_xor_ps(_mm_shuffle_ps(other, other, _MM_SHUFFLE(0, 1, 2, 3)), _mm_set_ps(-0.0f, 0.0f, -0.0f, 0.0f)));
+        __m128 yTerm = _mm_mul_ps(_mm_set1_ps(a[1]), _mm_xor_ps(_mm_shuffle_ps(other, other, _MM_SHUFFLE(1, 0, 3, 2)), _mm_set_ps(-0.0f, -0.0f, 0.0f, 0.0f)));
+        __m128 zTerm = _mm_mul_ps(_mm_set1_ps(a[2]), _mm_xor_ps(_mm_shuffle_ps(other, other, _MM_SHUFFLE(2, 3, 0, 1)), _mm_set_ps(-0.0f, 0.0f, 0.0f, -0.0f)));
+        return FromRegister(_mm_add_ps(_mm_add_ps(_mm_add_ps(wTerm, xTerm), yTerm), zTerm));
+    }
+#endif
+    return Quaternion(a[3] * b[0] + a[0] * b[3] + a[1] * b[2] - a[2] * b[1],
+                        a[3] * b[1] - a[0] * b[2] + a[1] * b[3] + a[2] * b[0],
+                        a[3] * b[2] + a[0] * b[1] - a[1] * b[0] + a[2] * b[3],
+                        a[3] * b[3] - a[0] * b[0] - a[1] * b[1] - a[2] * b[2]);
+}
+
+constexpr Quaternion& Quaternion::operator *= (const Quaternion& _other)
+{
+    return *this = *this * _other;
+}
+
+constexpr bool Quaternion::operator == (const Quaternion& _other) const
+{
+    return ConstexprAbs(m_components[0] - _other.m_components[0]) < EPSILON
+        && ConstexprAbs(m_components[1] - _other.m_components[1]) < EPSILON
+        && ConstexprAbs(m_components[2] - _other.m_components[2]) < EPSILON
+        && ConstexprAbs(m_components[3] - _other.m_components[3]) < EPSILON;
+}
+
+constexpr bool Quaternion::operator != (const Quaternion& _other) const
+{
+    return (*this == _other) == false;
+}
+
+
+#if VECTOR3_ENABLE_SIMD
+inline Quaternion Quaternion::FromRegister(__m128 _xyzw)
+{
+    Quaternion result;
+    _mm_store_ps(result.m_components, _xyzw);
+    return result;
+}
+
+inline __m128 Quaternion::ToRegister() const
+{
+    return _mm_load_ps(m_components);
+}
+#endif
+
+
+
+// Stream insertion operator for printing Quaternion
+std::ostream& operator << (std::ostream& _os, const Quaternion& _quaternion);
+
+
+#endif  //  __QUATERNION_H_
@@ -11,6 +11,12 @@
 //      operations on the vector such as addition, subtraction, multiplication 
 //      and division as well as dot and cross product.
 //
+//      Where SSE is available the three floats are padded out to a 16 byte
+//      aligned xyzw block (w is always 0), and the arithmetic, Dot, Cross,
+//      Magnitude and Normalised run on SSE registers. Every result is bit for
+//      bit the same as the plain float fallback: each lane does the same IEEE
+//      operation, and Dot adds x, y and z in the same order.
+//
 //=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 
 #ifndef __VECTOR3_H_
@@ -22,54 +28,418 @@
 #endif
 
 
-#include <iostream>
+#include <iosfwd>
+#include <type_traits>
+#include "ConstexprMath.h"
+#include "VectorDivisionPolicy.h"
 
 
+// Set to 0 to build Vector3 on plain floats even where SSE is available
+#ifndef VECTOR3_ENABLE_SIMD
+#if defined(_M_X64) || defined(__x86_64__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#define VECTOR3_ENABLE_SIMD 1
+#else
+#define VECTOR3_ENABLE_SIMD 0
+#endif
+#endif
+
+#if VECTOR3_ENABLE_SIMD
+#include <xmmintrin.h>
+#endif
+
 
 class Vector3
 {
 public:
-    Vector3();
-    Vector3(float _x, float _y);
-    Vector3(float _x, float _y, float _z);
-
-    float GetX() const;
-    float GetY() const;
-    float GetZ() const;
-    const Vector3& SetX(float _x);
-    const Vector3& SetY(float _y);
-    const Vector3& SetZ(float _z);
-
-    float Dot(const Vector3& _other) const;
-    Vector3 Cross(const Vector3& _other) const;
-    float Magnitude() const;
-    float MagnitudeSqr() const;
-    const Vector3& Normalise();
-    Vector3 Normalised() const;
+    constexpr Vector3();
+    constexpr Vector3(float _x, float _y);
+    constexpr Vector3(float _x, float _y, float _z);
+
+    constexpr float GetX() const;
+    constexpr float GetY() const;
+    constexpr float GetZ() const;
+    constexpr const Vector3& SetX(float _x);
+    constexpr const Vector3& SetY(float _y);
+    constexpr const Vector3& SetZ(float _z);
+
+    constexpr float Dot(const Vector3& _other) const;
+    constexpr Vector3 Cross(const Vector3& _other) const;
+    constexpr float Magnitude() const;
+    constexpr float MagnitudeSqr() const;
+    constexpr const Vector3& Normalise();
+    constexpr Vector3 Normalised() const;
+
+    // @brief Normalised() to within about 1e-6 relative error, for normals and directions that do not need
+    // the last bits. Built on rsqrtps, with no sqrt, divide or branch. Unlike Normalised(), vectors so long
+    // that MagnitudeSqr() overflows (beyond about 1e19) come out as NaN.
+    constexpr Vector3 NormalisedFast() const;
+
+    // @brief |a - b| < _tolerance on every axis, as one SSE compare. operator == is this with EPSILON. Not
+    // transitive, so it cannot key a hash map; see Vector3HashMap.h for that.
+    constexpr bool IsNearlyEqual(const Vector3& _other, float _tolerance) const;
+
+    // @brief *this / _scalar, with a _scalar within EPSILON of zero handled as Policy says. operator / and
+    // operator /= use VECTOR_DIVISION_DEFAULT_POLICY. See VectorDivisionPolicy.h.
+    template <VectorDivisionPolicy Policy>
+    constexpr Vector3 Divide(float _scalar) const;
 
     // ~~~ Operators ~~~
-    Vector3 operator + () const;
-    Vector3 operator - () const;
-    Vector3 operator + (const Vector3& _other) const;
-    Vector3 operator - (const Vector3& _other) const;
-    Vector3 operator * (float _scalar) const;
-    Vector3 operator / (float _scalar) const;
-    Vector3& operator += (const Vector3& _other);
-    Vector3& operator -= (const Vector3& _other);
-    Vector3& operator *= (float _scalar);
-    Vector3& operator /= (float _scalar);
-    bool operator == (const Vector3& _other) const;
-    bool operator != (const Vector3& _other) const;
-    Vector3 operator * (float _scalar);
+    constexpr Vector3 operator + () const;
+    constexpr Vector3 operator - () const;
+    constexpr Vector3 operator + (const Vector3& _other) const;
+    constexpr Vector3 operator - (const Vector3& _other) const;
+    constexpr Vector3 operator * (float _scalar) const;
+    constexpr Vector3 operator / (float _scalar) const;
+    constexpr Vector3& operator += (const Vector3& _other);
+    constexpr Vector3& operator -= (const Vector3& _other);
+    constexpr Vector3& operator *= (float _scalar);
+    constexpr Vector3& operator /= (float _scalar);
+    constexpr bool operator == (const Vector3& _other) const;
+    constexpr bool operator != (const Vector3& _other) const;
+    constexpr Vector3 operator * (float _scalar);
 
 
 private:
-    float m_x;
-    float m_y;
-    float m_z;
+#if VECTOR3_ENABLE_SIMD
+    // Matrix4x4 transforms straight from and to the register
+    friend class Matrix4x4;
+
+    static Vector3 FromRegister(__m128 _xyzw);
+    __m128 ToRegister() const;
+
+    // x, y, z and a w that is always 0, so whole-register operations never produce garbage in it
+    alignas(16) float m_components[4];
+#else
+    float m_components[3];
+#endif
 };
 
 
+
+// Everything is inline and constexpr, so geometry constants can be worked out at compile time and
+// hot loops are not paying for a call per operation. The SSE paths only run outside constant
+// evaluation; the plain float code they fall back to is also the non-SSE build.
+#if VECTOR3_ENABLE_SIMD
+constexpr Vector3::Vector3() :
+    m_components{ 0.0f, 0.0f, 0.0f, 0.0f }
+{
+}
+
+constexpr Vector3::Vector3(float _x, float _y) :
+    m_components{ _x, _y, 0.0f, 0.0f }
+{
+}
+
+constexpr Vector3::Vector3(float _x, float _y, float _z) :
+    m_components{ _x, _y, _z, 0.0f }
+{
+}
+#else
+constexpr Vector3::Vector3() :
+    m_components{ 0.0f, 0.0f, 0.0f }
+{
+}
+
+constexpr Vector3::Vector3(float _x, float _y) :
+    m_components{ _x, _y, 0.0f }
+{
+}
+
+constexpr Vector3::Vector3(float _x, float _y, float _z) :
+    m_components{ _x, _y, _z }
+{
+}
+#endif
+
+
+constexpr float Vector3::GetX() const
+{
+    return m_components[0];
+}
+
+constexpr float Vector3::GetY() const
+{
+    return m_components[1];
+}
+
+constexpr float Vector3::GetZ() const
+{
+    return m_components[2];
+}
+
+constexpr const Vector3& Vector3::SetX(float _x)
+{
+    m_components[0] = _x;
+    return *this;
+}
+
+constexpr const Vector3& Vector3::SetY(float _y)
+{
+    m_components[1] = _y;
+    return *this;
+}
+
+constexpr const Vector3& Vector3::SetZ(float _z)
+{
+    m_components[2] = _z;
+    return *this;
+}
+
+constexpr float Vector3::Dot(const Vector3& _other) const
+{
+#if VECTOR3_ENABLE_SIMD
+    if (std::is_constant_evaluated() == false)
+    {
+        // (x + y) + z, the same order as the scalar version, so the rounding matches
+        __m128 products = _mm_mul_ps(ToRegister(), _other.ToRegister());
+        __m128 sum = _mm_add_ss(products, _mm_shuffle_ps(products, products, _MM_SHUFFLE(1, 1, 1, 1)));
+        sum = _mm_add_ss(sum, _mm_movehl_ps(products, products));
+        return _mm_cvtss_f32(sum);
+    }
+#endif
+    return m_components[0] * _other.m_components[0] + m_components[1] * _other.m_components[1] + m_components[2] * _other.m_components[2];
+}
+
+constexpr Vector3 Vector3::Cross(const Vector3& _other) const
+{
+#if VECTOR3_ENABLE_SIMD
+    if (std::is_constant_evaluated() == false)
+    {
+        // yzx * zxy - zxy * yzx. w works out as 0 * 0 - 0 * 0.
+        __m128 a = ToRegister();
+        __m128 b = _other.ToRegister();
+        __m128 aYZX = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 0, 2, 1));
+        __m128 aZXY = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 1, 0, 2));
+        __m128 bYZX = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 2, 1));
+        __m128 bZXY = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 1, 0, 2));
+        return FromRegister(_mm_sub_ps(_mm_mul_ps(aYZX, bZXY), _mm_mul_ps(aZXY, bYZX)));
+    }
+#endif
+    return Vector3(m_components[1] * _other.m_components[2] - m_components[2] * _other.m_components[1],
+                    m_components[2] * _other.m_components[0] - m_components[0] * _other.m_components[2],
+                    m_components[0] * _other.m_components[1] - m_components[1] * _other.m_components[0]);
+}
+
+constexpr float Vector3::Magnitude() const
+{
+#if VECTOR3_ENABLE_SIMD
+    if (std::is_constant_evaluated() == false)
+    {
+        return _mm_cvtss_f32(_mm_sqrt_ss(_mm_set_ss(MagnitudeSqr())));
+    }
+#endif
+    return ConstexprSqrt( MagnitudeSqr() );
+}
+
+constexpr float Vector3::MagnitudeSqr() const
+{
+    return Dot(*this);
+}
+
+constexpr const Vector3& Vector3::Normalise()
+{
+    float mag = Magnitude();
+    if (ConstexprAbs(mag) < EPSILON)
+    {
+        return *this;
+    }
+    return *this /= mag;
+}
+
+constexpr Vector3 Vector3::Normalised() const
+{
+    float mag = Magnitude();
+    if (ConstexprAbs(mag) < EPSILON)
+    {
+        return Vector3(0.0f, 0.0f, 0.0f);
+    }
+
+    // mag is known to be safe to divide by here, so this skips operator /'s check
+#if VECTOR3_ENABLE_SIMD
+    if (std::is_constant_evaluated() == false)
+    {
+        return FromRegister(_mm_div_ps(ToRegister(), _mm_set_ps(1.0f, mag, mag, mag)));
+    }
+#endif
+    return Vector3(m_components[0] / mag, m_components[1] / mag, m_components[2] / mag);
+}
+
+constexpr Vector3 Vector3::NormalisedFast() const
+{
+#if VECTOR3_ENABLE_SIMD
+    if (std::is_constant_evaluated() == false)
+    {
+        // rsqrt estimate, one Newton-Raphson step e * (1.5 - 0.5 * x * e * e), then zero the whole vector
+        // if it was too short. A zero length gives an infinite estimate, which the mask throws away.
+        __m128 magSqr = _mm_set1_ps(MagnitudeSqr());
+        __m128 estimate = _mm_rsqrt_ps(magSqr);
+        __m128 halfMagSqr = _mm_mul_ps(_mm_set1_ps(0.5f), magSqr);
+        estimate = _mm_mul_ps(estimate, _mm_sub_ps(_mm_set1_ps(1.5f), _mm_mul_ps(halfMagSqr, _mm_mul_ps(estimate, estimate))));
+        __m128 isLongEnough = _mm_cmpge_ps(magSqr, _mm_set1_ps(FAST_NORMALISE_MIN_MAGNITUDE_SQR));
+        return FromRegister(_mm_and_ps(_mm_mul_ps(ToRegister(), estimate), isLongEnough));
+    }
+#endif
+    float magSqr = MagnitudeSqr();
+    if (magSqr < FAST_NORMALISE_MIN_MAGNITUDE_SQR)
+    {
+        return Vector3(0.0f, 0.0f, 0.0f);
+    }
+    return *this * ApproximateReciprocalSqrt(magSqr);
+}
+
+constexpr bool Vector3::IsNearlyEqual(const Vector3& _other, float _tolerance) const
+{
+#if VECTOR3_ENABLE_SIMD
+    if (std::is_constant_evaluated() == false)
+    {
+        // NaN differences compare false, like the scalar version. w is 0 - 0, so only x, y and z are looked at.
+        __m128 difference = _mm_andnot_ps(_mm_set1_ps(-0.0f), _mm_sub_ps(ToRegister(), _other.ToRegister()));
+        return (_mm_movemask_ps(_mm_cmplt_ps(difference, _mm_set1_ps(_tolerance))) & 0x7) == 0x7;
+    }
+#endif
+    return ConstexprAbs(m_components[0] - _other.m_components[0]) < _tolerance
+        && ConstexprAbs(m_components[1] - _other.m_components[1]) < _tolerance
+        && ConstexprAbs(m_components[2] - _other.m_components[2]) < _tolerance;
+}
+
+
+// ~~~ Operators ~~~
+constexpr Vector3 Vector3::operator + () const
+{
+    return *this;
+}
+
+constexpr Vector3 Vector3::operator - () const
+{
+#if VECTOR3_ENABLE_SIMD
+    if (std::is_constant_evaluated() == false)
+    {
+        // Flips the sign bits rather than subtracting from zero, so -(0) gives -0 like the scalar version. w stays +0.
+        return FromRegister(_mm_xor_ps(ToRegister(), _mm_set_ps(0.0f, -0.0f, -0.0f, -0.0f)));
+    }
+#endif
+    return Vector3(-m_components[0], -m_components[1], -m_components[2]);
+}
+
+constexpr Vector3 Vector3::operator + (const Vector3& _other) const
+{
+#if VECTOR3_ENABLE_SIMD
+    if (std::is_constant_evaluated() == false)
+    {
+        return FromRegister(_mm_add_ps(ToRegister(), _other.ToRegister()));
+    }
+#endif
+    return Vector3(m_components[0] + _other.m_components[0], m_components[1] + _other.m_components[1], m_components[2] + _other.m_components[2]);
+}
+
+constexpr Vector3 Vector3::operator - (const Vector3& _other) const
+{
+#if VECTOR3_ENABLE_SIMD
+    if (std::is_constant_evaluated() == false)
+    {
+        return FromRegister(_mm_sub_ps(ToRegister(), _other.ToRegister()));
+    }
+#endif
+    return Vector3(m_components[0] - _other.m_components[0], m_components[1] - _other.m_components[1], m_components[2] - _other.m_components[2]);
+}
+
+constexpr Vector3 Vector3::operator * (float _scalar) const
+{
+#if VECTOR3_ENABLE_SIMD
+    if (std::is_constant_evaluated() == false)
+    {
+        // w is multiplied by 0 rather than _scalar, so an infinite scalar cannot turn it into a NaN
+        return FromRegister(_mm_mul_ps(ToRegister(), _mm_set_ps(0.0f, _scalar, _scalar, _scalar)));
+    }
+#endif
+    return Vector3(m_components[0] * _scalar, m_components[1] * _scalar, m_components[2] * _scalar);
+}
+
+template <VectorDivisionPolicy Policy>
+constexpr Vector3 Vector3::Divide(float _scalar) const
+{
+    CheckVectorDivisor<Policy>(_scalar);
+
+#if VECTOR3_ENABLE_SIMD
+    if (std::is_constant_evaluated() == false)
+    {
+        // w is divided by 1 rather than _scalar, so it stays 0 whatever _scalar is
+        __m128 quotient = _mm_div_ps(ToRegister(), _mm_set_ps(1.0f, _scalar, _scalar, _scalar));
+        if constexpr (Policy == VECTOR_DIVISION_SATURATE)
+        {
+            // |_scalar| >= the smallest safe divisor, as an all ones or all zeroes mask over the quotient
+            __m128 absScalar = _mm_andnot_ps(_mm_set1_ps(-0.0f), _mm_set1_ps(_scalar));
+            quotient = _mm_and_ps(quotient, _mm_cmpge_ps(absScalar, _mm_set1_ps(GetEpsilonAsFloat())));
+        }
+        return FromRegister(quotient);
+    }
+#endif
+    if constexpr (Policy == VECTOR_DIVISION_SATURATE)
+    {
+        return IsSafeVectorDivisor(_scalar)
+            ? Vector3(m_components[0] / _scalar, m_components[1] / _scalar, m_components[2] / _scalar)
+            : Vector3(0.0f, 0.0f, 0.0f);
+    }
+    return Vector3(m_components[0] / _scalar, m_components[1] / _scalar, m_components[2] / _scalar);
+}
+
+constexpr Vector3 Vector3::operator / (float _scalar) const
+{
+    return Divide<VECTOR_DIVISION_DEFAULT_POLICY>(_scalar);
+}
+
+constexpr Vector3& Vector3::operator += (const Vector3& _other)
+{
+    return *this = *this + _other;
+}
+
+constexpr Vector3& Vector3::operator -= (const Vector3& _other)
+{
+    return *this = *this - _other;
+}
+
+constexpr Vector3& Vector3::operator *= (float _scalar)
+{
+    return *this = *this * _scalar;
+}
+
+constexpr Vector3& Vector3::operator /= (float _scalar)
+{
+    return *this = *this / _scalar;
+}
+
+constexpr bool Vector3::operator == (const Vector3& _other) const
+{
+    return IsNearlyEqual(_other, GetEpsilonAsFloat());
+}
+
+constexpr bool Vector3::operator != (const Vector3& _other) const
+{
+    return (*this == _other) == false;
+}
+
+constexpr Vector3 Vector3::operator * (float _scalar)
+{
+    return static_cast<const Vector3&>(*this) * _scalar;
+}
+
+
+#if VECTOR3_ENABLE_SIMD
+inline Vector3 Vector3::FromRegister(__m128 _xyzw)
+{
+    Vector3 result;
+    _mm_store_ps(result.m_components, _xyzw);
+    return result;
+}
+
+inline __m128 Vector3::ToRegister() const
+{
+    return _mm_load_ps(m_components);
+}
+#endif
+
+
+
 // Stream insertion operator for printing Vector3
 std::ostream& operator << (std::ostream& _os, const Vector3& _vec);
 
@@ -0,0 +1,91 @@
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//             Vector3 Benchmarks (h)
+//             Author: Christopher A
+//             Date: October 16, 2026
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//  Description:
+//
+//		Micro benchmarks for Vector3 and Vector<N, T>. Run with `CppTests --bench`.
+//      Results are written to std::cout.
+//
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+
+#ifndef     __VECTOR3_BENCHMARKS_H_
+#define     __VECTOR3_BENCHMARKS_H_
+
+
+
+// @brief Checks that every Vector3 operation gives bit for bit the same floats as the plain
+// scalar formulas, over a million random vectors plus zeroes, negative zeroes and infinities.
+// @return true if every result matched.
+bool RunVector3BitCompatibilityTest();
+
+// @brief Times Vector3's arithmetic, Dot, Cross, Magnitude and Normalised over 100,000 vectors
+// against the plain scalar formulas.
+void RunVector3OperationBenchmark();
+
+// @brief a * s + b over 100,000 vectors for Vector3, Vector<3, float> and Vector<3, int16_t>, with the
+// operators inlined against the same operators behind a call each, as they were when they lived in cpps.
+void RunVectorCallBoundaryBenchmark();
+
+// @brief Add, scale, Dot, Cross, Normalised, Magnitude and bounds over a million vectors, as a loop of
+// Vector3 operators against the Vector3Stream kernels, in GB/s of x, y, z read and written.
+// Also checks every kernel set's results against the Vector3 operators bit for bit.
+// @return true if every result matched.
+bool RunVector3StreamBenchmark();
+
+// @brief Checks NormalisedFast on Vector3, Vector<3, float>, every stream kernel set, TriangleList
+// face normals and the Bezier tangents against the exact Normalised, and times the two against each other.
+// @return true if every fast result was within 1e-4 of the exact one.
+bool RunVector3FastNormaliseTest();
+
+// @brief Times a vector divided by a scalar under each VectorDivisionPolicy against the old branch and
+// std::cerr check, for Vector3 and Vector<4, float>, and checks SATURATE zeroes (nearly) zero divisors.
+// @return true if SATURATE gave zero for every unsafe divisor and the plain quotient for safe ones.
+bool RunVectorDivisionBenchmark();
+
+// @brief Times out = a + b * s - c for Vector<N, float> with N of 3, 16 and 64, with the operators
+// making a temporary Vector each as they used to against the expression templates.
+// @return true if both ways gave the same floats.
+bool RunVectorExpressionBenchmark();
+
+// @brief Times Dot on Vector<N, float> for N from 4 to 1024 against the old single accumulator loop and
+// each dot kernel set, reports each one's error, and times DotBatch against a loop of Dot.
+// @return true if DotAccurate was accurate and DotBatch matched Dot bit for bit.
+bool RunVectorDotBenchmark();
+
+// @brief ns per access reading one component of each of 4096 Vector<16, float>s at a runtime index, and
+// summing every component with a loop over operator [], through the old checked access and the new one.
+// @return true if both gave the same results.
+bool RunVectorAccessBenchmark();
+
+// @brief Checks every half and int16_t kernel set against the inline conversions bit for bit and the round
+// trip errors against their bounds, times the kernels, and times a scan over 4 million Vector<4, float>
+// stored as floats, halves and int16_ts.
+// @return true if every kernel set matched and every error was within bounds.
+bool RunVectorQuantizationBenchmark();
+
+// @brief Checks Matrix4x4 and Quaternion's SSE paths and every transform kernel set bit for bit, and
+// inverses and rotations against their error bounds. Times multiply, inverse and compose, TransformPoints
+// in and out of cache against a loop of plain float transforms and memcpy, and TriangleList::Transform.
+// @return true if every check passed.
+bool RunMatrixTransformBenchmark();
+
+// @brief Checks operator == against the old double compare, welding against std::unordered_map, and
+// times both, with the weld over a million triangle soup.
+// @return true if operator == agreed with the old compare everywhere and both welds gave the same indices.
+bool RunVector3WeldBenchmark();
+
+// @brief Checks that AoS and SoA TriangleLists hold the same triangles through building, Transform and
+// switching storage, then times bounds, back-face culling and Transform over a million triangles: AoS
+// through GetTriangle, SoA through GetTriangle, and SoA through its streams.
+// @return true if both storage modes gave the same triangles, bounds and culling counts.
+bool RunTriangleListStorageBenchmark();
+
+// @brief Runs every Vector3 benchmark in turn, carrying on past a failed check so every result is printed.
+// @return true if every benchmark that checks its results passed.
+bool RunVector3Benchmarks();
+
+
+
+#endif  //  __VECTOR3_BENCHMARKS_H_
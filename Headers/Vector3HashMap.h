@@ -0,0 +1,333 @@
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//             Vector3 Hash Map (h)
+//             Author: Christopher A
+//             Date: October 16, 2026
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//  Description:
+//
+//		Hashing Vector3 for vertex welding. Vector3::operator == is a tolerance
+//      test, which is not transitive and has no hash to go with it, so keys
+//      are compared by grid cell instead.
+//
+//      - Vector3GridHash / Vector3GridEqual put vectors on a grid of cubes
+//        _cellSize across: two vectors are equal when they share a cell. This
+//        is transitive and hashes consistently, so the pair also works with
+//        std::unordered_map. Vectors closer than _cellSize but either side of
+//        a cell boundary stay apart.
+//      - Vector3HashMap is open addressing with linear probing over flat
+//        arrays, so inserts never allocate a node. Probing reads a 4 byte tag
+//        per slot and only compares keys on a tag match.
+//      - WeldVector3s is the usual use: one index per input vector into a
+//        list of unique vectors.
+//
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+
+#ifndef     __VECTOR3_HASH_MAP_H_
+#define     __VECTOR3_HASH_MAP_H_
+
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "Vector3.h"
+
+
+
+// ~~~ Grid hashing ~~~
+
+struct Vector3GridCell
+{
+    int64_t x;
+    int64_t y;
+    int64_t z;
+
+    constexpr bool operator == (const Vector3GridCell& _other) const = default;
+};
+
+
+// @brief The grid cell _component * _inverseCellSize falls in, i.e. floor of it. NaN and anything beyond
+// 2^62 cells from the origin clamp to the edge cells, so every float has a cell. Branch free, as welding
+// hashes every vertex and the signs and fractions are as good as random.
+constexpr int64_t GetGridCellIndex(float _component, float _inverseCellSize)
+{
+    const float limit = (float)(1ull << 62);
+    float scaled = _component * _inverseCellSize;
+#if VECTOR3_ENABLE_SIMD
+    if (std::is_constant_evaluated() == false)
+    {
+        // maxss gives its second operand when either is NaN, so NaN goes to -limit as below
+        scaled = _mm_cvtss_f32(_mm_min_ss(_mm_max_ss(_mm_set_ss(scaled), _mm_set_ss(-limit)), _mm_set_ss(limit)));
+    }
+    else
+#endif
+    {
+        scaled = (scaled > -limit) ? scaled : -limit;
+        scaled = (scaled < limit) ? scaled : limit;
+    }
+
+    // Truncation rounds towards zero, so negative values with a fraction step down one. Beyond 2^23
+    // every float is whole, so the conversion back is exact.
+    int64_t index = (int64_t)scaled;
+    return index - (int64_t)((float)index > scaled);
+}
+
+
+struct Vector3GridHash
+{
+    float inverseCellSize;
+
+    // @param _cellSize Width of each grid cube. Vectors in the same cube hash the same.
+    explicit constexpr Vector3GridHash(float _cellSize)
+        : inverseCellSize(1.0f / _cellSize)
+    {
+    }
+
+    constexpr Vector3GridCell GetCell(const Vector3& _vector) const
+    {
+        return { GetGridCellIndex(_vector.GetX(), inverseCellSize), GetGridCellIndex(_vector.GetY(), inverseCellSize), GetGridCellIndex(_vector.GetZ(), inverseCellSize) };
+    }
+
+    constexpr size_t operator () (const Vector3& _vector) const
+    {
+        // Each axis through a different odd multiplier, then the murmur3 finaliser, so neighbouring cells
+        // land far apart and every bit of the result depends on every axis
+        Vector3GridCell cell = GetCell(_vector);
+        uint64_t hash = (uint64_t)cell.x * 0x9E3779B97F4A7C15ull ^ (uint64_t)cell.y * 0xC2B2AE3D27D4EB4Full ^ (uint64_t)cell.z * 0x165667B19E3779F9ull;
+        hash ^= hash >> 33;
+        hash *= 0xFF51AFD7ED558CCDull;
+        hash ^= hash >> 33;
+        hash *= 0xC4CEB9FE1A85EC53ull;
+        hash ^= hash >> 33;
+        return (size_t)hash;
+    }
+};
+
+
+struct Vector3GridEqual
+{
+    Vector3GridHash grid;
+
+    // @param _cellSize Must match the Vector3GridHash's.
+    explicit constexpr Vector3GridEqual(float _cellSize)
+        : grid(_cellSize)
+    {
+    }
+
+    constexpr bool operator () (const Vector3& _a, const Vector3& _b) const
+    {
+        return grid.GetCell(_a) == grid.GetCell(_b);
+    }
+};
+
+
+
+// ~~~ Vector3HashMap ~~~
+
+// Vector3 keys to Values, open addressing with linear probing. Value must be default constructible.
+// There is no erase: welding and other deduplication only ever add. Pointers to values last until the
+// next insert that grows the map.
+template <typename Value, typename Hash = Vector3GridHash, typename Equal = Vector3GridEqual>
+class Vector3HashMap
+{
+public:
+    explicit Vector3HashMap(const Hash& _hash, const Equal& _equal);
+
+    // @brief A map keyed on grid cells _cellSize across.
+    explicit Vector3HashMap(float _cellSize) requires (std::is_same_v<Hash, Vector3GridHash> && std::is_same_v<Equal, Vector3GridEqual>);
+
+    size_t GetCount() const;
+    size_t GetCapacity() const;
+
+    // @brief Makes room for _count keys in all, so inserting up to that many never rehashes.
+    void Reserve(size_t _count);
+
+    // @brief Removes every key, keeping the capacity.
+    void Clear();
+
+    // @brief Adds _key with _value unless an equal key is already there.
+    // @return The value stored for the key, and true if it was just added.
+    std::pair<Value*, bool> Insert(const Vector3& _key, const Value& _value);
+
+    // @return The value stored for a key equal to _key, or nullptr.
+    Value* Find(const Vector3& _key);
+    const Value* Find(const Vector3& _key) const;
+
+
+private:
+    // Tags are the top 32 bits of the hash with the low bit set, so 0 can mark an empty slot
+    static const uint32_t EMPTY_TAG = 0;
+    static const size_t MIN_CAPACITY = 16;
+
+    static uint32_t GetTag(size_t _hash);
+
+    // @return Slot holding a key equal to _key, or the empty slot where it would go.
+    size_t FindSlot(const Vector3& _key, size_t _hash, uint32_t _tag) const;
+
+    // Capacities are powers of two, at most 7/8 full
+    static bool IsOverloaded(size_t _count, size_t _capacity);
+    void Rehash(size_t _capacity);
+
+    Hash m_hash;
+    Equal m_equal;
+    std::vector<uint32_t> m_tags;
+    std::vector<Vector3> m_keys;
+    std::vector<Value> m_values;
+    size_t m_count;
+    size_t m_mask;
+};
+
+
+template <typename Value, typename Hash, typename Equal>
+Vector3HashMap<Value, Hash, Equal>::Vector3HashMap(const Hash& _hash, const Equal& _equal)
+    : m_hash(_hash), m_equal(_equal), m_count(0), m_mask(0)
+{
+    Rehash(MIN_CAPACITY);
+}
+
+template <typename Value, typename Hash, typename Equal>
+Vector3HashMap<Value, Hash, Equal>::Vector3HashMap(float _cellSize) requires (std::is_same_v<Hash, Vector3GridHash> && std::is_same_v<Equal, Vector3GridEqual>)
+    : Vector3HashMap(Vector3GridHash(_cellSize), Vector3GridEqual(_cellSize))
+{
+}
+
+template <typename Value, typename Hash, typename Equal>
+size_t Vector3HashMap<Value, Hash, Equal>::GetCount() const
+{
+    return m_count;
+}
+
+template <typename Value, typename Hash, typename Equal>
+size_t Vector3HashMap<Value, Hash, Equal>::GetCapacity() const
+{
+    return m_tags.size();
+}
+
+template <typename Value, typename Hash, typename Equal>
+void Vector3HashMap<Value, Hash, Equal>::Reserve(size_t _count)
+{
+    size_t capacity = m_tags.size();
+    while (IsOverloaded(_count, capacity))
+    {
+        capacity *= 2;
+    }
+    if (capacity > m_tags.size())
+    {
+        Rehash(capacity);
+    }
+}
+
+template <typename Value, typename Hash, typename Equal>
+void Vector3HashMap<Value, Hash, Equal>::Clear()
+{
+    std::fill(m_tags.begin(), m_tags.end(), EMPTY_TAG);
+    m_count = 0;
+}
+
+template <typename Value, typename Hash, typename Equal>
+std::pair<Value*, bool> Vector3HashMap<Value, Hash, Equal>::Insert(const Vector3& _key, const Value& _value)
+{
+    size_t hash = m_hash(_key);
+    uint32_t tag = GetTag(hash);
+    size_t slot = FindSlot(_key, hash, tag);
+    if (m_tags[slot] != EMPTY_TAG)
+    {
+        return { &m_values[slot], false };
+    }
+
+    if (IsOverloaded(m_count + 1, m_tags.size()))
+    {
+        Rehash(m_tags.size() * 2);
+        slot = FindSlot(_key, hash, tag);
+    }
+    m_tags[slot] = tag;
+    m_keys[slot] = _key;
+    m_values[slot] = _value;
+    ++m_count;
+    return { &m_values[slot], true };
+}
+
+template <typename Value, typename Hash, typename Equal>
+Value* Vector3HashMap<Value, Hash, Equal>::Find(const Vector3& _key)
+{
+    return const_cast<Value*>(static_cast<const Vector3HashMap&>(*this).Find(_key));
+}
+
+template <typename Value, typename Hash, typename Equal>
+const Value* Vector3HashMap<Value, Hash, Equal>::Find(const Vector3& _key) const
+{
+    size_t hash = m_hash(_key);
+    size_t slot = FindSlot(_key, hash, GetTag(hash));
+    return (m_tags[slot] != EMPTY_TAG) ? &m_values[slot] : nullptr;
+}
+
+template <typename Value, typename Hash, typename Equal>
+uint32_t Vector3HashMap<Value, Hash, Equal>::GetTag(size_t _hash)
+{
+    return (uint32_t)((uint64_t)_hash >> 32) | 1u;
+}
+
+template <typename Value, typename Hash, typename Equal>
+size_t Vector3HashMap<Value, Hash, Equal>::FindSlot(const Vector3& _key, size_t _hash, uint32_t _tag) const
+{
+    // Never more than 7/8 full, so there is always an empty slot to stop at
+    for (size_t slot = _hash & m_mask; ; slot = (slot + 1) & m_mask)
+    {
+        uint32_t slotTag = m_tags[slot];
+        if (slotTag == EMPTY_TAG || (slotTag == _tag && m_equal(m_keys[slot], _key)))
+        {
+            return slot;
+        }
+    }
+}
+
+template <typename Value, typename Hash, typename Equal>
+bool Vector3HashMap<Value, Hash, Equal>::IsOverloaded(size_t _count, size_t _capacity)
+{
+    return _count > _capacity - _capacity / 8;
+}
+
+template <typename Value, typename Hash, typename Equal>
+void Vector3HashMap<Value, Hash, Equal>::Rehash(size_t _capacity)
+{
+    std::vector<uint32_t> tags(_capacity, EMPTY_TAG);
+    std::vector<Vector3> keys(_capacity);
+    std::vector<Value> values(_capacity);
+    std::swap(tags, m_tags);
+    std::swap(keys, m_keys);
+    std::swap(values, m_values);
+    m_mask = _capacity - 1;
+
+    // Every key is already known to be unique, so each only needs the first empty slot
+    for (size_t i = 0; i < tags.size(); ++i)
+    {
+        if (tags[i] != EMPTY_TAG)
+        {
+            size_t slot = m_hash(keys[i]) & m_mask;
+            while (m_tags[slot] != EMPTY_TAG)
+            {
+                slot = (slot + 1) & m_mask;
+            }
+            m_tags[slot] = tags[i];
+            m_keys[slot] = keys[i];
+            m_values[slot] = std::move(values[i]);
+        }
+    }
+}
+
+
+
+// ~~~ Welding ~~~
+
+// @brief Merges vectors that share a grid cell _cellSize across. Each cell keeps the first vector that
+// landed in it.
+// @param _outUnique Replaced with the first vector in each cell, in the order they first appear.
+// @param _outIndices Replaced with, for each of _vectors, its index in _outUnique.
+void WeldVector3s(std::span<const Vector3> _vectors, float _cellSize, std::vector<Vector3>& _outUnique, std::vector<uint32_t>& _outIndices);
+
+
+
+#endif  //  __VECTOR3_HASH_MAP_H_
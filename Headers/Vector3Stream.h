@@ -0,0 +1,192 @@
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//             Vector3 Stream (h)
+//             Author: Christopher A
+//             Date: October 16, 2026
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//  Description:
+//
+//		Structure of arrays storage for whole arrays of Vector3 (positions,
+//      velocities, normals), plus batched kernels that work on them 8 (AVX2)
+//      or 4 (SSE2) vectors at a time.
+//
+//      - Vector3Stream owns separate x, y and z arrays, each 32 byte aligned
+//        and padded to a whole number of AVX2 registers.
+//      - Vector3StreamView / ConstVector3StreamView are non-owning x, y, z
+//        pointers with a stride. A stream views its own arrays with stride 1,
+//        and ViewVector3s() / ViewConstVector3s() view a std::vector<Vector3>
+//        in place with a stride of one Vector3, so the kernels can run on
+//        either without a copy.
+//        Strided views go through the scalar kernels; contiguous ones get SIMD.
+//      - Every kernel but normaliseFast gives bit for bit the same floats as
+//        the Vector3 operators would for each element.
+//
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+
+#ifndef     __VECTOR3_STREAM_H_
+#define     __VECTOR3_STREAM_H_
+
+
+#include <cstddef>
+#include <span>
+#include <vector>
+#include "Vector3.h"
+
+
+
+struct Vector3StreamView
+{
+    float* x;
+    float* y;
+    float* z;
+    size_t count;
+
+    // Distance between neighbouring elements, in floats
+    size_t stride;
+};
+
+
+struct ConstVector3StreamView
+{
+    const float* x;
+    const float* y;
+    const float* z;
+    size_t count;
+    size_t stride;
+
+    ConstVector3StreamView(const float* _x, const float* _y, const float* _z, size_t _count, size_t _stride)
+        : x(_x), y(_y), z(_z), count(_count), stride(_stride)
+    {
+    }
+
+    ConstVector3StreamView(const Vector3StreamView& _view)
+        : x(_view.x), y(_view.y), z(_view.z), count(_view.count), stride(_view.stride)
+    {
+    }
+};
+
+
+// @brief Views an array of Vector3 as x, y, z streams in place. Nothing is copied.
+Vector3StreamView ViewVector3s(std::span<Vector3> _vectors);
+ConstVector3StreamView ViewConstVector3s(std::span<const Vector3> _vectors);
+
+
+
+class Vector3Stream
+{
+public:
+    // Every array is padded to a multiple of this many floats, i.e. one AVX2 register
+    static const size_t LANE_COUNT = 8;
+
+    // @brief A stream of _count zero vectors.
+    explicit Vector3Stream(size_t _count = 0);
+
+    // @brief Transposes _vectors into a new stream.
+    explicit Vector3Stream(std::span<const Vector3> _vectors);
+    ~Vector3Stream();
+
+    Vector3Stream(const Vector3Stream&) = delete;
+    Vector3Stream& operator = (const Vector3Stream&) = delete;
+    Vector3Stream(Vector3Stream&& _other) noexcept;
+    Vector3Stream& operator = (Vector3Stream&& _other) noexcept;
+
+    size_t GetCount() const;
+
+    // @brief Keeps the first _count vectors. New vectors are zero. Allocates if the padded size grows.
+    void Resize(size_t _count);
+
+    Vector3 Get(size_t _index) const;
+    void Set(size_t _index, const Vector3& _vector);
+
+    float* GetX();
+    float* GetY();
+    float* GetZ();
+    const float* GetX() const;
+    const float* GetY() const;
+    const float* GetZ() const;
+
+    Vector3StreamView GetView();
+    ConstVector3StreamView GetView() const;
+
+    // ~~~ Conversion to and from Vector3 ~~~
+    // @brief Resizes to fit _vectors and transposes them in.
+    void Assign(std::span<const Vector3> _vectors);
+
+    // @brief Transposes the stream out into _outVectors, up to the size of either.
+    // @return Number of vectors written.
+    size_t CopyTo(std::span<Vector3> _outVectors) const;
+
+    std::vector<Vector3> ToVector3s() const;
+
+
+private:
+    static size_t GetPaddedCount(size_t _count);
+
+    // One 32 byte aligned block holding the x, y and z arrays back to back, m_paddedCount floats each.
+    // Padding floats are always 0.
+    float* m_block;
+    size_t m_count;
+    size_t m_paddedCount;
+};
+
+
+
+// ~~~ Kernels ~~~
+// Output views must hold at least as many elements as the inputs. Outputs may be the same as an input.
+
+enum Vector3StreamKernelSet
+{
+    VECTOR3_STREAM_SCALAR_KERNELS   = 0,
+    VECTOR3_STREAM_SSE2_KERNELS     = 1,
+    VECTOR3_STREAM_AVX2_KERNELS     = 2,
+};
+
+
+// One instruction set's version of every kernel. The SSE2 and AVX2 ones need contiguous (stride 1) views.
+struct Vector3StreamKernels
+{
+    const char* name;
+    void (*add)(ConstVector3StreamView _a, ConstVector3StreamView _b, Vector3StreamView _out);
+    void (*scale)(ConstVector3StreamView _a, float _scalar, Vector3StreamView _out);
+    void (*dot)(ConstVector3StreamView _a, ConstVector3StreamView _b, float* _outDots);
+    void (*cross)(ConstVector3StreamView _a, ConstVector3StreamView _b, Vector3StreamView _out);
+    void (*normalise)(ConstVector3StreamView _a, Vector3StreamView _out);
+    void (*normaliseFast)(ConstVector3StreamView _a, Vector3StreamView _out);
+    void (*length)(ConstVector3StreamView _a, float* _outLengths);
+    bool (*bounds)(ConstVector3StreamView _a, Vector3& _outMin, Vector3& _outMax);
+};
+
+
+// @return The kernels for _set, or nullptr if this CPU or build does not have that instruction set.
+const Vector3StreamKernels* GetVector3StreamKernels(Vector3StreamKernelSet _set);
+
+// The functions below pick the widest kernels this CPU supports, or the scalar ones for strided views.
+
+// @brief _out = _a + _b
+void AddVector3Streams(ConstVector3StreamView _a, ConstVector3StreamView _b, Vector3StreamView _out);
+
+// @brief _out = _a * _scalar
+void ScaleVector3Stream(ConstVector3StreamView _a, float _scalar, Vector3StreamView _out);
+
+// @brief _outDots[i] = _a[i].Dot(_b[i])
+void DotVector3Streams(ConstVector3StreamView _a, ConstVector3StreamView _b, float* _outDots);
+
+// @brief _out = _a.Cross(_b)
+void CrossVector3Streams(ConstVector3StreamView _a, ConstVector3StreamView _b, Vector3StreamView _out);
+
+// @brief _out = _a.Normalised(). Vectors too short to normalise come out as zero.
+void NormaliseVector3Stream(ConstVector3StreamView _a, Vector3StreamView _out);
+
+// @brief _out = _a.NormalisedFast(), about 1e-6 relative error. The SIMD kernels use rsqrtps, so the
+// exact bits can differ between them and from Vector3::NormalisedFast.
+void NormaliseVector3StreamFast(ConstVector3StreamView _a, Vector3StreamView _out);
+
+// @brief _outLengths[i] = _a[i].Magnitude()
+void GetVector3StreamLengths(ConstVector3StreamView _a, float* _outLengths);
+
+// @brief Componentwise min and max over the whole stream.
+// @return false, leaving the outputs alone, if the stream is empty.
+bool GetVector3StreamBounds(ConstVector3StreamView _a, Vector3& _outMin, Vector3& _outMax);
+
+
+
+#endif  //  __VECTOR3_STREAM_H_
@@ -0,0 +1,91 @@
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//             Vector Division Policy (h)
+//             Author: Christopher A
+//             Date: October 16, 2026
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//  Description:
+//
+//		What Vector3 and Vector<N, T> do when divided by a scalar within
+//      EPSILON of zero. Divide<Policy>() picks one per call; operator / and
+//      operator /= use VECTOR_DIVISION_DEFAULT_POLICY, which can be set for
+//      the whole build, e.g. /DVECTOR_DIVISION_DEFAULT_POLICY=VECTOR_DIVISION_SATURATE.
+//
+//      - UNCHECKED: a plain divide. Floats give inf / NaN, integers are UB.
+//      - ASSERT:    UNCHECKED plus an assert. The default without NDEBUG.
+//      - SATURATE:  the result is zero, selected without a branch.
+//
+//      Release builds default to UNCHECKED so a divide is just divps.
+//
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+
+#ifndef     __VECTOR_DIVISION_POLICY_H_
+#define     __VECTOR_DIVISION_POLICY_H_
+
+
+#ifndef EPSILON
+#define EPSILON 0.0000001
+#endif
+
+
+#include <bit>
+#include <cassert>
+#include <cstdint>
+#include "ConstexprMath.h"
+
+
+
+enum VectorDivisionPolicy
+{
+    VECTOR_DIVISION_UNCHECKED   = 0,
+    VECTOR_DIVISION_ASSERT      = 1,
+    VECTOR_DIVISION_SATURATE    = 2,
+};
+
+#ifndef VECTOR_DIVISION_DEFAULT_POLICY
+#ifdef NDEBUG
+#define VECTOR_DIVISION_DEFAULT_POLICY VECTOR_DIVISION_UNCHECKED
+#else
+#define VECTOR_DIVISION_DEFAULT_POLICY VECTOR_DIVISION_ASSERT
+#endif
+#endif
+
+
+// @brief false for divisors within EPSILON of zero, and for NaN.
+template <typename T>
+constexpr bool IsSafeVectorDivisor(T _scalar)
+{
+    return ConstexprAbs(_scalar) >= EPSILON;
+}
+
+
+// @brief EPSILON as a float: the smallest float at or above it. For a float d, d >= EPSILON and d >= this
+// are the same test, so SIMD code can check divisors and Vector3 equality in floats without changing any result.
+constexpr float GetEpsilonAsFloat()
+{
+    float threshold = (float)EPSILON;
+    if ((double)threshold < EPSILON)
+    {
+        // Next float up; threshold is positive, so that is the next bit pattern
+        threshold = std::bit_cast<float>(std::bit_cast<uint32_t>(threshold) + 1u);
+    }
+    return threshold;
+}
+
+static_assert(IsSafeVectorDivisor(GetEpsilonAsFloat()), "GetEpsilonAsFloat must be a safe divisor");
+static_assert(IsSafeVectorDivisor(std::bit_cast<float>(std::bit_cast<uint32_t>(GetEpsilonAsFloat()) - 1u)) == false,
+                "GetEpsilonAsFloat must be the smallest safe divisor");
+
+
+// @brief Asserts _scalar is a safe divisor under the ASSERT policy, does nothing otherwise.
+template <VectorDivisionPolicy Policy, typename T>
+constexpr void CheckVectorDivisor([[maybe_unused]] T _scalar)
+{
+    if constexpr (Policy == VECTOR_DIVISION_ASSERT)
+    {
+        assert(IsSafeVectorDivisor(_scalar) && "Vector divided by (nearly) zero");
+    }
+}
+
+
+
+#endif  //  __VECTOR_DIVISION_POLICY_H_
@@ -0,0 +1,76 @@
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//             Vector Dot Kernels (h)
+//             Author: Christopher A
+//             Date: October 16, 2026
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//  Description:
+//
+//		Dot products of long float arrays, for high dimensional Vector<N, float>
+//      such as 128 or 256 component embeddings. Vector<N, float>::Dot and
+//      MagnitudeSqr call these for N >= VECTOR_DOT_KERNEL_MIN_COMPONENTS.
+//
+//      - Each kernel keeps several independent accumulators, so the adds do
+//        not wait on each other, and picks the widest of scalar, SSE2 and
+//        AVX2 + FMA the CPU has.
+//      - The sum is reassociated, so the result can differ in the last bits
+//        from a plain left to right loop, and between kernel sets.
+//        Within one kernel set, dot and dotBatch give the same bits.
+//      - dotAccurate widens to double. float products are exact in double,
+//        so only the sum is rounded, 29 bits finer than in float.
+//      - dotBatch dots one query against many rows, e.g. a nearest
+//        neighbour scan, loading the query once for every pair of rows.
+//
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+
+#ifndef     __VECTOR_DOT_KERNELS_H_
+#define     __VECTOR_DOT_KERNELS_H_
+
+
+#include <cstddef>
+
+
+// Shorter float vectors keep the inline loop, which beats a call at these sizes
+#ifndef VECTOR_DOT_KERNEL_MIN_COMPONENTS
+#define VECTOR_DOT_KERNEL_MIN_COMPONENTS 32
+#endif
+
+
+
+enum VectorDotKernelSet
+{
+    DOT_SCALAR_KERNELS      = 0,
+    DOT_SSE2_KERNELS        = 1,
+    DOT_AVX2_FMA_KERNELS    = 2,
+};
+
+
+// One instruction set's version of every kernel
+struct VectorDotKernels
+{
+    const char* name;
+    float (*dot)(const float* _a, const float* _b, size_t _count);
+    float (*dotAccurate)(const float* _a, const float* _b, size_t _count);
+
+    // _outDots[i] = dot(_query, _rows + i * _rowStride, _count) for i in [0, _rowCount)
+    void (*dotBatch)(const float* _query, const float* _rows, size_t _count, size_t _rowCount, size_t _rowStride, float* _outDots);
+};
+
+
+// @return The kernels for _set, or nullptr if this CPU or build does not have that instruction set.
+const VectorDotKernels* GetVectorDotKernels(VectorDotKernelSet _set);
+
+// The functions below use the widest kernels this CPU supports.
+
+// @brief Sum of _a[i] * _b[i] over _count floats.
+float DotFloats(const float* _a, const float* _b, size_t _count);
+
+// @brief DotFloats summed in double, for long or badly conditioned sums.
+float DotFloatsAccurate(const float* _a, const float* _b, size_t _count);
+
+// @brief _outDots[i] = DotFloats(_query, _rows + i * _rowStride, _count) for i in [0, _rowCount).
+// _rowStride is in floats and must be at least _count.
+void DotFloatsBatch(const float* _query, const float* _rows, size_t _count, size_t _rowCount, size_t _rowStride, float* _outDots);
+
+
+
+#endif  //  __VECTOR_DOT_KERNELS_H_
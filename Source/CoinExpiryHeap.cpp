@@ -0,0 +1,256 @@
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//             Coin Expiry Heap (cpp)
+//             Author: Christopher A
+//             Date: October 16, 2026
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//  Description:
+//
+//		Binary min-heap of pool slots ordered by the frame they expire on, used
+//      by the CoinObjectPool's RECYCLE_SOONEST_EXPIRING exhaustion policy.
+//
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <algorithm>
+#include <cstring>
+#include "CoinExpiryHeap.h"
+
+
+
+// @param _slotCapacity Slot indices pushed must be below this.
+CoinExpiryHeap::CoinExpiryHeap(size_t _slotCapacity)
+{
+    Reset(_slotCapacity);
+}
+
+// @brief Empties the heap and sizes it for _slotCapacity slots. Allocates.
+void CoinExpiryHeap::Reset(size_t _slotCapacity)
+{
+    m_entries.clear();
+    m_entries.reserve(_slotCapacity);
+    m_indexOfSlot.assign(_slotCapacity, -1);
+    m_seenSlotBits.assign((_slotCapacity + 63) / 64, 0);
+}
+
+// @brief Makes room for slots up to _slotCapacity, keeping everything already in the heap. Allocates.
+void CoinExpiryHeap::Grow(size_t _slotCapacity)
+{
+    m_entries.reserve(_slotCapacity);
+    m_indexOfSlot.resize(_slotCapacity, -1);
+    m_seenSlotBits.resize((_slotCapacity + 63) / 64, 0);
+}
+
+// @brief Adds a slot in O(log n). The slot must not already be in the heap.
+void CoinExpiryHeap::Push(uint32_t _slot, unsigned int _expiryFrame)
+{
+    m_entries.push_back(Entry{ _expiryFrame, _slot });
+    m_indexOfSlot[_slot] = (int32_t)(m_entries.size() - 1);
+    SiftUp(m_entries.size() - 1);
+}
+
+// @brief Adds several slots that all expire on the same frame. None may already be in the heap.
+// A batch at least as big as the heap already is rebuilds it in O(n) instead of sifting each one up.
+void CoinExpiryHeap::PushBatch(std::span<const uint32_t> _slots, unsigned int _expiryFrame)
+{
+    const size_t oldCount = m_entries.size();
+    for (uint32_t slot : _slots)
+    {
+        m_indexOfSlot[slot] = (int32_t)m_entries.size();
+        m_entries.push_back(Entry{ _expiryFrame, slot });
+    }
+
+    if (_slots.size() >= oldCount)
+    {
+        for (size_t i = m_entries.size() / 2; i-- > 0;)
+        {
+            SiftDown(i);
+        }
+        return;
+    }
+
+    for (size_t i = oldCount; i < m_entries.size(); ++i)
+    {
+        SiftUp(i);
+    }
+}
+
+// @brief Takes a slot out in O(log n), wherever it sits. The slot must be in the heap.
+void CoinExpiryHeap::Remove(uint32_t _slot)
+{
+    size_t index = (size_t)m_indexOfSlot[_slot];
+    m_indexOfSlot[_slot] = -1;
+
+    Entry lastEntry = m_entries.back();
+    m_entries.pop_back();
+    if (index == m_entries.size())
+    {
+        return;
+    }
+
+    // The last entry fills the hole and may belong either above or below it
+    Place(index, lastEntry);
+    if (index > 0 && IsSooner(lastEntry, m_entries[(index - 1) / 2]))
+    {
+        SiftUp(index);
+    }
+    else
+    {
+        SiftDown(index);
+    }
+}
+
+// @brief Slot with the earliest expiry frame. The heap must not be empty.
+uint32_t CoinExpiryHeap::GetSoonestSlot() const
+{
+    return m_entries[0].slot;
+}
+
+bool CoinExpiryHeap::IsEmpty() const
+{
+    return m_entries.empty();
+}
+
+size_t CoinExpiryHeap::GetCount() const
+{
+    return m_entries.size();
+}
+
+
+size_t CoinExpiryHeap::GetMaxSnapshotSize() const
+{
+    return sizeof(uint32_t) + sizeof(Entry) * m_indexOfSlot.size();
+}
+
+void CoinExpiryHeap::WriteSnapshot(SnapshotWriter& _writer) const
+{
+    _writer.WriteValue<uint32_t>((uint32_t)m_entries.size());
+    _writer.Write(m_entries.data(), sizeof(Entry) * m_entries.size());
+}
+
+// @brief Steps over what ReadSnapshot() would read, checking it without changing anything. Every
+// slot must be in range and appear once, and every entry must expire no sooner than its parent.
+// @return false if the data is malformed.
+bool CoinExpiryHeap::ValidateSnapshot(SnapshotReader& _reader) const
+{
+    size_t count = _reader.ReadValue<uint32_t>();
+    const std::byte* entryBytes = _reader.Take(sizeof(Entry) * count);
+    if (entryBytes == nullptr || count > m_indexOfSlot.size())
+    {
+        return false;
+    }
+
+    // A repeated slot would leave m_indexOfSlot pointing at only one of its entries, and an entry
+    // sooner than its parent would hide from GetSoonestSlot()
+    std::fill(m_seenSlotBits.begin(), m_seenSlotBits.end(), 0);
+    for (size_t i = 0; i < count; ++i)
+    {
+        Entry entry;
+        std::memcpy(&entry, entryBytes + sizeof(Entry) * i, sizeof(Entry));
+        if (entry.slot >= m_indexOfSlot.size())
+        {
+            return false;
+        }
+
+        uint64_t& seenWord = m_seenSlotBits[entry.slot / 64];
+        const uint64_t seenBit = uint64_t(1) << (entry.slot % 64);
+        if ((seenWord & seenBit) != 0)
+        {
+            return false;
+        }
+        seenWord |= seenBit;
+
+        if (i > 0)
+        {
+            Entry parent;
+            std::memcpy(&parent, entryBytes + sizeof(Entry) * ((i - 1) / 2), sizeof(Entry));
+            if (IsSooner(entry, parent))
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// @return false if the data is malformed.
+bool CoinExpiryHeap::ReadSnapshot(SnapshotReader& _reader)
+{
+    size_t count = _reader.ReadValue<uint32_t>();
+    const std::byte* entryBytes = _reader.Take(sizeof(Entry) * count);
+    if (entryBytes == nullptr || count > m_indexOfSlot.size())
+    {
+        return false;
+    }
+
+    // Space for every slot was reserved up front, so this never allocates
+    m_entries.resize(count);
+    if (count > 0)
+    {
+        std::memcpy(m_entries.data(), entryBytes, sizeof(Entry) * count);
+    }
+    std::fill(m_indexOfSlot.begin(), m_indexOfSlot.end(), -1);
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (m_entries[i].slot >= m_indexOfSlot.size())
+        {
+            return false;
+        }
+        m_indexOfSlot[m_entries[i].slot] = (int32_t)i;
+    }
+    return true;
+}
+
+
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//              Private
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+void CoinExpiryHeap::SiftUp(size_t _index)
+{
+    // Parents are moved down into the hole rather than swapped, and the entry is written once at the end
+    Entry entry = m_entries[_index];
+    while (_index > 0)
+    {
+        size_t parentIndex = (_index - 1) / 2;
+        if (IsSooner(entry, m_entries[parentIndex]) == false)
+        {
+            break;
+        }
+
+        Place(_index, m_entries[parentIndex]);
+        _index = parentIndex;
+    }
+    Place(_index, entry);
+}
+
+void CoinExpiryHeap::SiftDown(size_t _index)
+{
+    Entry entry = m_entries[_index];
+    const size_t count = m_entries.size();
+    for (;;)
+    {
+        size_t childIndex = _index * 2 + 1;
+        if (childIndex >= count)
+        {
+            break;
+        }
+
+        if (childIndex + 1 < count && IsSooner(m_entries[childIndex + 1], m_entries[childIndex]))
+        {
+            ++childIndex;
+        }
+
+        if (IsSooner(m_entries[childIndex], entry) == false)
+        {
+            break;
+        }
+
+        Place(_index, m_entries[childIndex]);
+        _index = childIndex;
+    }
+    Place(_index, entry);
+}
+
+void CoinExpiryHeap::Place(size_t _index, const Entry& _entry)
+{
+    m_entries[_index] = _entry;
+    m_indexOfSlot[_entry.slot] = (int32_t)_index;
+}
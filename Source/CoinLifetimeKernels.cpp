@@ -0,0 +1,116 @@
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//             Coin Lifetime Kernels (cpp)
+//             Author: Christopher A
+//             Date: October 16, 2026
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//  Description:
+//
+//		Bulk lifetime update used by the CoinObjectPool's DENSE_SWEEP expiry
+//      mode. See the header for what every kernel computes.
+//
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <bit>
+#include "CoinLifetimeKernels.h"
+
+#ifdef COIN_LIFETIME_KERNELS_X86
+#include <immintrin.h>
+#endif
+
+
+
+// @brief Appends _base + i for every bit i set in _mask, lowest bit first.
+static inline size_t AppendExpiredIndices(uint32_t _mask, uint32_t _base, uint32_t* _outExpiredIndices, size_t _expiredCount)
+{
+    // Most frames only a handful of coins expire, so the mask is usually zero and this loop never runs
+    while (_mask != 0)
+    {
+        _outExpiredIndices[_expiredCount++] = _base + (uint32_t)std::countr_zero(_mask);
+        _mask &= _mask - 1;
+    }
+    return _expiredCount;
+}
+
+
+size_t DecrementLifetimesScalar(int32_t* _lifetimes, size_t _count, uint32_t* _outExpiredIndices)
+{
+    size_t expiredCount = 0;
+    for (size_t i = 0; i < _count; ++i)
+    {
+        if (--_lifetimes[i] <= 0)
+        {
+            _outExpiredIndices[expiredCount++] = (uint32_t)i;
+        }
+    }
+    return expiredCount;
+}
+
+
+
+#ifdef COIN_LIFETIME_KERNELS_X86
+size_t DecrementLifetimesSSE2(int32_t* _lifetimes, size_t _count, uint32_t* _outExpiredIndices)
+{
+    const __m128i one = _mm_set1_epi32(1);
+    size_t expiredCount = 0;
+    size_t i = 0;
+    for (; i + 4 <= _count; i += 4)
+    {
+        __m128i lifetimes = _mm_sub_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(_lifetimes + i)), one);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(_lifetimes + i), lifetimes);
+
+        // lifetime <= 0 is the same as 1 > lifetime, and there is no "less or equal" compare
+        uint32_t expiredMask = (uint32_t)_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(one, lifetimes)));
+        expiredCount = AppendExpiredIndices(expiredMask, (uint32_t)i, _outExpiredIndices, expiredCount);
+    }
+
+    for (; i < _count; ++i)
+    {
+        if (--_lifetimes[i] <= 0)
+        {
+            _outExpiredIndices[expiredCount++] = (uint32_t)i;
+        }
+    }
+    return expiredCount;
+}
+
+
+CPU_TARGET_AVX2
+size_t DecrementLifetimesAVX2(int32_t* _lifetimes, size_t _count, uint32_t* _outExpiredIndices)
+{
+    const __m256i one = _mm256_set1_epi32(1);
+    size_t expiredCount = 0;
+    size_t i = 0;
+    for (; i + 8 <= _count; i += 8)
+    {
+        __m256i lifetimes = _mm256_sub_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(_lifetimes + i)), one);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(_lifetimes + i), lifetimes);
+
+        uint32_t expiredMask = (uint32_t)_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(one, lifetimes)));
+        expiredCount = AppendExpiredIndices(expiredMask, (uint32_t)i, _outExpiredIndices, expiredCount);
+    }
+
+    for (; i < _count; ++i)
+    {
+        if (--_lifetimes[i] <= 0)
+        {
+            _outExpiredIndices[expiredCount++] = (uint32_t)i;
+        }
+    }
+    return expiredCount;
+}
+#endif
+
+
+
+// @brief Runs the fastest kernel this CPU supports. The choice is made once, on the first call.
+size_t DecrementLifetimes(int32_t* _lifetimes, size_t _count, uint32_t* _outExpiredIndices)
+{
+    typedef size_t (*DecrementLifetimesKernel)(int32_t*, size_t, uint32_t*);
+
+#ifdef COIN_LIFETIME_KERNELS_X86
+    static const DecrementLifetimesKernel s_kernel = IsAVX2Supported() ? &DecrementLifetimesAVX2 : &DecrementLifetimesSSE2;
+#else
+    static const DecrementLifetimesKernel s_kernel = &DecrementLifetimesScalar;
+#endif
+
+    return s_kernel(_lifetimes, _count, _outExpiredIndices);
+}
@@ -29,53 +29,90 @@
 //      }
 //
 //=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <algorithm>
+#include <cstring>
 #include <iostream>
+#include "CoinLifetimeKernels.h"
 #include "CoinObjectPool.h"
 
 
+// @brief Clamps the requested pool size to what a CoinHandle can address.
+static size_t GetAddressablePoolSize(int _poolSize)
+{
+    if (_poolSize <= 0)
+    {
+        return 0;
+    }
+
+    if ((uint32_t)_poolSize > CoinHandle::INDEX_MASK)
+    {
+        std::cerr << "Warning: Coin pool size " << _poolSize << " is too large for a CoinHandle. Clamping to " << CoinHandle::INDEX_MASK << "." << std::endl;
+        return CoinHandle::INDEX_MASK;
+    }
+    return (size_t)_poolSize;
+}
+
 
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 //              Coin
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-Coin::Coin() 
-    : m_remainingLifetimeFrames(0)
+Coin::Coin(const std::atomic<unsigned int>* _frameClock, unsigned int _spawnFrame, int _lifetimeFrames, const Vector3& _position)
+    : m_position(_position),
+      m_spawnFrame(_spawnFrame),
+      m_lifetimeFrames(_lifetimeFrames),
+      m_frameClock(_frameClock),
+      m_wheelPrev(NO_SLOT),
+      m_wheelNext(NO_SLOT),
+      m_wheelBucket(0)
 {
 }
 
-void Coin::Activate(int _maxFrames)
+void Coin::Deactivate()
 {
-    m_remainingLifetimeFrames = _maxFrames;
+    m_lifetimeFrames = 0;
 }
 
-void Coin::Deactivate()
+CoinState Coin::GetState() const
+{
+    if (m_lifetimeFrames < 1)
+    {
+        return CoinState::FREE;
+    }
+
+    if (GetRemainingLifetimeFrames() < 1)
+    {
+        return CoinState::FREED;
+    }
+
+    return CoinState::ACTIVE;
+}
+
+bool Coin::GetIsActive() const
 {
-    m_remainingLifetimeFrames = 0;
+    return GetRemainingLifetimeFrames() > 0;
 }
 
-CoinState Coin::Update()
+int Coin::GetRemainingLifetimeFrames() const
 {
-    if (m_remainingLifetimeFrames > 0)
+    if (m_frameClock == nullptr || m_lifetimeFrames < 1)
     {
-        --m_remainingLifetimeFrames;
-        if (m_remainingLifetimeFrames < 1)
-        {
-            return CoinState::FREED;
-        }
-        
-        return CoinState::ACTIVE;
+        return 0;
     }
 
-    return CoinState::FREE;
+    // Unsigned subtraction keeps this correct even when the frame counter wraps around
+    int elapsedFrames = (int)(m_frameClock->load(std::memory_order_relaxed) - m_spawnFrame);
+    int remainingFrames = m_lifetimeFrames - elapsedFrames;
+    return (remainingFrames > 0) ? remainingFrames : 0;
 }
 
-bool Coin::GetIsActive()
+const Vector3& Coin::GetPosition() const
 {
-    return m_remainingLifetimeFrames > 0;
+    return m_position;
 }
 
-int Coin::GetRemainingLifetimeFrames()
+unsigned int Coin::GetExpiryFrame() const
 {
-    return m_remainingLifetimeFrames;
+    return m_spawnFrame + (unsigned int)m_lifetimeFrames;
 }
 
 
@@ -85,106 +122,1349 @@ int Coin::GetRemainingLifetimeFrames()
 //              Coin Object Pool
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 // @brief Constructor for the CoinObjectPool.
-// @param _poolSize The total number of coins to pre-allocate.
-CoinObjectPool::CoinObjectPool(int _poolSize)
+// @param _poolSize The total number of coins to pre-allocate. At most CoinHandle::INDEX_MASK.
+// @param _threading Whether coins may be spawned and released from several threads at once.
+// @param _gridCellSize Cell size of the pickup grid. Around the usual pickup radius works best.
+// @param _expiryMode How Update() finds the coins whose lifetime ran out.
+CoinObjectPool::CoinObjectPool(int _poolSize, CoinPoolThreading _threading, float _gridCellSize, CoinExpiryMode _expiryMode)
+    : m_threading(_threading),
+      m_expiryMode(_expiryMode),
+      m_exhaustionPolicy(CoinExhaustionPolicy::FAIL_SPAWN),
+      m_coins(GetAddressablePoolSize(_poolSize)),
+      m_concurrentFreeSlots((_threading == CoinPoolThreading::CONCURRENT) ? m_coins.GetCapacity() : 0),
+      m_pendingSpawns((_threading == CoinPoolThreading::CONCURRENT) ? m_coins.GetCapacity() : 0),
+      m_pendingReleases((_threading == CoinPoolThreading::CONCURRENT) ? m_coins.GetCapacity() : 0),
+      m_slotStates(m_coins.GetCapacity()),
+      m_expiryWheel(EXPIRY_WHEEL_SIZE, Coin::NO_SLOT),
+      m_remainingFrames((_expiryMode == CoinExpiryMode::DENSE_SWEEP) ? m_coins.GetCapacity() : 0),
+      m_expiredActiveIndices((_expiryMode == CoinExpiryMode::DENSE_SWEEP) ? m_coins.GetCapacity() : 0),
+      m_expiryHeap(0),
+      m_spatialGrid(m_coins.GetCapacity(), _gridCellSize),
+      m_dirtySlots(m_coins.GetCapacity()),
+      m_lastSnapshotSequence(0),
+      m_baseSnapshotSequence(0),
+      m_currentFrame(0),
+      m_telemetry(),
+      m_frameSpawns(0),
+      m_frameReleases(0),
+      m_frameExpiries(0),
+      m_exhaustionCount(0)
 {
-    m_allCoins.reserve(_poolSize);
-    m_freeCoins.reserve(_poolSize);
-    m_activeCoins.reserve(_poolSize);
-
-    for (int i = 0; i < _poolSize; ++i)
+    if (m_threading == CoinPoolThreading::CONCURRENT)
     {
-        m_allCoins.emplace_back();
-        m_freeCoins.push_back(&m_allCoins.back());
+        // Hand every free slot over to the lock-free stack, linked up front so it goes across in one push
+        uint32_t firstSlot = LockFreeSlotStack::EMPTY;
+        uint32_t lastSlot = LockFreeSlotStack::EMPTY;
+        uint32_t slot = 0;
+        while (m_coins.TryAcquireSlot(slot))
+        {
+            if (firstSlot == LockFreeSlotStack::EMPTY)
+            {
+                firstSlot = slot;
+            }
+            else
+            {
+                m_concurrentFreeSlots.SetNext(lastSlot, slot);
+            }
+            lastSlot = slot;
+        }
+
+        if (firstSlot != LockFreeSlotStack::EMPTY)
+        {
+            m_concurrentFreeSlots.PushChain(firstSlot, lastSlot, m_coins.GetCapacity());
+        }
     }
 }
 
 CoinObjectPool::~CoinObjectPool()
 {
-    // Since all coins are managed by std::vector we don't have any memory management we need to clear here.
+    // Coin memory is owned by m_coins, which destroys whatever is still active. Coins other threads
+    // spawned since the last Update() have to be registered first so they are included.
+    if (m_threading == CoinPoolThreading::CONCURRENT)
+    {
+        ProcessPendingCoins();
+    }
 }
 
 
 // @brief Acquires an inactive coin from the pool.
+// Lock-free in CONCURRENT mode. The coin is usable straight away, but only joins the active
+// list (and starts counting towards GetActiveCoinCount) at the next Update().
 // @param _lifetimeFrames Number of Frames the coin will exist for before dying of """natural causes""".
-// @return A pointer to an active Coin object, or nullptr if the pool is exhausted.
-Coin* CoinObjectPool::TrySpawnCoin(int _lifetimeFrames)
+//                        Values below 1 are treated as 1.
+// @param _position Where the coin sits in the world, for CollectCoinsInRadius.
+// @return A handle to the new coin, or an invalid handle if the pool is exhausted and the
+//         exhaustion policy could not make room.
+CoinHandle CoinObjectPool::TrySpawnCoin(int _lifetimeFrames, const Vector3& _position)
 {
-    if (m_freeCoins.empty())
+    // A coin with no lifetime would never come up in the expiry wheel, so it always lives for at least one frame
+    if (_lifetimeFrames < 1)
     {
-        std::cerr << "Warning: Coin pool exhausted! Cannot acquire more coins." << std::endl;
-        return nullptr;
+        _lifetimeFrames = 1;
+    }
+
+    if (m_threading == CoinPoolThreading::CONCURRENT)
+    {
+        return TrySpawnCoinConcurrent(_lifetimeFrames, _position);
     }
 
-    // Get a coin from the free list. Fetching from back to avoid vector element swapping overhead
-    Coin* coin = m_freeCoins.back();
-    m_freeCoins.pop_back();
+    if (m_coins.GetFreeCount() == 0 && TryMakeRoom(1) == false)
+    {
+        RecordExhaustion();
+        return CoinHandle();
+    }
 
-    coin->Activate(_lifetimeFrames);
-    m_activeCoins.push_back(coin);
+    uint32_t slot = 0;
+    m_coins.TryAcquireSlot(slot);
+    m_coins.ConstructInSlot(slot, &m_currentFrame, m_currentFrame.load(std::memory_order_relaxed), _lifetimeFrames, _position);
+    RegisterSlot(slot);
 
-    return coin;
+    return ActivateSlotState(slot);
 }
 
 
-// @brief Releases an active coin back to the pool.
+// @brief Releases an active coin back to the pool in O(1).
 // This happens when the player collects it, or when its lifetime expires.
-// @param coin A pointer to the Coin object to release. Must not be nullptr.
-void CoinObjectPool::ReleaseCoin(Coin* _coin) 
+// Lock-free in CONCURRENT mode, where the coin's slot becomes reusable at the next Update().
+// @return false if the handle is stale (the coin was already released or expired) or invalid.
+bool CoinObjectPool::ReleaseCoin(CoinHandle _handle)
 {
-    if (_coin == nullptr)
+    if (m_threading == CoinPoolThreading::CONCURRENT)
     {
-        std::cerr << "Error: Attempted to release a nullptr coin." << std::endl;
-        return;
+        return ReleaseCoinConcurrent(_handle);
+    }
+
+    // A stale handle's generation no longer matches the slot's, so it cannot release the slot's new coin
+    if (Resolve(_handle) == nullptr)
+    {
+        return false;
+    }
+
+    uint32_t slot = _handle.GetSlot();
+    RecycleSlot(slot, false);
+    m_coins.ReturnSlot(slot);
+    return true;
+}
+
+
+// @brief Spawns a burst of coins (e.g. a boss dying) in one go.
+// Slots move between the free and active lists as whole ranges rather than one at a time, the
+// burst joins its expiry wheel bucket and grid cell as one chain, and in CONCURRENT mode the
+// whole batch costs a couple of compare-exchanges.
+// @param _count Number of coins wanted. Capped at the size of _outHandles.
+// @param _outHandles Receives one handle per spawned coin, from the front.
+// @param _position Where the whole burst is spawned.
+// @return Number of coins spawned. The exhaustion policy only steps in when it can make room for
+//         every coin that is missing; otherwise the burst is filled from the free coins alone.
+size_t CoinObjectPool::TrySpawnCoins(size_t _count, int _lifetimeFrames, std::span<CoinHandle> _outHandles,
+                                     CoinBatchFill _fill, const Vector3& _position)
+{
+    if (_lifetimeFrames < 1)
+    {
+        _lifetimeFrames = 1;
+    }
+
+    if (_count > _outHandles.size())
+    {
+        _count = _outHandles.size();
+    }
+
+    if (m_threading == CoinPoolThreading::CONCURRENT)
+    {
+        return TrySpawnCoinsConcurrent(_count, _lifetimeFrames, _outHandles, _fill, _position);
+    }
+
+    if (m_coins.GetFreeCount() < _count && TryMakeRoom(_count - m_coins.GetFreeCount()) == false)
+    {
+        RecordExhaustion();
+        if (_fill == CoinBatchFill::ALL_OR_NOTHING)
+        {
+            return 0;
+        }
+    }
+
+    std::span<const uint32_t> slots = m_coins.AcquireSlots(_count);
+    if (slots.empty())
+    {
+        return 0;
+    }
+
+    // Every coin in the burst shares a spawn frame, lifetime and position. One pass builds the coins and
+    // chains them together in the order they will sit in the expiry wheel bucket, and the chain is then
+    // spliced into the bucket, the heap and the grid cell in one step each.
+    unsigned int spawnFrame = m_currentFrame.load(std::memory_order_relaxed);
+    unsigned int expiryFrame = spawnFrame + (unsigned int)_lifetimeFrames;
+    const bool isOnWheel = (m_expiryMode == CoinExpiryMode::TIMING_WHEEL);
+    const uint32_t wheelBucket = expiryFrame & EXPIRY_WHEEL_MASK;
+    const size_t lastIndex = slots.size() - 1;
+    for (size_t i = 0; i < slots.size(); ++i)
+    {
+        Coin* coin = m_coins.ConstructInSlot(slots[i], &m_currentFrame, spawnFrame, _lifetimeFrames, _position);
+        if (isOnWheel)
+        {
+            coin->m_wheelBucket = wheelBucket;
+            coin->m_wheelPrev = (i > 0) ? slots[i - 1] : Coin::NO_SLOT;
+            coin->m_wheelNext = (i < lastIndex) ? slots[i + 1] : Coin::NO_SLOT;
+        }
+        m_dirtySlots.Mark(slots[i]);
+        _outHandles[i] = ActivateSlotState(slots[i]);
     }
 
-    _coin->Deactivate();
+    size_t firstActiveIndex = m_coins.GetActiveCount();
+    m_coins.ActivateSlots(slots);
 
-    auto it = std::find(m_activeCoins.begin(), m_activeCoins.end(), _coin);
-    if (it != m_activeCoins.end())
+    if (isOnWheel)
     {
-        // Swap with last element and pop_back for O(1) removal. The order of the coins in
-        // this list is not important at all, so swapping has no problems. Then re-add to Free Coins list
-        std::swap(*it, m_activeCoins.back());
-        m_activeCoins.pop_back();
-        m_freeCoins.push_back(_coin);
+        uint32_t& bucketHead = m_expiryWheel[wheelBucket];
+        m_coins.GetSlot(slots[lastIndex])->m_wheelNext = bucketHead;
+        if (bucketHead != Coin::NO_SLOT)
+        {
+            m_coins.GetSlot(bucketHead)->m_wheelPrev = slots[lastIndex];
+            m_dirtySlots.Mark(bucketHead);
+        }
+        bucketHead = slots[0];
     }
     else
     {
-        std::cerr << "Error: Coin to release not found in activeCoins list. Pool integrity issue." << std::endl;
+        std::fill_n(m_remainingFrames.begin() + firstActiveIndex, slots.size(), (int32_t)_lifetimeFrames);
+    }
+
+    if (m_exhaustionPolicy == CoinExhaustionPolicy::RECYCLE_SOONEST_EXPIRING)
+    {
+        m_expiryHeap.PushBatch(slots, expiryFrame);
+    }
+    m_spatialGrid.InsertBatch(slots, _position);
+    RecordSpawns(slots.size());
+
+    return slots.size();
+}
+
+
+// @brief Releases several coins in one go. Stale and invalid handles are skipped.
+// @return Number of coins released.
+size_t CoinObjectPool::ReleaseCoins(std::span<const CoinHandle> _handles)
+{
+    if (m_threading == CoinPoolThreading::CONCURRENT)
+    {
+        return ReleaseCoinsConcurrent(_handles);
+    }
+
+    // Freed slots are gathered up and pushed back onto the free stack a chunk at a time
+    uint32_t freedSlots[BATCH_CHUNK_SIZE];
+    size_t freedCount = 0;
+    size_t releasedCount = 0;
+    for (CoinHandle handle : _handles)
+    {
+        // Also catches the same handle appearing twice, since the first release moves the generation on
+        if (Resolve(handle) == nullptr)
+        {
+            continue;
+        }
+
+        RecycleSlot(handle.GetSlot(), false);
+        freedSlots[freedCount++] = handle.GetSlot();
+        if (freedCount == BATCH_CHUNK_SIZE)
+        {
+            m_coins.ReturnSlots(std::span<const uint32_t>(freedSlots, freedCount));
+            releasedCount += freedCount;
+            freedCount = 0;
+        }
+    }
+
+    m_coins.ReturnSlots(std::span<const uint32_t>(freedSlots, freedCount));
+    return releasedCount + freedCount;
+}
+
+
+// @brief Looks the coin up in O(1).
+// @return The coin, or nullptr if the handle is stale or invalid. In CONCURRENT mode the pointer
+//         is only safe to use while no other thread can release the coin.
+Coin* CoinObjectPool::Resolve(CoinHandle _handle) const
+{
+    uint32_t slot = _handle.GetSlot();
+    if (slot >= m_coins.GetCapacity())
+    {
+        return nullptr;
+    }
+
+    uint32_t slotState = m_slotStates[slot].load(std::memory_order_acquire);
+    if (slotState != PackSlotState(_handle.GetGeneration(), SLOT_ACTIVE))
+    {
+        return nullptr;
     }
+    return m_coins.GetSlot(slot);
 }
 
 
-// @brief Updates the state of all active coins.
-// This method should be called once per game frame.
-// It handles coins disappearing after their lifetime expires.
+// @brief Advances the pool by one frame and releases the coins whose lifetime ran out.
+// This method should be called once per game frame, always from the same thread.
+// See CoinExpiryMode for how the expired coins are found.
 void CoinObjectPool::Update()
 {
-    // Iterate from back to front so we can modify the list freely
-    for (size_t i = m_activeCoins.size() - 1; i != (size_t)(-1); --i)
+    if (m_threading == CoinPoolThreading::CONCURRENT)
+    {
+        ProcessPendingCoins();
+    }
+
+    // Only this thread ever writes the frame counter. Spawning threads read it with relaxed loads.
+    unsigned int currentFrame = m_currentFrame.load(std::memory_order_relaxed) + 1;
+    m_currentFrame.store(currentFrame, std::memory_order_relaxed);
+
+    if (m_expiryMode == CoinExpiryMode::DENSE_SWEEP)
+    {
+        UpdateDenseSweep();
+    }
+    else
+    {
+        UpdateTimingWheel(currentFrame);
+    }
+
+    EndTelemetryFrame();
+}
+
+// @brief Finds the coins a player at _center can pick up, using the spatial grid so only
+// nearby cells are looked at. In CONCURRENT mode call it from the thread that runs Update();
+// coins spawned since the last Update() are not in the grid yet.
+// @param _outHandles Receives the handles of coins within _radius. Stops once it is full.
+// @return Number of handles written.
+size_t CoinObjectPool::CollectCoinsInRadius(const Vector3& _center, float _radius, std::span<CoinHandle> _outHandles) const
+{
+    size_t foundCount = 0;
+    auto collect = [&](uint32_t _slot)
+    {
+        // In CONCURRENT mode a coin may already be released and only waiting for Update() to recycle it
+        uint32_t slotState = m_slotStates[_slot].load(std::memory_order_relaxed);
+        if ((slotState & SLOT_STATE_MASK) == SLOT_ACTIVE && foundCount < _outHandles.size())
+        {
+            _outHandles[foundCount++] = CoinHandle(_slot, GetSlotGeneration(slotState));
+        }
+    };
+
+    // Negative and NaN radii contain nothing
+    if ((_radius >= 0.0f) == false)
+    {
+        return 0;
+    }
+
+    // A huge radius would visit more grid cells than there are coins, at which point checking every
+    // active coin directly is cheaper. Compared in double, as the cell count can be beyond any integer.
+    if (m_spatialGrid.GetCellCountInRadius(_radius) > (double)m_coins.GetActiveCount())
     {
-        Coin* coin = m_activeCoins[i];
-        CoinState coinState = coin->Update();
-        if (coinState == CoinState::FREED)
+        const float radiusSqr = _radius * _radius;
+        for (size_t i = 0; i < m_coins.GetActiveCount(); ++i)
         {
-            std::cout << "Coin expired due to lifetime. Releasing." << std::endl;
-            ReleaseCoin(coin);       
+            uint32_t slot = m_coins.GetActiveSlot(i);
+            if ((m_spatialGrid.GetPosition(slot) - _center).MagnitudeSqr() <= radiusSqr)
+            {
+                collect(slot);
+            }
         }
+        return foundCount;
     }
+
+    m_spatialGrid.ForEachSlotInRadius(_center, _radius, collect);
+    return foundCount;
 }
 
+
 size_t CoinObjectPool::GetActiveCoinCount() const
 {
-    return m_activeCoins.size();
+    return m_coins.GetActiveCount();
 }
 
 size_t CoinObjectPool::GetFreeCoinCount() const
 {
-    return m_freeCoins.size();
+    if (m_threading == CoinPoolThreading::CONCURRENT)
+    {
+        return m_concurrentFreeSlots.GetApproximateSize();
+    }
+    return m_coins.GetFreeCount();
 }
 
 size_t CoinObjectPool::GetTotalCoinCount() const
 {
-    return m_allCoins.size();
-}
\ No newline at end of file
+    return m_coins.GetCapacity();
+}
+
+unsigned int CoinObjectPool::GetCurrentFrame() const
+{
+    return m_currentFrame.load(std::memory_order_relaxed);
+}
+
+
+// @brief Chooses what a spawn does when no coin is free. Defaults to FAIL_SPAWN.
+// @return false if the policy is not available. CONCURRENT pools only support FAIL_SPAWN, as other
+//         threads cannot safely expire coins or reallocate the pool.
+bool CoinObjectPool::SetExhaustionPolicy(CoinExhaustionPolicy _policy)
+{
+    if (m_threading == CoinPoolThreading::CONCURRENT && _policy != CoinExhaustionPolicy::FAIL_SPAWN)
+    {
+        return false;
+    }
+
+    if (_policy == CoinExhaustionPolicy::RECYCLE_SOONEST_EXPIRING && m_exhaustionPolicy != _policy)
+    {
+        // The heap is only kept up to date under this policy, so it is filled from the coins active right now
+        m_expiryHeap.Reset(m_coins.GetCapacity());
+        for (size_t i = 0; i < m_coins.GetActiveCount(); ++i)
+        {
+            m_expiryHeap.Push(m_coins.GetActiveSlot(i), m_coins.GetActive(i)->GetExpiryFrame());
+        }
+    }
+    else if (_policy != CoinExhaustionPolicy::RECYCLE_SOONEST_EXPIRING)
+    {
+        m_expiryHeap.Reset(0);
+    }
+
+    m_exhaustionPolicy = _policy;
+    return true;
+}
+
+CoinExhaustionPolicy CoinObjectPool::GetExhaustionPolicy() const
+{
+    return m_exhaustionPolicy;
+}
+
+// @brief Adds free coins ahead of a known busy moment, e.g. while a level loads. Coin storage
+// grows in chunks that never move, so existing coins and handles stay valid. Allocates.
+// SINGLE_THREADED only. The total is capped at CoinHandle::INDEX_MASK coins.
+// @return Number of coins added.
+size_t CoinObjectPool::Grow(size_t _additionalCoins)
+{
+    size_t oldCapacity = m_coins.GetCapacity();
+    if (m_threading == CoinPoolThreading::CONCURRENT || oldCapacity >= CoinHandle::INDEX_MASK)
+    {
+        return 0;
+    }
+
+    if (_additionalCoins > CoinHandle::INDEX_MASK - oldCapacity)
+    {
+        _additionalCoins = CoinHandle::INDEX_MASK - oldCapacity;
+    }
+
+    m_coins.Grow(_additionalCoins);
+    size_t newCapacity = m_coins.GetCapacity();
+
+    // std::atomic cannot be moved, so the state words are copied over into a bigger array
+    std::vector<std::atomic<uint32_t>> slotStates(newCapacity);
+    for (size_t slot = 0; slot < oldCapacity; ++slot)
+    {
+        slotStates[slot].store(m_slotStates[slot].load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+    m_slotStates.swap(slotStates);
+
+    m_spatialGrid.Grow(newCapacity);
+    m_dirtySlots.Resize(newCapacity);
+    if (m_expiryMode == CoinExpiryMode::DENSE_SWEEP)
+    {
+        m_remainingFrames.resize(newCapacity);
+        m_expiredActiveIndices.resize(newCapacity);
+    }
+    if (m_exhaustionPolicy == CoinExhaustionPolicy::RECYCLE_SOONEST_EXPIRING)
+    {
+        m_expiryHeap.Grow(newCapacity);
+    }
+
+    return _additionalCoins;
+}
+
+
+// @brief Buffer size that every full or delta snapshot of the pool, as it is now, fits in.
+size_t CoinObjectPool::GetMaxSnapshotSize() const
+{
+    const size_t capacity = m_coins.GetCapacity();
+    size_t byteCount = sizeof(SnapshotHeader);
+    byteCount += sizeof(uint32_t) * capacity;
+    byteCount += (m_expiryMode == CoinExpiryMode::DENSE_SWEEP) ? sizeof(int32_t) * capacity : sizeof(uint32_t) * EXPIRY_WHEEL_SIZE;
+    if (m_exhaustionPolicy == CoinExhaustionPolicy::RECYCLE_SOONEST_EXPIRING)
+    {
+        byteCount += m_expiryHeap.GetMaxSnapshotSize();
+    }
+    byteCount += sizeof(uint32_t) * DirtyBlockSet::GetBlockCount(capacity);
+    byteCount += (sizeof(Coin) + sizeof(uint32_t)) * capacity;
+    byteCount += m_spatialGrid.GetMaxSnapshotSize();
+    return byteCount;
+}
+
+// @brief Captures the whole pool.
+// @return Bytes written, or 0 if the buffer is too small or the pool is CONCURRENT.
+size_t CoinObjectPool::CaptureSnapshot(std::span<std::byte> _buffer)
+{
+    return WriteSnapshot(_buffer, false);
+}
+
+// @brief Captures only the blocks of coins changed since the last capture or restore, plus the
+// free and active lists and the expiry tracking, which are always copied whole.
+// Restoring it needs the pool to be back in the state of that last capture or restore first,
+// i.e. restore the full snapshot and then every delta after it, in order. Each delta records which
+// capture it follows, and RestoreSnapshot refuses it unless the pool is in that state, unchanged.
+// @return Bytes written, or 0 if the buffer is too small or the pool is CONCURRENT.
+size_t CoinObjectPool::CaptureDeltaSnapshot(std::span<std::byte> _buffer)
+{
+    return WriteSnapshot(_buffer, true);
+}
+
+// @brief Puts the pool back into a captured state, full or delta. Handles given out since the
+// capture stop resolving, and handles that were live at the capture resolve again.
+// @return false, with the pool untouched, if the snapshot was not captured from this pool as it is now,
+// is malformed, or is a delta taken against some other state than the pool's current one.
+bool CoinObjectPool::RestoreSnapshot(std::span<const std::byte> _snapshot)
+{
+    // Everything is checked before anything is written, so a rejected snapshot leaves the pool as it was
+    if (ValidateSnapshot(_snapshot) == false)
+    {
+        return false;
+    }
+
+    SnapshotReader reader(_snapshot);
+    SnapshotHeader header = reader.ReadValue<SnapshotHeader>();
+    m_currentFrame.store(header.currentFrame, std::memory_order_relaxed);
+
+    const std::byte* freeSlotBytes = reader.Take(sizeof(uint32_t) * header.freeCount);
+    const std::byte* activeSlotBytes = reader.Take(sizeof(uint32_t) * header.activeCount);
+    m_coins.RestoreSlotLists(freeSlotBytes, header.freeCount, activeSlotBytes, header.activeCount);
+
+    if (m_expiryMode == CoinExpiryMode::DENSE_SWEEP)
+    {
+        reader.Read(m_remainingFrames.data(), sizeof(int32_t) * header.activeCount);
+    }
+    else
+    {
+        reader.Read(m_expiryWheel.data(), sizeof(uint32_t) * EXPIRY_WHEEL_SIZE);
+    }
+
+    if (m_exhaustionPolicy == CoinExhaustionPolicy::RECYCLE_SOONEST_EXPIRING)
+    {
+        m_expiryHeap.ReadSnapshot(reader);
+    }
+
+    const size_t capacity = m_coins.GetCapacity();
+    if (header.isDelta == 0)
+    {
+        ReadSlotRange(reader, 0, capacity);
+    }
+    else
+    {
+        for (uint32_t i = 0; i < header.slotBlockCount; ++i)
+        {
+            size_t firstSlot = (size_t)reader.ReadValue<uint32_t>() << DirtyBlockSet::BLOCK_SHIFT;
+            ReadSlotRange(reader, (uint32_t)firstSlot, std::min<size_t>(DirtyBlockSet::BLOCK_SIZE, capacity - firstSlot));
+        }
+    }
+    m_spatialGrid.ReadSnapshot(reader);
+
+    // The pool now matches the snapshot, so later deltas are taken relative to it
+    m_dirtySlots.Clear();
+    m_baseSnapshotSequence = header.sequence;
+    return true;
+}
+
+
+CoinPoolTelemetry CoinObjectPool::GetTelemetry() const
+{
+    CoinPoolTelemetry telemetry = m_telemetry;
+    telemetry.exhaustionCount = m_exhaustionCount.load(std::memory_order_relaxed);
+    return telemetry;
+}
+
+// @brief Writes the telemetry out in a human readable form.
+void CoinObjectPool::DumpTelemetry(std::ostream& _os) const
+{
+    _os << "CoinObjectPool telemetry (frame " << GetCurrentFrame() << ")" << std::endl;
+#if COIN_POOL_ENABLE_TELEMETRY
+    CoinPoolTelemetry telemetry = GetTelemetry();
+    _os << "    last frame: " << telemetry.lastFrameSpawns << " spawned, " << telemetry.lastFrameReleases << " picked up, "
+        << telemetry.lastFrameExpiries << " expired" << std::endl;
+    _os << "    total: " << telemetry.totalSpawns << " spawned, " << telemetry.totalReleases << " picked up, "
+        << telemetry.totalExpiries << " expired" << std::endl;
+    _os << "    active high water mark: " << telemetry.activeHighWaterMark << " of " << GetTotalCoinCount() << std::endl;
+    _os << "    exhausted spawn requests: " << telemetry.exhaustionCount << std::endl;
+    _os << "    coins reclaimed early to make room: " << telemetry.reclaimedCount << std::endl;
+    _os << "    age at pickup (frames):" << std::endl;
+    for (size_t i = 0; i < CoinPoolTelemetry::PICKUP_AGE_BUCKET_COUNT; ++i)
+    {
+        unsigned int firstFrame = (unsigned int)i * CoinPoolTelemetry::PICKUP_AGE_BUCKET_FRAMES;
+        _os << "        " << firstFrame;
+        if (i + 1 < CoinPoolTelemetry::PICKUP_AGE_BUCKET_COUNT)
+        {
+            _os << "-" << (firstFrame + CoinPoolTelemetry::PICKUP_AGE_BUCKET_FRAMES - 1);
+        }
+        else
+        {
+            _os << "+";
+        }
+        _os << ": " << telemetry.pickupAgeHistogram[i] << std::endl;
+    }
+#else
+    _os << "    compiled out (COIN_POOL_ENABLE_TELEMETRY is 0)" << std::endl;
+#endif
+}
+
+void CoinObjectPool::ResetTelemetry()
+{
+    m_telemetry = CoinPoolTelemetry();
+    m_frameSpawns = 0;
+    m_frameReleases = 0;
+    m_frameExpiries = 0;
+    m_exhaustionCount.store(0, std::memory_order_relaxed);
+}
+
+
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//              Private
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// @brief Starts tracking a registered slot's lifetime. The slot must already be in the active list.
+// In TIMING_WHEEL mode the coin is pushed onto the front of the bucket for the frame it expires on.
+// A coin that is already overdue (spawned on another thread while Update() was running) is
+// treated as expiring on the next frame instead, so it is not missed for a whole revolution.
+void CoinObjectPool::ScheduleExpiry(uint32_t _slot)
+{
+    Coin* coin = m_coins.GetSlot(_slot);
+    unsigned int currentFrame = m_currentFrame.load(std::memory_order_relaxed);
+    unsigned int nextFrame = currentFrame + 1;
+    unsigned int expiryFrame = coin->GetExpiryFrame();
+    if ((int)(expiryFrame - nextFrame) < 0)
+    {
+        expiryFrame = nextFrame;
+    }
+
+    // Every new coin passes through here on the thread that owns the pool, which makes it the place
+    // to note the slot as changed for delta snapshots
+    m_dirtySlots.Mark(_slot);
+
+    if (m_exhaustionPolicy == CoinExhaustionPolicy::RECYCLE_SOONEST_EXPIRING)
+    {
+        m_expiryHeap.Push(_slot, expiryFrame);
+    }
+
+    if (m_expiryMode == CoinExpiryMode::DENSE_SWEEP)
+    {
+        // Counted down once per Update() and expired on reaching zero, the same frame the wheel would pick
+        m_remainingFrames[m_coins.GetActiveIndex(_slot)] = (int32_t)(expiryFrame - currentFrame);
+        return;
+    }
+
+    coin->m_wheelBucket = expiryFrame & EXPIRY_WHEEL_MASK;
+    uint32_t& bucketHead = m_expiryWheel[coin->m_wheelBucket];
+
+    coin->m_wheelPrev = Coin::NO_SLOT;
+    coin->m_wheelNext = bucketHead;
+    if (bucketHead != Coin::NO_SLOT)
+    {
+        m_coins.GetSlot(bucketHead)->m_wheelPrev = _slot;
+        m_dirtySlots.Mark(bucketHead);
+    }
+    bucketHead = _slot;
+}
+
+// @brief Stops tracking a slot's lifetime in O(1). Must run before the slot leaves the active list.
+void CoinObjectPool::UnscheduleExpiry(uint32_t _slot)
+{
+    m_dirtySlots.Mark(_slot);
+
+    if (m_exhaustionPolicy == CoinExhaustionPolicy::RECYCLE_SOONEST_EXPIRING)
+    {
+        m_expiryHeap.Remove(_slot);
+    }
+
+    if (m_expiryMode == CoinExpiryMode::DENSE_SWEEP)
+    {
+        // Mirror the swap-and-pop DeactivateSlot is about to do to the active list
+        m_remainingFrames[m_coins.GetActiveIndex(_slot)] = m_remainingFrames[m_coins.GetActiveCount() - 1];
+        return;
+    }
+
+    Coin* coin = m_coins.GetSlot(_slot);
+    if (coin->m_wheelPrev != Coin::NO_SLOT)
+    {
+        m_coins.GetSlot(coin->m_wheelPrev)->m_wheelNext = coin->m_wheelNext;
+        m_dirtySlots.Mark(coin->m_wheelPrev);
+    }
+    else
+    {
+        m_expiryWheel[coin->m_wheelBucket] = coin->m_wheelNext;
+    }
+
+    if (coin->m_wheelNext != Coin::NO_SLOT)
+    {
+        m_coins.GetSlot(coin->m_wheelNext)->m_wheelPrev = coin->m_wheelPrev;
+        m_dirtySlots.Mark(coin->m_wheelNext);
+    }
+
+    coin->m_wheelPrev = Coin::NO_SLOT;
+    coin->m_wheelNext = Coin::NO_SLOT;
+}
+
+
+// @brief Expires every coin in the current frame's wheel bucket.
+void CoinObjectPool::UpdateTimingWheel(unsigned int _currentFrame)
+{
+    // The bucket may also hold coins with lifetimes longer than the wheel, which expire on a later
+    // revolution. Those are skipped and stay where they are until their frame comes around.
+    uint32_t slot = m_expiryWheel[_currentFrame & EXPIRY_WHEEL_MASK];
+    while (slot != Coin::NO_SLOT)
+    {
+        const Coin* coin = m_coins.GetSlot(slot);
+        uint32_t nextSlot = coin->m_wheelNext;
+        if ((int)(coin->GetExpiryFrame() - _currentFrame) <= 0)
+        {
+            ExpireSlot(slot);
+        }
+        slot = nextSlot;
+    }
+}
+
+// @brief Counts every active coin's lifetime down in one SIMD pass and expires the ones that ran out.
+void CoinObjectPool::UpdateDenseSweep()
+{
+    size_t expiredCount = DecrementLifetimes(m_remainingFrames.data(), m_coins.GetActiveCount(), m_expiredActiveIndices.data());
+
+    // Highest index first. Releasing swaps the last active coin into the hole, and going backwards means
+    // that coin is never one of the expired ones still waiting to be handled.
+    for (size_t i = expiredCount; i-- > 0; )
+    {
+        ExpireSlot(m_coins.GetActiveSlot(m_expiredActiveIndices[i]));
+    }
+}
+
+// @brief Releases a coin whose lifetime ran out.
+void CoinObjectPool::ExpireSlot(uint32_t _slot)
+{
+    if (m_threading == CoinPoolThreading::CONCURRENT)
+    {
+        // Another thread may be picking this coin up right now, in which case it wins and
+        // the release is finished by the next Update() instead.
+        uint32_t generation = GetSlotGeneration(m_slotStates[_slot].load(std::memory_order_relaxed));
+        if (TryBeginConcurrentRelease(_slot, generation))
+        {
+            RecycleSlot(_slot, true);
+            m_concurrentFreeSlots.Push(_slot);
+        }
+    }
+    else
+    {
+        RecycleSlot(_slot, true);
+        m_coins.ReturnSlot(_slot);
+    }
+}
+
+
+// @brief Applies the exhaustion policy to free up _missingCount more coins.
+// @return false, having changed nothing, if the policy cannot free that many.
+bool CoinObjectPool::TryMakeRoom(size_t _missingCount)
+{
+    if (m_exhaustionPolicy == CoinExhaustionPolicy::RECYCLE_SOONEST_EXPIRING)
+    {
+        if (_missingCount > m_expiryHeap.GetCount())
+        {
+            return false;
+        }
+
+        for (size_t i = 0; i < _missingCount; ++i)
+        {
+            RecordReclaim();
+            ExpireSlot(m_expiryHeap.GetSoonestSlot());
+        }
+        return true;
+    }
+
+    if (m_exhaustionPolicy == CoinExhaustionPolicy::GROW_BY_CHUNK)
+    {
+        size_t chunkCount = (_missingCount + GROWTH_CHUNK_SIZE - 1) / GROWTH_CHUNK_SIZE;
+        if (m_coins.GetCapacity() + _missingCount > CoinHandle::INDEX_MASK)
+        {
+            return false;
+        }
+        return Grow(chunkCount * GROWTH_CHUNK_SIZE) >= _missingCount;
+    }
+
+    return false;
+}
+
+
+// @brief Moves this frame's counts into the telemetry and starts counting the next frame.
+void CoinObjectPool::EndTelemetryFrame()
+{
+#if COIN_POOL_ENABLE_TELEMETRY
+    m_telemetry.lastFrameSpawns = m_frameSpawns;
+    m_telemetry.lastFrameReleases = m_frameReleases;
+    m_telemetry.lastFrameExpiries = m_frameExpiries;
+    m_telemetry.totalSpawns += m_frameSpawns;
+    m_telemetry.totalReleases += m_frameReleases;
+    m_telemetry.totalExpiries += m_frameExpiries;
+    m_frameSpawns = 0;
+    m_frameReleases = 0;
+    m_frameExpiries = 0;
+#endif
+}
+
+
+// @brief Adds a constructed coin to the active list, expiry wheel and spatial grid.
+void CoinObjectPool::RegisterSlot(uint32_t _slot)
+{
+    m_coins.ActivateSlot(_slot);
+    ScheduleExpiry(_slot);
+    RecordSpawns(1);
+    m_spatialGrid.Insert(_slot, m_coins.GetSlot(_slot)->GetPosition());
+}
+
+// @brief Marks a freshly constructed coin's slot ACTIVE and returns the handle for it.
+CoinHandle CoinObjectPool::ActivateSlotState(uint32_t _slot)
+{
+    // The caller owns the free slot, so nobody else is writing its state. Release ordering lets
+    // a thread that resolves the handle see the constructed coin.
+    uint32_t generation = GetSlotGeneration(m_slotStates[_slot].load(std::memory_order_relaxed));
+    m_slotStates[_slot].store(PackSlotState(generation, SLOT_ACTIVE), std::memory_order_release);
+    return CoinHandle(_slot, generation);
+}
+
+
+// @brief Lock-free spawn. Pops a slot, builds the coin, and queues it for the next Update() to register.
+CoinHandle CoinObjectPool::TrySpawnCoinConcurrent(int _lifetimeFrames, const Vector3& _position)
+{
+    uint32_t slot = 0;
+    if (m_concurrentFreeSlots.TryPop(slot) == false)
+    {
+        RecordExhaustion();
+        return CoinHandle();
+    }
+
+    m_coins.ConstructInSlot(slot, &m_currentFrame, m_currentFrame.load(std::memory_order_relaxed), _lifetimeFrames, _position);
+    CoinHandle handle = ActivateSlotState(slot);
+
+    // Release ordering on the push publishes the coin's fields to the thread running Update()
+    m_pendingSpawns.Push(slot);
+    return handle;
+}
+
+// @brief Lock-free release. Claims the coin and queues its slot for the next Update() to recycle.
+bool CoinObjectPool::ReleaseCoinConcurrent(CoinHandle _handle)
+{
+    uint32_t slot = _handle.GetSlot();
+    if (slot >= m_coins.GetCapacity() || TryBeginConcurrentRelease(slot, _handle.GetGeneration()) == false)
+    {
+        return false;
+    }
+
+    m_pendingReleases.Push(slot);
+    return true;
+}
+
+// @brief Lock-free burst spawn. Pops the slots a chunk at a time and queues them all for the next
+// Update() with a single push.
+size_t CoinObjectPool::TrySpawnCoinsConcurrent(size_t _count, int _lifetimeFrames, std::span<CoinHandle> _outHandles, CoinBatchFill _fill, const Vector3& _position)
+{
+    // Everything is popped before any coin is built, so a request that comes up short can be undone
+    uint32_t firstSlot = LockFreeSlotStack::EMPTY;
+    uint32_t lastSlot = LockFreeSlotStack::EMPTY;
+    size_t poppedCount = 0;
+    uint32_t poppedSlots[BATCH_CHUNK_SIZE];
+    while (poppedCount < _count)
+    {
+        size_t chunkSize = (_count - poppedCount < BATCH_CHUNK_SIZE) ? _count - poppedCount : BATCH_CHUNK_SIZE;
+        size_t chunkCount = m_concurrentFreeSlots.TryPopChain(poppedSlots, chunkSize);
+        if (chunkCount == 0)
+        {
+            break;
+        }
+
+        for (size_t i = 0; i < chunkCount; ++i)
+        {
+            m_pendingSpawns.SetNext(poppedSlots[i], firstSlot);
+            if (firstSlot == LockFreeSlotStack::EMPTY)
+            {
+                lastSlot = poppedSlots[i];
+            }
+            firstSlot = poppedSlots[i];
+        }
+        poppedCount += chunkCount;
+    }
+
+    if (poppedCount < _count)
+    {
+        RecordExhaustion();
+        if (_fill == CoinBatchFill::ALL_OR_NOTHING)
+        {
+            if (poppedCount > 0)
+            {
+                for (uint32_t slot = firstSlot; slot != LockFreeSlotStack::EMPTY; slot = m_pendingSpawns.GetNext(slot))
+                {
+                    m_concurrentFreeSlots.SetNext(slot, m_pendingSpawns.GetNext(slot));
+                }
+                m_concurrentFreeSlots.PushChain(firstSlot, lastSlot, poppedCount);
+            }
+            return 0;
+        }
+    }
+
+    unsigned int spawnFrame = m_currentFrame.load(std::memory_order_relaxed);
+    size_t spawnedCount = 0;
+    for (uint32_t slot = firstSlot; slot != LockFreeSlotStack::EMPTY; slot = m_pendingSpawns.GetNext(slot))
+    {
+        m_coins.ConstructInSlot(slot, &m_currentFrame, spawnFrame, _lifetimeFrames, _position);
+        _outHandles[spawnedCount++] = ActivateSlotState(slot);
+    }
+
+    if (spawnedCount > 0)
+    {
+        m_pendingSpawns.PushChain(firstSlot, lastSlot, spawnedCount);
+    }
+    return spawnedCount;
+}
+
+// @brief Lock-free burst release. Claims every coin it can and queues them with a single push.
+size_t CoinObjectPool::ReleaseCoinsConcurrent(std::span<const CoinHandle> _handles)
+{
+    uint32_t firstSlot = LockFreeSlotStack::EMPTY;
+    uint32_t lastSlot = LockFreeSlotStack::EMPTY;
+    size_t releasedCount = 0;
+    for (CoinHandle handle : _handles)
+    {
+        uint32_t slot = handle.GetSlot();
+        if (slot >= m_coins.GetCapacity() || TryBeginConcurrentRelease(slot, handle.GetGeneration()) == false)
+        {
+            continue;
+        }
+
+        m_pendingReleases.SetNext(slot, firstSlot);
+        if (firstSlot == LockFreeSlotStack::EMPTY)
+        {
+            lastSlot = slot;
+        }
+        firstSlot = slot;
+        ++releasedCount;
+    }
+
+    if (releasedCount > 0)
+    {
+        m_pendingReleases.PushChain(firstSlot, lastSlot, releasedCount);
+    }
+    return releasedCount;
+}
+
+// @brief Moves a slot from ACTIVE to RELEASING if it still holds the given generation.
+// Exactly one caller wins, so double releases and stale handles are rejected.
+bool CoinObjectPool::TryBeginConcurrentRelease(uint32_t _slot, uint32_t _generation)
+{
+    uint32_t expectedState = PackSlotState(_generation, SLOT_ACTIVE);
+    return m_slotStates[_slot].compare_exchange_strong(expectedState, PackSlotState(_generation, SLOT_RELEASING), std::memory_order_acq_rel);
+}
+
+// @brief Takes a slot out of the active list, expiry wheel and spatial grid, destroys its coin and moves the slot
+// on to the next generation, which invalidates every handle to the old coin.
+// The caller is responsible for putting the slot back on the free stack.
+// @param _hasExpired true if the coin's lifetime ran out, false if it was picked up.
+void CoinObjectPool::RecycleSlot(uint32_t _slot, bool _hasExpired)
+{
+    Coin* coin = m_coins.GetSlot(_slot);
+    RecordRecycle(coin, _hasExpired);
+    UnscheduleExpiry(_slot);
+    m_spatialGrid.Remove(_slot);
+    coin->Deactivate();
+    m_coins.DeactivateSlot(_slot);
+    m_coins.DestroyInSlot(_slot);
+
+    uint32_t generation = GetSlotGeneration(m_slotStates[_slot].load(std::memory_order_relaxed)) + 1;
+    m_slotStates[_slot].store(PackSlotState(generation, SLOT_FREE), std::memory_order_release);
+}
+
+// @brief Writes a full or delta snapshot. See CaptureSnapshot() and CaptureDeltaSnapshot().
+size_t CoinObjectPool::WriteSnapshot(std::span<std::byte> _buffer, bool _deltaOnly)
+{
+    if (m_threading == CoinPoolThreading::CONCURRENT)
+    {
+        return 0;
+    }
+
+    const size_t capacity = m_coins.GetCapacity();
+    SnapshotWriter writer(_buffer);
+    std::byte* headerBytes = writer.Reserve(sizeof(SnapshotHeader));
+
+    SnapshotHeader header = {};
+    header.poolId = (uint64_t)reinterpret_cast<uintptr_t>(this);
+    header.sequence = m_lastSnapshotSequence + 1;
+    header.baseSequence = m_baseSnapshotSequence;
+    header.isDelta = _deltaOnly ? 1 : 0;
+    header.capacity = (uint32_t)capacity;
+    header.expiryMode = (uint32_t)m_expiryMode;
+    header.exhaustionPolicy = (uint32_t)m_exhaustionPolicy;
+    header.currentFrame = m_currentFrame.load(std::memory_order_relaxed);
+    header.freeCount = (uint32_t)m_coins.GetFreeCount();
+    header.activeCount = (uint32_t)m_coins.GetActiveCount();
+    header.slotBlockCount = (uint32_t)(_deltaOnly ? m_dirtySlots.GetMarkedBlockCount() : DirtyBlockSet::GetBlockCount(capacity));
+
+    // The lists and expiry tracking are a few bytes per coin and change every frame, so they always go across whole
+    writer.Write(m_coins.GetFreeSlots().data(), sizeof(uint32_t) * header.freeCount);
+    writer.Write(m_coins.GetActiveSlots().data(), sizeof(uint32_t) * header.activeCount);
+    if (m_expiryMode == CoinExpiryMode::DENSE_SWEEP)
+    {
+        writer.Write(m_remainingFrames.data(), sizeof(int32_t) * header.activeCount);
+    }
+    else
+    {
+        writer.Write(m_expiryWheel.data(), sizeof(uint32_t) * EXPIRY_WHEEL_SIZE);
+    }
+
+    if (m_exhaustionPolicy == CoinExhaustionPolicy::RECYCLE_SOONEST_EXPIRING)
+    {
+        m_expiryHeap.WriteSnapshot(writer);
+    }
+
+    if (_deltaOnly == false)
+    {
+        WriteSlotRange(writer, 0, capacity);
+    }
+    else
+    {
+        m_dirtySlots.ForEachMarkedBlock([&](uint32_t _block)
+        {
+            uint32_t firstSlot = _block << DirtyBlockSet::BLOCK_SHIFT;
+            writer.WriteValue(_block);
+            WriteSlotRange(writer, firstSlot, std::min<size_t>(DirtyBlockSet::BLOCK_SIZE, capacity - firstSlot));
+        });
+    }
+
+    m_spatialGrid.WriteSnapshot(writer, _deltaOnly);
+    if (writer.HasOverflowed())
+    {
+        return 0;
+    }
+
+    m_dirtySlots.Clear();
+    m_lastSnapshotSequence = header.sequence;
+    m_baseSnapshotSequence = header.sequence;
+    header.byteCount = writer.GetSize();
+    std::memcpy(headerBytes, &header, sizeof(SnapshotHeader));
+    return writer.GetSize();
+}
+
+// @brief Walks a snapshot the way RestoreSnapshot() reads it, without changing anything.
+// @return true if it was captured from this pool, is well formed, and, for a delta, was taken against
+// the state the pool is in now.
+bool CoinObjectPool::ValidateSnapshot(std::span<const std::byte> _snapshot) const
+{
+    if (m_threading == CoinPoolThreading::CONCURRENT || _snapshot.size() < sizeof(SnapshotHeader))
+    {
+        return false;
+    }
+
+    const size_t capacity = m_coins.GetCapacity();
+    SnapshotReader reader(_snapshot);
+    SnapshotHeader header = reader.ReadValue<SnapshotHeader>();
+    if (header.poolId != (uint64_t)reinterpret_cast<uintptr_t>(this)
+        || header.byteCount != _snapshot.size()
+        || header.capacity != capacity
+        || header.expiryMode != (uint32_t)m_expiryMode
+        || header.exhaustionPolicy != (uint32_t)m_exhaustionPolicy
+        || (size_t)header.freeCount + header.activeCount != capacity)
+    {
+        return false;
+    }
+
+    // A delta only carries the blocks changed after its base capture, so every other block has to be
+    // exactly as it was then: the pool in that state, with nothing changed since
+    if (header.isDelta != 0 && (header.baseSequence != m_baseSnapshotSequence || m_dirtySlots.GetMarkedBlockCount() != 0))
+    {
+        return false;
+    }
+
+    const std::byte* freeSlotBytes = reader.Take(sizeof(uint32_t) * header.freeCount);
+    const std::byte* activeSlotBytes = reader.Take(sizeof(uint32_t) * header.activeCount);
+    if (activeSlotBytes == nullptr
+        || AreSlotsInRange(freeSlotBytes, header.freeCount, capacity) == false
+        || AreSlotsInRange(activeSlotBytes, header.activeCount, capacity) == false)
+    {
+        return false;
+    }
+
+    reader.Take((m_expiryMode == CoinExpiryMode::DENSE_SWEEP) ? sizeof(int32_t) * header.activeCount : sizeof(uint32_t) * EXPIRY_WHEEL_SIZE);
+    if (m_exhaustionPolicy == CoinExhaustionPolicy::RECYCLE_SOONEST_EXPIRING && m_expiryHeap.ValidateSnapshot(reader) == false)
+    {
+        return false;
+    }
+
+    const size_t bytesPerSlot = sizeof(Coin) + sizeof(uint32_t);
+    if (header.isDelta == 0)
+    {
+        reader.Take(bytesPerSlot * capacity);
+    }
+    else
+    {
+        for (uint32_t i = 0; i < header.slotBlockCount; ++i)
+        {
+            size_t firstSlot = (size_t)reader.ReadValue<uint32_t>() << DirtyBlockSet::BLOCK_SHIFT;
+            if (reader.HasOverflowed() || firstSlot >= capacity)
+            {
+                return false;
+            }
+            reader.Take(bytesPerSlot * std::min<size_t>(DirtyBlockSet::BLOCK_SIZE, capacity - firstSlot));
+        }
+    }
+
+    return m_spatialGrid.ValidateSnapshot(reader) && reader.HasOverflowed() == false && reader.GetSize() == _snapshot.size();
+}
+
+// @brief Whether every one of _count slot indices stored at _slotBytes is below _capacity
+bool CoinObjectPool::AreSlotsInRange(const std::byte* _slotBytes, size_t _count, size_t _capacity)
+{
+    for (size_t i = 0; i < _count; ++i)
+    {
+        uint32_t slot = 0;
+        std::memcpy(&slot, _slotBytes + sizeof(uint32_t) * i, sizeof(uint32_t));
+        if (slot >= _capacity)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// @brief Coin bytes and slot state words of a run of slots.
+void CoinObjectPool::WriteSlotRange(SnapshotWriter& _writer, uint32_t _firstSlot, size_t _count) const
+{
+    std::byte* coinBytes = _writer.Reserve(sizeof(Coin) * _count);
+    std::byte* stateBytes = _writer.Reserve(sizeof(uint32_t) * _count);
+    if (stateBytes == nullptr)
+    {
+        return;
+    }
+
+    m_coins.CopySlotBytesOut(_firstSlot, _count, coinBytes);
+    for (size_t i = 0; i < _count; ++i)
+    {
+        uint32_t slotState = m_slotStates[_firstSlot + i].load(std::memory_order_relaxed);
+        std::memcpy(stateBytes + sizeof(uint32_t) * i, &slotState, sizeof(uint32_t));
+    }
+}
+
+void CoinObjectPool::ReadSlotRange(SnapshotReader& _reader, uint32_t _firstSlot, size_t _count)
+{
+    const std::byte* coinBytes = _reader.Take(sizeof(Coin) * _count);
+    const std::byte* stateBytes = _reader.Take(sizeof(uint32_t) * _count);
+    if (stateBytes == nullptr)
+    {
+        return;
+    }
+
+    // Coins that were alive are overwritten without running their destructor. Coin owns nothing, so that is fine.
+    m_coins.CopySlotBytesIn(_firstSlot, _count, coinBytes);
+    for (size_t i = 0; i < _count; ++i)
+    {
+        uint32_t slotState = 0;
+        std::memcpy(&slotState, stateBytes + sizeof(uint32_t) * i, sizeof(uint32_t));
+        m_slotStates[_firstSlot + i].store(slotState, std::memory_order_relaxed);
+    }
+}
+
+
+// @brief Registers coins spawned by other threads and recycles the ones they released.
+// Must only be called from the thread that runs Update().
+void CoinObjectPool::ProcessPendingCoins()
+{
+    // Take the releases before the spawns. A coin can only be released after it was spawned, so every
+    // slot in the release list is then either registered already, in the spawn list, or still sitting
+    // in a CoinThreadCache batch that has not been flushed yet.
+    uint32_t firstRelease = m_pendingReleases.TakeAll();
+    uint32_t firstSpawn = m_pendingSpawns.TakeAll();
+
+    for (uint32_t slot = firstSpawn; slot != LockFreeSlotStack::EMPTY; slot = m_pendingSpawns.GetNext(slot))
+    {
+        RegisterSlot(slot);
+    }
+
+    // Recycled slots are linked together and go back on the free stack with a single push.
+    // Releases of coins whose spawn has not been published yet are put back for a later Update().
+    uint32_t firstFreed = LockFreeSlotStack::EMPTY;
+    uint32_t lastFreed = LockFreeSlotStack::EMPTY;
+    size_t freedCount = 0;
+    uint32_t firstDeferred = LockFreeSlotStack::EMPTY;
+    uint32_t lastDeferred = LockFreeSlotStack::EMPTY;
+    size_t deferredCount = 0;
+    uint32_t slot = firstRelease;
+    while (slot != LockFreeSlotStack::EMPTY)
+    {
+        uint32_t nextSlot = m_pendingReleases.GetNext(slot);
+        if (m_coins.IsSlotActive(slot) == false)
+        {
+            if (lastDeferred != LockFreeSlotStack::EMPTY)
+            {
+                m_pendingReleases.SetNext(lastDeferred, slot);
+            }
+            else
+            {
+                firstDeferred = slot;
+            }
+            lastDeferred = slot;
+            ++deferredCount;
+        }
+        else
+        {
+            RecycleSlot(slot, false);
+
+            if (lastFreed != LockFreeSlotStack::EMPTY)
+            {
+                m_concurrentFreeSlots.SetNext(lastFreed, slot);
+            }
+            else
+            {
+                firstFreed = slot;
+            }
+            lastFreed = slot;
+            ++freedCount;
+        }
+
+        slot = nextSlot;
+    }
+
+    if (freedCount > 0)
+    {
+        m_concurrentFreeSlots.PushChain(firstFreed, lastFreed, freedCount);
+    }
+    if (deferredCount > 0)
+    {
+        m_pendingReleases.PushChain(firstDeferred, lastDeferred, deferredCount);
+    }
+}
+
+
+
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//              Coin Thread Cache
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+CoinThreadCache::CoinThreadCache(CoinObjectPool& _pool)
+    : m_pool(_pool),
+      m_freeSlotCount(0),
+      m_firstSpawn(LockFreeSlotStack::EMPTY),
+      m_lastSpawn(LockFreeSlotStack::EMPTY),
+      m_spawnCount(0),
+      m_firstRelease(LockFreeSlotStack::EMPTY),
+      m_lastRelease(LockFreeSlotStack::EMPTY),
+      m_releaseCount(0)
+{
+}
+
+// @brief Flushes, then gives any unused free slots back to the pool.
+CoinThreadCache::~CoinThreadCache()
+{
+    Flush();
+
+    if (m_freeSlotCount > 0)
+    {
+        for (size_t i = 1; i < m_freeSlotCount; ++i)
+        {
+            m_pool.m_concurrentFreeSlots.SetNext(m_freeSlots[i - 1], m_freeSlots[i]);
+        }
+        m_pool.m_concurrentFreeSlots.PushChain(m_freeSlots[0], m_freeSlots[m_freeSlotCount - 1], m_freeSlotCount);
+        m_freeSlotCount = 0;
+    }
+}
+
+
+// @brief Same as CoinObjectPool::TrySpawnCoin, but takes the slot from this thread's batch.
+// The coin is not seen by Update() until its batch is full or Flush() is called.
+CoinHandle CoinThreadCache::TrySpawnCoin(int _lifetimeFrames, const Vector3& _position)
+{
+    if (m_pool.m_threading != CoinPoolThreading::CONCURRENT)
+    {
+        return m_pool.TrySpawnCoin(_lifetimeFrames, _position);
+    }
+
+    if (_lifetimeFrames < 1)
+    {
+        _lifetimeFrames = 1;
+    }
+
+    // Out of slots: grab a whole batch from the pool with one compare-exchange
+    if (m_freeSlotCount == 0)
+    {
+        m_freeSlotCount = m_pool.m_concurrentFreeSlots.TryPopChain(m_freeSlots, MAGAZINE_SIZE);
+        if (m_freeSlotCount == 0)
+        {
+            m_pool.RecordExhaustion();
+            return CoinHandle();
+        }
+    }
+
+    uint32_t slot = m_freeSlots[--m_freeSlotCount];
+    m_pool.m_coins.ConstructInSlot(slot, &m_pool.m_currentFrame, m_pool.m_currentFrame.load(std::memory_order_relaxed), _lifetimeFrames, _position);
+    CoinHandle handle = m_pool.ActivateSlotState(slot);
+
+    // This thread owns the slot until the batch is published, so linking it needs no synchronisation
+    m_pool.m_pendingSpawns.SetNext(slot, m_firstSpawn);
+    if (m_spawnCount == 0)
+    {
+        m_lastSpawn = slot;
+    }
+    m_firstSpawn = slot;
+
+    if (++m_spawnCount >= MAGAZINE_SIZE)
+    {
+        PublishSpawns();
+    }
+    return handle;
+}
+
+
+// @brief Same as CoinObjectPool::ReleaseCoin. The coin may have been spawned by any thread.
+// Its slot is not recycled until its batch is full or Flush() is called.
+bool CoinThreadCache::ReleaseCoin(CoinHandle _handle)
+{
+    if (m_pool.m_threading != CoinPoolThreading::CONCURRENT)
+    {
+        return m_pool.ReleaseCoin(_handle);
+    }
+
+    uint32_t slot = _handle.GetSlot();
+    if (slot >= m_pool.m_coins.GetCapacity() || m_pool.TryBeginConcurrentRelease(slot, _handle.GetGeneration()) == false)
+    {
+        return false;
+    }
+
+    m_pool.m_pendingReleases.SetNext(slot, m_firstRelease);
+    if (m_releaseCount == 0)
+    {
+        m_lastRelease = slot;
+    }
+    m_firstRelease = slot;
+
+    if (++m_releaseCount >= MAGAZINE_SIZE)
+    {
+        Flush();
+    }
+    return true;
+}
+
+
+// @brief Hands every batched spawn and release over to the pool, so the next Update() sees them.
+// Call this at the end of a job, or whenever the pool's counts need to be up to date.
+void CoinThreadCache::Flush()
+{
+    // Spawns go first, so that this cache never publishes the release of a coin ahead of its spawn
+    PublishSpawns();
+    PublishReleases();
+}
+
+
+void CoinThreadCache::PublishSpawns()
+{
+    if (m_spawnCount > 0)
+    {
+        m_pool.m_pendingSpawns.PushChain(m_firstSpawn, m_lastSpawn, m_spawnCount);
+        m_firstSpawn = LockFreeSlotStack::EMPTY;
+        m_lastSpawn = LockFreeSlotStack::EMPTY;
+        m_spawnCount = 0;
+    }
+}
+
+void CoinThreadCache::PublishReleases()
+{
+    if (m_releaseCount > 0)
+    {
+        m_pool.m_pendingReleases.PushChain(m_firstRelease, m_lastRelease, m_releaseCount);
+        m_firstRelease = LockFreeSlotStack::EMPTY;
+        m_lastRelease = LockFreeSlotStack::EMPTY;
+        m_releaseCount = 0;
+    }
+}
@@ -0,0 +1,931 @@
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//             Coin Object Pool Benchmarks (cpp)
+//             Author: Christopher A
+//             Date: October 16, 2026
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//  Description:
+//
+//		Micro benchmarks for the CoinObjectPool. Run with `CppTests --bench`.
+//      Results are written to std::cout.
+//
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+#include "Benchmark.h"
+#include "CoinLifetimeKernels.h"
+#include "CoinObjectPool.h"
+#include "CoinObjectPoolBenchmarks.h"
+
+
+// The threaded benchmarks run Update() in a tight loop, so "long" lifetimes really need to be long
+static const int NEVER_EXPIRES = 1 << 30;
+
+
+
+// @brief ReleaseCoin as it was before the O(1) release: find the coin in a list of every active coin
+// with std::find and swap-and-pop it out, on top of the work the pool does now.
+static bool LegacyReleaseCoin(CoinObjectPool& _pool, std::vector<CoinHandle>& _activeCoins, CoinHandle _handle)
+{
+    auto it = std::find(_activeCoins.begin(), _activeCoins.end(), _handle);
+    if (it == _activeCoins.end())
+    {
+        return false;
+    }
+    *it = _activeCoins.back();
+    _activeCoins.pop_back();
+    return _pool.ReleaseCoin(_handle);
+}
+
+
+// @brief Measures the cost of releasing active coins while the pool holds 100 to 100,000 of them:
+// in random pickup order, in slot order, and through the old std::find search, which grows with the
+// coin count. A release does the same work at any count, but it unlinks the coin from the active list,
+// the expiry wheel and its grid cell, whose neighbours are scattered. Once the pool outgrows the cache
+// those are misses, so both orders climb at 100,000 coins, random order roughly twice as much.
+void RunCoinReleaseBenchmark()
+{
+    const int activeCounts[] = { 100, 1000, 10000, 100000 };
+    const int roundCount = 200;
+    const int legacyRoundCount = 20;
+    const int maxLegacyReleasesPerRound = 100;
+
+    std::cout << "CoinObjectPool::ReleaseCoin (ns per release)" << std::endl;
+
+    for (int activeCount : activeCounts)
+    {
+        CoinObjectPool pool(activeCount);
+        std::vector<CoinHandle> liveCoins;
+        liveCoins.reserve(activeCount);
+        for (int i = 0; i < activeCount; ++i)
+        {
+            liveCoins.push_back(pool.TrySpawnCoin());
+        }
+
+        // Each round picks up a random 10% of the coins (timed) and then respawns them (untimed),
+        // so the pool stays close to `activeCount` for the whole run.
+        const int releasesPerRound = (activeCount / 10 > 0) ? activeCount / 10 : 1;
+        std::vector<int> pickOrder(activeCount);
+        for (int i = 0; i < activeCount; ++i)
+        {
+            pickOrder[i] = i;
+        }
+
+        auto respawnPicked = [&](int _pickCount)
+        {
+            for (int i = 0; i < _pickCount; ++i)
+            {
+                liveCoins[pickOrder[i]] = pool.TrySpawnCoin();
+            }
+        };
+
+        std::mt19937 rng(1234);
+        double randomNanoseconds = 0.0;
+        double slotOrderNanoseconds = 0.0;
+        for (int round = 0; round < roundCount; ++round)
+        {
+            std::shuffle(pickOrder.begin(), pickOrder.end(), rng);
+
+            BenchmarkTimer timer;
+            for (int i = 0; i < releasesPerRound; ++i)
+            {
+                pool.ReleaseCoin(liveCoins[pickOrder[i]]);
+            }
+            randomNanoseconds += timer.GetElapsedNanoseconds();
+            respawnPicked(releasesPerRound);
+
+            // The same coins again, walked in slot order so the hardware prefetcher can keep up
+            std::sort(pickOrder.begin(), pickOrder.begin() + releasesPerRound,
+                      [&](int _a, int _b) { return liveCoins[_a].GetSlot() < liveCoins[_b].GetSlot(); });
+
+            timer.Restart();
+            for (int i = 0; i < releasesPerRound; ++i)
+            {
+                pool.ReleaseCoin(liveCoins[pickOrder[i]]);
+            }
+            slotOrderNanoseconds += timer.GetElapsedNanoseconds();
+            respawnPicked(releasesPerRound);
+        }
+
+        // ~~~ The old std::find search, over fewer releases since each one walks the active list ~~~
+        const int legacyReleasesPerRound = std::min(releasesPerRound, maxLegacyReleasesPerRound);
+        std::vector<CoinHandle> activeList(liveCoins);
+        std::shuffle(activeList.begin(), activeList.end(), rng);
+        double legacyNanoseconds = 0.0;
+        bool isLegacyReleasing = true;
+        for (int round = 0; round < legacyRoundCount; ++round)
+        {
+            std::shuffle(pickOrder.begin(), pickOrder.end(), rng);
+
+            BenchmarkTimer timer;
+            for (int i = 0; i < legacyReleasesPerRound; ++i)
+            {
+                isLegacyReleasing &= LegacyReleaseCoin(pool, activeList, liveCoins[pickOrder[i]]);
+            }
+            legacyNanoseconds += timer.GetElapsedNanoseconds();
+
+            respawnPicked(legacyReleasesPerRound);
+            for (int i = 0; i < legacyReleasesPerRound; ++i)
+            {
+                activeList.push_back(liveCoins[pickOrder[i]]);
+            }
+        }
+        DoNotOptimise(liveCoins);
+        DoNotOptimise(isLegacyReleasing);
+
+        double releaseCount = (double)roundCount * releasesPerRound;
+        std::cout << "    " << activeCount << " active coins: random order " << (randomNanoseconds / releaseCount)
+                  << ", slot order " << (slotOrderNanoseconds / releaseCount)
+                  << ", old std::find " << (legacyNanoseconds / ((double)legacyRoundCount * legacyReleasesPerRound)) << std::endl;
+    }
+}
+
+
+// @brief Spawns and releases bursts of 10, 100 and 1,000 coins, one call per coin against
+// TrySpawnCoins / ReleaseCoins, with one Update() per burst. Runs in both threading modes.
+void RunCoinBurstBenchmark()
+{
+    const size_t burstSizes[] = { 10, 100, 1000 };
+    const size_t coinsPerRun = 1000000;
+    const CoinPoolThreading threadingModes[] = { CoinPoolThreading::SINGLE_THREADED, CoinPoolThreading::CONCURRENT };
+
+    std::cout << "CoinObjectPool burst spawn + release (ns per coin)" << std::endl;
+
+    for (CoinPoolThreading threading : threadingModes)
+    {
+        for (size_t burstSize : burstSizes)
+        {
+            const size_t burstCount = coinsPerRun / burstSize;
+            std::vector<CoinHandle> burst(burstSize);
+
+            // ~~~ One call per coin ~~~
+            CoinObjectPool singlePool(10000, threading);
+            BenchmarkTimer timer;
+            for (size_t b = 0; b < burstCount; ++b)
+            {
+                for (CoinHandle& coin : burst)
+                {
+                    coin = singlePool.TrySpawnCoin(NEVER_EXPIRES);
+                }
+                for (CoinHandle coin : burst)
+                {
+                    singlePool.ReleaseCoin(coin);
+                }
+                singlePool.Update();
+            }
+            double singleNanoseconds = timer.GetElapsedNanoseconds();
+            DoNotOptimise(burst);
+
+            // ~~~ Batched ~~~
+            CoinObjectPool batchPool(10000, threading);
+            timer.Restart();
+            for (size_t b = 0; b < burstCount; ++b)
+            {
+                batchPool.TrySpawnCoins(burstSize, NEVER_EXPIRES, burst, CoinBatchFill::ALL_OR_NOTHING);
+                batchPool.ReleaseCoins(burst);
+                batchPool.Update();
+            }
+            double batchNanoseconds = timer.GetElapsedNanoseconds();
+            DoNotOptimise(burst);
+
+            double coinCount = (double)(burstCount * burstSize);
+            std::cout << "    " << ((threading == CoinPoolThreading::CONCURRENT) ? "CONCURRENT" : "SINGLE_THREADED")
+                      << ", burst of " << burstSize << ": one at a time " << (singleNanoseconds / coinCount)
+                      << ", batched " << (batchNanoseconds / coinCount) << std::endl;
+        }
+    }
+}
+
+
+// @brief 64 players looking for coins to pick up among 10,000 coins, brute force over every
+// coin against CollectCoinsInRadius. Also checks that both find the same coins, and that huge,
+// infinite, negative and NaN radii and non-finite positions give sensible answers.
+// @return true if every check passed.
+bool RunCoinPickupQueryBenchmark()
+{
+    const int coinCount = 10000;
+    const int playerCount = 64;
+    const int frameCount = 100;
+    const float worldSize = 500.0f;
+    const float pickupRadius = 2.0f;
+
+    CoinObjectPool pool(coinCount, CoinPoolThreading::SINGLE_THREADED, pickupRadius * 2.0f);
+    std::mt19937 rng(99);
+    std::uniform_real_distribution<float> worldPosition(0.0f, worldSize);
+
+    std::vector<CoinHandle> coins;
+    for (int i = 0; i < coinCount; ++i)
+    {
+        coins.push_back(pool.TrySpawnCoin(NEVER_EXPIRES, Vector3(worldPosition(rng), 0.0f, worldPosition(rng))));
+    }
+
+    std::vector<Vector3> players;
+    for (int i = 0; i < playerCount; ++i)
+    {
+        players.push_back(Vector3(worldPosition(rng), 0.0f, worldPosition(rng)));
+    }
+
+    // ~~~ Brute force ~~~
+    size_t bruteForceFound = 0;
+    BenchmarkTimer timer;
+    for (int frame = 0; frame < frameCount; ++frame)
+    {
+        for (const Vector3& player : players)
+        {
+            for (CoinHandle coin : coins)
+            {
+                if ((pool.Resolve(coin)->GetPosition() - player).MagnitudeSqr() <= pickupRadius * pickupRadius)
+                {
+                    ++bruteForceFound;
+                }
+            }
+        }
+    }
+    double bruteForceNanoseconds = timer.GetElapsedNanoseconds();
+
+    // ~~~ Spatial grid ~~~
+    size_t gridFound = 0;
+    std::vector<CoinHandle> nearbyCoins(coinCount);
+    timer.Restart();
+    for (int frame = 0; frame < frameCount; ++frame)
+    {
+        for (const Vector3& player : players)
+        {
+            gridFound += pool.CollectCoinsInRadius(player, pickupRadius, nearbyCoins);
+        }
+    }
+    double gridNanoseconds = timer.GetElapsedNanoseconds();
+    DoNotOptimise(nearbyCoins);
+
+    double queryCount = (double)frameCount * playerCount;
+    std::cout << "CoinObjectPool pickup query (" << coinCount << " coins, " << playerCount << " players, ns per player)" << std::endl;
+    std::cout << "    brute force: " << (bruteForceNanoseconds / queryCount)
+              << ", spatial grid: " << (gridNanoseconds / queryCount)
+              << ((bruteForceFound == gridFound) ? "" : "  (MISMATCH)") << std::endl;
+
+    // ~~~ Edge cases ~~~
+    // 62 ordinary coins plus one at NaN and one at infinity. A huge radius takes every ordinary coin
+    // without walking its ~10^23 cells, an infinite one the coin at infinity too, and negative or NaN
+    // radii and a NaN centre find nothing.
+    const float infinity = std::numeric_limits<float>::infinity();
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    const size_t edgeCoinCount = 64;
+    CoinObjectPool edgePool(edgeCoinCount, CoinPoolThreading::SINGLE_THREADED, pickupRadius * 2.0f);
+    for (size_t i = 0; i < edgeCoinCount - 2; ++i)
+    {
+        edgePool.TrySpawnCoin(NEVER_EXPIRES, Vector3(worldPosition(rng), 0.0f, worldPosition(rng)));
+    }
+    edgePool.TrySpawnCoin(NEVER_EXPIRES, Vector3(nan, 0.0f, 0.0f));
+    edgePool.TrySpawnCoin(NEVER_EXPIRES, Vector3(infinity, 0.0f, 0.0f));
+    const Vector3 origin(0.0f, 0.0f, 0.0f);
+    bool isEdgeOk = edgePool.CollectCoinsInRadius(origin, 1e8f, nearbyCoins) == edgeCoinCount - 2
+        && edgePool.CollectCoinsInRadius(origin, infinity, nearbyCoins) == edgeCoinCount - 1
+        && edgePool.CollectCoinsInRadius(origin, -1.0f, nearbyCoins) == 0
+        && edgePool.CollectCoinsInRadius(origin, nan, nearbyCoins) == 0
+        && edgePool.CollectCoinsInRadius(Vector3(nan, 0.0f, 0.0f), pickupRadius, nearbyCoins) == 0
+        && edgePool.CollectCoinsInRadius(Vector3(infinity, 0.0f, 0.0f), pickupRadius, nearbyCoins) == 0;
+    std::cout << "    huge, infinite, negative and NaN radii and non-finite positions: " << (isEdgeOk ? "OK" : "FAILED") << std::endl;
+
+    return bruteForceFound == gridFound && isEdgeOk;
+}
+
+
+// @brief Times the DENSE_SWEEP lifetime kernels over 100,000 coins for 300 frames and checks that
+// every SIMD kernel gives exactly the same lifetimes and expired indices as the scalar one.
+// @return true if all kernels agreed.
+bool RunCoinLifetimeKernelBenchmark()
+{
+    typedef size_t (*DecrementLifetimesKernel)(int32_t*, size_t, uint32_t*);
+    struct NamedKernel
+    {
+        const char* m_name;
+        DecrementLifetimesKernel m_kernel;
+    };
+
+    std::vector<NamedKernel> kernels;
+    kernels.push_back({ "scalar", &DecrementLifetimesScalar });
+#ifdef COIN_LIFETIME_KERNELS_X86
+    kernels.push_back({ "SSE2", &DecrementLifetimesSSE2 });
+    if (IsAVX2Supported())
+    {
+        kernels.push_back({ "AVX2", &DecrementLifetimesAVX2 });
+    }
+#endif
+
+    // An odd count so the scalar tail of the SIMD kernels gets used too
+    const size_t coinCount = 100003;
+    const int frameCount = 300;
+
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int32_t> lifetime(1, frameCount);
+    std::vector<int32_t> startLifetimes(coinCount);
+    for (int32_t& frames : startLifetimes)
+    {
+        frames = lifetime(rng);
+    }
+
+    std::cout << "CoinObjectPool DENSE_SWEEP lifetime kernels (" << coinCount << " coins, ns per coin per frame)" << std::endl;
+
+    std::vector<int32_t> referenceLifetimes;
+    std::vector<uint32_t> referenceExpired;
+    bool isIdentical = true;
+    for (const NamedKernel& kernel : kernels)
+    {
+        std::vector<int32_t> lifetimes = startLifetimes;
+        std::vector<uint32_t> expiredIndices(coinCount);
+        std::vector<uint32_t> allExpired;
+
+        double nanoseconds = 0.0;
+        for (int frame = 0; frame < frameCount; ++frame)
+        {
+            BenchmarkTimer timer;
+            size_t expiredCount = kernel.m_kernel(lifetimes.data(), coinCount, expiredIndices.data());
+            nanoseconds += timer.GetElapsedNanoseconds();
+            allExpired.insert(allExpired.end(), expiredIndices.begin(), expiredIndices.begin() + expiredCount);
+        }
+
+        if (referenceLifetimes.empty())
+        {
+            referenceLifetimes = lifetimes;
+            referenceExpired = allExpired;
+        }
+        else if (lifetimes != referenceLifetimes || allExpired != referenceExpired)
+        {
+            isIdentical = false;
+        }
+
+        std::cout << "    " << kernel.m_name << ": " << (nanoseconds / ((double)coinCount * frameCount)) << std::endl;
+    }
+
+    std::cout << "    kernels agree: " << (isIdentical ? "OK" : "FAILED") << std::endl;
+    return isIdentical;
+}
+
+
+// @brief A wave of 10,000 coins that all expire on the same frame. Times that frame's Update() and
+// a quiet frame's Update() for both expiry modes, then dumps the pool telemetry.
+void RunCoinExpiryWaveBenchmark()
+{
+    const int coinCount = 10000;
+    const int lifetimeFrames = 300;
+    const CoinExpiryMode expiryModes[] = { CoinExpiryMode::TIMING_WHEEL, CoinExpiryMode::DENSE_SWEEP };
+
+    std::cout << "CoinObjectPool expiry wave (" << coinCount << " coins expiring on one frame, microseconds per Update)" << std::endl;
+
+    for (CoinExpiryMode expiryMode : expiryModes)
+    {
+        CoinObjectPool pool(coinCount, CoinPoolThreading::SINGLE_THREADED, 4.0f, expiryMode);
+        std::vector<CoinHandle> coins(coinCount);
+        pool.TrySpawnCoins(coinCount, lifetimeFrames, coins);
+
+        // Pick one coin up per frame until just before the wave, so the pickup histogram has something in it
+        for (int frame = 0; frame < lifetimeFrames - 2; ++frame)
+        {
+            pool.Update();
+            pool.ReleaseCoin(coins[frame]);
+        }
+
+        BenchmarkTimer timer;
+        pool.Update();
+        double quietNanoseconds = timer.GetElapsedNanoseconds();
+
+        timer.Restart();
+        pool.Update();
+        double waveNanoseconds = timer.GetElapsedNanoseconds();
+
+        std::cout << "    " << ((expiryMode == CoinExpiryMode::DENSE_SWEEP) ? "DENSE_SWEEP" : "TIMING_WHEEL")
+                  << ": quiet frame " << (quietNanoseconds / 1000.0) << ", wave frame " << (waveNanoseconds / 1000.0)
+                  << ((pool.GetActiveCoinCount() == 0) ? "" : "  (COINS LEFT OVER)") << std::endl;
+
+        if (expiryMode == CoinExpiryMode::TIMING_WHEEL)
+        {
+            pool.DumpTelemetry(std::cout);
+        }
+    }
+}
+
+
+// @brief Sustained overload: 100 coins with a 300 frame lifetime are asked for every frame, three times
+// what a 10,000 coin pool can hold, for 1,200 frames. Compares the exhaustion policies, plus a
+// FAIL_SPAWN pool that was grown to fit up front with an explicit Grow().
+void RunCoinExhaustionBenchmark()
+{
+    const int poolSize = 10000;
+    const int spawnsPerFrame = 100;
+    const int lifetimeFrames = 300;
+    const int frameCount = 1200;
+
+    struct Scenario
+    {
+        const char* name;
+        CoinExhaustionPolicy policy;
+        size_t growUpFront;
+    };
+    const Scenario scenarios[] =
+    {
+        { "FAIL_SPAWN", CoinExhaustionPolicy::FAIL_SPAWN, 0 },
+        { "RECYCLE_SOONEST_EXPIRING", CoinExhaustionPolicy::RECYCLE_SOONEST_EXPIRING, 0 },
+        { "GROW_BY_CHUNK", CoinExhaustionPolicy::GROW_BY_CHUNK, 0 },
+        { "Grow() up front", CoinExhaustionPolicy::FAIL_SPAWN, (size_t)(spawnsPerFrame * lifetimeFrames - poolSize) },
+    };
+
+    std::cout << "CoinObjectPool under sustained overload (" << spawnsPerFrame << " spawns per frame, " << lifetimeFrames
+              << " frame lifetime, " << poolSize << " coin pool)" << std::endl;
+
+    for (const Scenario& scenario : scenarios)
+    {
+        CoinObjectPool pool(poolSize);
+        pool.SetExhaustionPolicy(scenario.policy);
+        pool.Grow(scenario.growUpFront);
+
+        std::mt19937 rng(1234);
+        std::uniform_real_distribution<float> coordinate(-100.0f, 100.0f);
+
+        size_t spawnedCount = 0;
+        double totalNanoseconds = 0.0;
+        double worstFrameNanoseconds = 0.0;
+        for (int frame = 0; frame < frameCount; ++frame)
+        {
+            Vector3 position(coordinate(rng), 0.0f, coordinate(rng));
+
+            BenchmarkTimer timer;
+            for (int i = 0; i < spawnsPerFrame; ++i)
+            {
+                spawnedCount += pool.TrySpawnCoin(lifetimeFrames, position).IsValid() ? 1 : 0;
+            }
+            pool.Update();
+            double frameNanoseconds = timer.GetElapsedNanoseconds();
+
+            totalNanoseconds += frameNanoseconds;
+            worstFrameNanoseconds = std::max(worstFrameNanoseconds, frameNanoseconds);
+        }
+
+        const double requestCount = (double)spawnsPerFrame * frameCount;
+        std::cout << "    " << scenario.name << ": " << (totalNanoseconds / requestCount) << " ns per spawn, "
+                  << (100.0 * spawnedCount / requestCount) << "% served, worst frame " << (worstFrameNanoseconds / 1000.0)
+                  << " us, " << pool.GetActiveCoinCount() << " active of " << pool.GetTotalCoinCount()
+                  << ", " << pool.GetTelemetry().reclaimedCount << " reclaimed" << std::endl;
+    }
+}
+
+
+// @brief Rollback netcode pattern on a full 10,000 coin pool: one capture per frame (full every 8th
+// frame, deltas otherwise) while 100 coins are spawned and 100 picked up per frame, then rolling back
+// 8 frames. Times every capture and restore and checks that re-simulating gives the same coins, and
+// that skipped, corrupted and stale deltas, and expiry heaps with a repeated slot or out of order, are
+// refused with the pool left as it was.
+// @return true if the re-simulated frames matched the original ones and every bad snapshot was refused.
+bool RunCoinSnapshotBenchmark()
+{
+    const int poolSize = 10000;
+    const int churnPerFrame = 100;
+    const int rollbackFrames = 8;
+
+    CoinObjectPool pool(poolSize);
+    std::vector<CoinHandle> filler(poolSize - churnPerFrame);
+    pool.TrySpawnCoins(filler.size(), NEVER_EXPIRES, filler);
+
+    std::vector<std::vector<std::byte>> snapshots(rollbackFrames, std::vector<std::byte>(pool.GetMaxSnapshotSize()));
+    std::vector<size_t> snapshotSizes(rollbackFrames);
+
+    // One frame of play: pick up some coins, spawn new ones, then report which handles were handed out
+    auto simulateFrame = [&](int _frame)
+    {
+        std::mt19937 rng(_frame);
+        std::vector<CoinHandle> spawned(churnPerFrame);
+        for (int i = 0; i < churnPerFrame; ++i)
+        {
+            pool.ReleaseCoin(filler[rng() % filler.size()]);
+        }
+        pool.TrySpawnCoins(churnPerFrame, 60, spawned);
+        pool.Update();
+        return spawned;
+    };
+
+    std::vector<std::vector<CoinHandle>> originalSpawns(rollbackFrames);
+    double fullCaptureNanoseconds = 0.0;
+    double deltaCaptureNanoseconds = 0.0;
+    for (int frame = 0; frame < rollbackFrames; ++frame)
+    {
+        BenchmarkTimer timer;
+        snapshotSizes[frame] = (frame == 0) ? pool.CaptureSnapshot(snapshots[frame]) : pool.CaptureDeltaSnapshot(snapshots[frame]);
+        double nanoseconds = timer.GetElapsedNanoseconds();
+        ((frame == 0) ? fullCaptureNanoseconds : deltaCaptureNanoseconds) += nanoseconds;
+
+        originalSpawns[frame] = simulateFrame(frame);
+    }
+
+    // Back to the start of the last frame: the full snapshot, then every delta after it in order
+    BenchmarkTimer timer;
+    bool isIdentical = pool.RestoreSnapshot(std::span<const std::byte>(snapshots[0].data(), snapshotSizes[0]));
+    double fullRestoreNanoseconds = timer.GetElapsedNanoseconds();
+
+    double deltaRestoreNanoseconds = 0.0;
+    for (int frame = 1; frame < rollbackFrames; ++frame)
+    {
+        timer.Restart();
+        isIdentical &= pool.RestoreSnapshot(std::span<const std::byte>(snapshots[frame].data(), snapshotSizes[frame]));
+        deltaRestoreNanoseconds += timer.GetElapsedNanoseconds();
+    }
+    isIdentical &= (simulateFrame(rollbackFrames - 1) == originalSpawns[rollbackFrames - 1]);
+
+    // And all the way back to the full snapshot, replaying every frame. On the way, a delta that skips
+    // the one before it and a delta corrupted at its very end must both be refused without touching the
+    // pool, or frame 0 would not replay the same. The corruption is the index of the last block of grid
+    // buckets, pointed past the end, which is the last thing a restore reads.
+    isIdentical &= pool.RestoreSnapshot(std::span<const std::byte>(snapshots[0].data(), snapshotSizes[0]));
+    bool isRejected = pool.RestoreSnapshot(std::span<const std::byte>(snapshots[2].data(), snapshotSizes[2])) == false;
+    std::vector<std::byte> corrupted(snapshots[1].begin(), snapshots[1].begin() + snapshotSizes[1]);
+    std::fill_n(corrupted.end() - (DirtyBlockSet::BLOCK_SIZE + 1) * sizeof(uint32_t), sizeof(uint32_t), std::byte{ 0xFF });
+    isRejected &= pool.RestoreSnapshot(corrupted) == false;
+    for (int frame = 0; frame < rollbackFrames; ++frame)
+    {
+        isIdentical &= (simulateFrame(frame) == originalSpawns[frame]);
+    }
+
+    // The pool has moved on from the state the first delta was taken against
+    isRejected &= pool.RestoreSnapshot(std::span<const std::byte>(snapshots[1].data(), snapshotSizes[1])) == false;
+
+    // Under RECYCLE_SOONEST_EXPIRING the expiry heap goes across too. A heap naming one slot twice, or
+    // with a coin ahead of one that expires sooner, must be refused, and the real snapshot still restores.
+    // The heap is found by its entry count followed by the sooner coin's expiry frame.
+    CoinObjectPool heapPool(16);
+    heapPool.SetExhaustionPolicy(CoinExhaustionPolicy::RECYCLE_SOONEST_EXPIRING);
+    heapPool.TrySpawnCoin(8765);
+    heapPool.TrySpawnCoin(4321);
+    std::vector<std::byte> heapSnapshot(heapPool.GetMaxSnapshotSize());
+    heapSnapshot.resize(heapPool.CaptureSnapshot(heapSnapshot));
+    const uint32_t heapStart[] = { 2, 4321 };
+    auto heapBytes = std::search(heapSnapshot.begin(), heapSnapshot.end(),
+                                 reinterpret_cast<const std::byte*>(heapStart), reinterpret_cast<const std::byte*>(heapStart) + sizeof(heapStart));
+    isRejected &= (heapBytes != heapSnapshot.end());
+    if (heapBytes != heapSnapshot.end())
+    {
+        const size_t entryOffset = (heapBytes - heapSnapshot.begin()) + sizeof(uint32_t);
+        const size_t entrySize = 2 * sizeof(uint32_t);
+
+        std::vector<std::byte> duplicated = heapSnapshot;
+        std::copy_n(heapSnapshot.begin() + entryOffset + sizeof(uint32_t), sizeof(uint32_t), duplicated.begin() + entryOffset + entrySize + sizeof(uint32_t));
+        isRejected &= heapPool.RestoreSnapshot(duplicated) == false;
+
+        std::vector<std::byte> outOfOrder = heapSnapshot;
+        std::swap_ranges(outOfOrder.begin() + entryOffset, outOfOrder.begin() + entryOffset + entrySize, outOfOrder.begin() + entryOffset + entrySize);
+        isRejected &= heapPool.RestoreSnapshot(outOfOrder) == false;
+
+        isRejected &= heapPool.RestoreSnapshot(heapSnapshot);
+    }
+
+    size_t deltaBytes = 0;
+    for (int frame = 1; frame < rollbackFrames; ++frame)
+    {
+        deltaBytes += snapshotSizes[frame];
+    }
+    const int deltaCount = rollbackFrames - 1;
+
+    std::cout << "CoinObjectPool snapshots (" << poolSize << " coins, " << churnPerFrame << " spawned and picked up per frame, microseconds)" << std::endl;
+    std::cout << "    full: " << snapshotSizes[0] << " bytes, capture " << (fullCaptureNanoseconds / 1000.0)
+              << ", restore " << (fullRestoreNanoseconds / 1000.0) << std::endl;
+    std::cout << "    delta: " << (deltaBytes / deltaCount) << " bytes, capture " << (deltaCaptureNanoseconds / deltaCount / 1000.0)
+              << ", restore " << (deltaRestoreNanoseconds / deltaCount / 1000.0) << std::endl;
+    std::cout << "    " << rollbackFrames << " frame rollback: " << ((fullRestoreNanoseconds + deltaRestoreNanoseconds) / 1000.0)
+              << ", re-simulation " << (isIdentical ? "matches" : "DIFFERS") << std::endl;
+    std::cout << "    skipped, corrupted and stale deltas and bad expiry heaps refused: " << (isRejected ? "OK" : "FAILED") << std::endl;
+    return isIdentical && isRejected;
+}
+
+
+// @brief Hammers a CONCURRENT pool from 8 threads while another thread runs Update(), and checks
+// that no coin is ever handed to two owners, that released handles go stale, and that every slot
+// comes back afterwards. A quarter of the coins expire after a few frames, so Update() races their
+// owners' releases, and every coin must end exactly once.
+// Every other thread goes through a CoinThreadCache, so both paths run against each other.
+// @return true if the pool stayed consistent.
+bool RunConcurrentCoinPoolStressTest()
+{
+    const int poolSize = 10000;
+    const int threadCount = 8;
+    const int spawnsPerThread = 200000;
+    const int maxHeldPerThread = 64;
+
+    CoinObjectPool pool(poolSize, CoinPoolThreading::CONCURRENT);
+
+    // Indexed by the handle's slot. owners only tracks coins that never expire: a coin Update() expires
+    // is recycled without its owner hearing about it. lastGenerations covers every coin.
+    std::vector<std::atomic<int>> owners(poolSize);
+    std::vector<std::atomic<uint32_t>> lastGenerations(poolSize);
+    for (std::atomic<uint32_t>& generation : lastGenerations)
+    {
+        generation.store(CoinHandle::INVALID_VALUE);
+    }
+    std::atomic<int> errorCount(0);
+    std::atomic<size_t> spawnCount(0);
+    std::atomic<size_t> releaseCount(0);
+    std::atomic<bool> workersDone(false);
+
+    auto worker = [&](int _threadId)
+    {
+        struct HeldCoin
+        {
+            CoinHandle handle;
+            bool canExpire;
+        };
+
+        std::mt19937 rng(_threadId);
+        std::vector<HeldCoin> heldCoins;
+        CoinThreadCache threadCache(pool);
+        const bool useThreadCache = (_threadId & 1) != 0;
+        auto release = [&](CoinHandle _coin) { return useThreadCache ? threadCache.ReleaseCoin(_coin) : pool.ReleaseCoin(_coin); };
+        size_t threadSpawns = 0;
+        size_t threadReleases = 0;
+        for (int i = 0; i < spawnsPerThread; ++i)
+        {
+            // Keep well clear of exhaustion; released slots only come back when Update() runs,
+            // and a thread cache takes a whole batch of slots at once
+            while (pool.GetFreeCoinCount() < (size_t)threadCount * CoinThreadCache::MAGAZINE_SIZE)
+            {
+                std::this_thread::yield();
+            }
+
+            // A quarter of the coins live a few frames, so Update() is expiring coins while their owners
+            // resolve and release them
+            const bool canExpire = (rng() & 3) == 0;
+            const int lifetimeFrames = canExpire ? 1 + (int)(rng() % 4) : NEVER_EXPIRES;
+            CoinHandle coin = useThreadCache ? threadCache.TrySpawnCoin(lifetimeFrames) : pool.TrySpawnCoin(lifetimeFrames);
+            if (coin.IsValid() == false)
+            {
+                ++errorCount;
+                continue;
+            }
+            ++threadSpawns;
+
+            // Handing out the slot again under the same generation would mean two live handles to one coin
+            if (lastGenerations[coin.GetSlot()].exchange(coin.GetGeneration()) == coin.GetGeneration()
+                || (canExpire == false && owners[coin.GetSlot()].exchange(_threadId + 1) != 0))
+            {
+                ++errorCount;
+            }
+            heldCoins.push_back({ coin, canExpire });
+
+            if ((int)heldCoins.size() >= maxHeldPerThread || (rng() & 1) != 0)
+            {
+                size_t victim = rng() % heldCoins.size();
+                HeldCoin releasedCoin = heldCoins[victim];
+                heldCoins[victim] = heldCoins.back();
+                heldCoins.pop_back();
+
+                if (releasedCoin.canExpire == false && owners[releasedCoin.handle.GetSlot()].exchange(0) != _threadId + 1)
+                {
+                    ++errorCount;
+                }
+
+                // A coin that cannot expire must be released by its owner. One that can may have lost the
+                // race to Update(). Either way, from then on the handle must be stale.
+                // Resolving races Update() for coins that can expire, so only the owner-only coins are read
+                const Coin* resolved = pool.Resolve(releasedCoin.handle);
+                if (releasedCoin.canExpire == false)
+                {
+                    DoNotOptimise(resolved->GetPosition());
+                }
+                bool wasReleased = release(releasedCoin.handle);
+                threadReleases += wasReleased ? 1 : 0;
+                if ((wasReleased == false && releasedCoin.canExpire == false)
+                    || pool.Resolve(releasedCoin.handle) != nullptr || pool.ReleaseCoin(releasedCoin.handle))
+                {
+                    ++errorCount;
+                }
+            }
+        }
+
+        for (const HeldCoin& coin : heldCoins)
+        {
+            if (coin.canExpire == false)
+            {
+                owners[coin.handle.GetSlot()].exchange(0);
+            }
+            threadReleases += pool.ReleaseCoin(coin.handle) ? 1 : 0;
+        }
+        spawnCount += threadSpawns;
+        releaseCount += threadReleases;
+        // threadCache flushes and returns its free slots when it goes out of scope
+    };
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < threadCount; ++i)
+    {
+        threads.emplace_back(worker, i);
+    }
+
+    std::thread updateThread([&]()
+    {
+        while (workersDone.load() == false)
+        {
+            pool.Update();
+        }
+    });
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+    workersDone.store(true);
+    updateThread.join();
+
+    pool.Update();
+    bool isConsistent = errorCount.load() == 0
+        && pool.GetActiveCoinCount() == 0
+        && pool.GetFreeCoinCount() == pool.GetTotalCoinCount();
+
+#if COIN_POOL_ENABLE_TELEMETRY
+    // Every coin ends exactly once, picked up or expired. A coin both released and expired would be
+    // counted twice.
+    CoinPoolTelemetry telemetry = pool.GetTelemetry();
+    isConsistent = isConsistent && telemetry.totalSpawns == spawnCount.load()
+        && telemetry.totalReleases == releaseCount.load()
+        && telemetry.totalReleases + telemetry.totalExpiries == spawnCount.load();
+#endif
+
+    std::cout << "CoinObjectPool CONCURRENT stress test (" << threadCount << " threads, "
+              << spawnCount.load() - releaseCount.load() << " coins expired under their owners): "
+              << (isConsistent ? "OK" : "FAILED") << std::endl;
+    return isConsistent;
+}
+
+
+// @brief Spawn + release throughput from 1 to 32 threads, for a CONCURRENT pool used directly,
+// the same pool through per-thread CoinThreadCaches, and a SINGLE_THREADED pool behind a std::mutex.
+// Each pool also has one thread running Update() in a loop.
+void RunConcurrentCoinThroughputBenchmark()
+{
+    const int threadCounts[] = { 1, 2, 4, 8, 16, 32 };
+    const int totalSpawns = 2000000;
+    const int batchSize = 16;
+
+    std::cout << "CoinObjectPool spawn + release throughput (million coins per second, plus one Update() thread each)" << std::endl;
+
+    for (int threadCount : threadCounts)
+    {
+        const int spawnsPerThread = totalSpawns / threadCount;
+
+        // ~~~ Lock-free ~~~
+        CoinObjectPool concurrentPool(10000, CoinPoolThreading::CONCURRENT);
+        std::atomic<bool> workersDone(false);
+        std::thread updateThread([&]()
+        {
+            while (workersDone.load() == false)
+            {
+                concurrentPool.Update();
+            }
+        });
+
+        BenchmarkTimer timer;
+        std::vector<std::thread> threads;
+        for (int t = 0; t < threadCount; ++t)
+        {
+            threads.emplace_back([&]()
+            {
+                CoinHandle batch[batchSize];
+                for (int i = 0; i < spawnsPerThread; i += batchSize)
+                {
+                    while (concurrentPool.GetFreeCoinCount() < (size_t)(threadCount * batchSize))
+                    {
+                        std::this_thread::yield();
+                    }
+                    for (CoinHandle& coin : batch)
+                    {
+                        coin = concurrentPool.TrySpawnCoin(NEVER_EXPIRES);
+                    }
+                    for (CoinHandle coin : batch)
+                    {
+                        concurrentPool.ReleaseCoin(coin);
+                    }
+                }
+            });
+        }
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+        double concurrentNanoseconds = timer.GetElapsedNanoseconds();
+        workersDone.store(true);
+        updateThread.join();
+
+        // ~~~ Lock-free + thread caches ~~~
+        CoinObjectPool cachedPool(10000, CoinPoolThreading::CONCURRENT);
+        workersDone.store(false);
+        std::thread cachedUpdateThread([&]()
+        {
+            while (workersDone.load() == false)
+            {
+                cachedPool.Update();
+            }
+        });
+
+        timer.Restart();
+        threads.clear();
+        for (int t = 0; t < threadCount; ++t)
+        {
+            threads.emplace_back([&]()
+            {
+                CoinThreadCache threadCache(cachedPool);
+                CoinHandle batch[batchSize];
+                for (int i = 0; i < spawnsPerThread; i += batchSize)
+                {
+                    while (cachedPool.GetFreeCoinCount() < (size_t)(threadCount * CoinThreadCache::MAGAZINE_SIZE))
+                    {
+                        std::this_thread::yield();
+                    }
+                    for (CoinHandle& coin : batch)
+                    {
+                        coin = threadCache.TrySpawnCoin(NEVER_EXPIRES);
+                    }
+                    for (CoinHandle coin : batch)
+                    {
+                        threadCache.ReleaseCoin(coin);
+                    }
+                }
+            });
+        }
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+        double cachedNanoseconds = timer.GetElapsedNanoseconds();
+        workersDone.store(true);
+        cachedUpdateThread.join();
+
+        // ~~~ Mutex ~~~
+        // With its own Update() thread like the lock-free pools, taking the lock each frame, so all three
+        // run the same number of threads
+        CoinObjectPool lockedPool(10000);
+        std::mutex poolMutex;
+        workersDone.store(false);
+        std::thread lockedUpdateThread([&]()
+        {
+            while (workersDone.load() == false)
+            {
+                std::lock_guard<std::mutex> lock(poolMutex);
+                lockedPool.Update();
+            }
+        });
+
+        timer.Restart();
+        threads.clear();
+        for (int t = 0; t < threadCount; ++t)
+        {
+            threads.emplace_back([&]()
+            {
+                CoinHandle batch[batchSize];
+                for (int i = 0; i < spawnsPerThread; i += batchSize)
+                {
+                    for (CoinHandle& coin : batch)
+                    {
+                        std::lock_guard<std::mutex> lock(poolMutex);
+                        coin = lockedPool.TrySpawnCoin(NEVER_EXPIRES);
+                    }
+                    for (CoinHandle coin : batch)
+                    {
+                        std::lock_guard<std::mutex> lock(poolMutex);
+                        lockedPool.ReleaseCoin(coin);
+                    }
+                }
+            });
+        }
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+        double lockedNanoseconds = timer.GetElapsedNanoseconds();
+        workersDone.store(true);
+        lockedUpdateThread.join();
+
+        double spawnCount = (double)spawnsPerThread * threadCount;
+        std::cout << "    " << threadCount << " threads: lock-free " << (spawnCount * 1000.0 / concurrentNanoseconds)
+                  << ", thread caches " << (spawnCount * 1000.0 / cachedNanoseconds)
+                  << ", mutex " << (spawnCount * 1000.0 / lockedNanoseconds) << std::endl;
+    }
+}
+
+
+// @brief Runs every CoinObjectPool benchmark in turn, carrying on past a failed check so every result
+// is printed.
+// @return true if every benchmark that checks its results passed.
+bool RunCoinObjectPoolBenchmarks()
+{
+    bool isPassing = true;
+    RunCoinReleaseBenchmark();
+    RunCoinBurstBenchmark();
+    isPassing &= RunCoinPickupQueryBenchmark();
+    isPassing &= RunCoinLifetimeKernelBenchmark();
+    RunCoinExpiryWaveBenchmark();
+    RunCoinExhaustionBenchmark();
+    isPassing &= RunCoinSnapshotBenchmark();
+    isPassing &= RunConcurrentCoinPoolStressTest();
+    RunConcurrentCoinThroughputBenchmark();
+    return isPassing;
+}
@@ -0,0 +1,37 @@
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//             Coin Pool Benchmarks Main (cpp)
+//             Author: Christopher A
+//             Date: October 16, 2026
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//  Description:
+//
+//		Entry point of the standalone CoinPoolBenchmarks executable.
+//
+//      CoinPoolBenchmarks              Runs every workload.
+//      CoinPoolBenchmarks <workload>   Runs just that one.
+//      CoinPoolBenchmarks --list       Lists the workloads.
+//
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <cstring>
+#include <iostream>
+#include "CoinPoolWorkloads.h"
+
+
+
+int main(int argc, char* argv[])
+{
+    if (argc > 1 && std::strcmp(argv[1], "--list") == 0)
+    {
+        ListCoinPoolWorkloads(std::cout);
+        return 0;
+    }
+
+    const char* workloadName = (argc > 1) ? argv[1] : nullptr;
+    if (RunCoinPoolWorkloads(workloadName) == 0)
+    {
+        std::cerr << "Unknown workload '" << workloadName << "'. Known workloads:" << std::endl;
+        ListCoinPoolWorkloads(std::cerr);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,430 @@
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//             Coin Pool Workloads (cpp)
+//             Author: Christopher A
+//             Date: October 16, 2026
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//  Description:
+//
+//		Scripted game workloads for judging changes to the CoinObjectPool.
+//      Every workload is seeded, so two runs ask the pool for exactly the same
+//      things and their numbers can be compared directly.
+//
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <vector>
+#include "Benchmark.h"
+#include "CoinObjectPool.h"
+#include "CoinPoolWorkloads.h"
+#include "PerfEventCounters.h"
+
+
+// Players walk around a square world of this size, centred on the origin
+static const float WORLD_SIZE = 200.0f;
+static const int PLAYER_COUNT = 8;
+static const float PICKUP_RADIUS = 2.0f;
+
+
+
+// @brief The pool, the players and the timings of one workload run.
+// Every call into the pool goes through here so it gets timed.
+class WorkloadContext
+{
+public:
+    WorkloadContext(int _poolSize, CoinExpiryMode _expiryMode, CoinExhaustionPolicy _exhaustionPolicy, unsigned int _seed)
+        : m_pool(_poolSize, CoinPoolThreading::SINGLE_THREADED, PICKUP_RADIUS * 2.0f, _expiryMode),
+          m_rng(_seed),
+          m_nearbyCoins(_poolSize),
+          m_spawnNanoseconds(0.0), m_releaseNanoseconds(0.0), m_queryNanoseconds(0.0), m_updateNanoseconds(0.0),
+          m_spawnCount(0), m_failedSpawnCount(0), m_releaseCount(0), m_queryCount(0), m_updateCount(0),
+          m_timerOverheadNanoseconds(MeasureTimerOverhead())
+    {
+        m_pool.SetExhaustionPolicy(_exhaustionPolicy);
+        m_burstHandles.reserve(_poolSize);
+        m_dropPositions.reserve(_poolSize);
+        for (int i = 0; i < PLAYER_COUNT; ++i)
+        {
+            m_players.push_back(GetRandomPosition());
+        }
+    }
+
+    CoinObjectPool& GetPool() { return m_pool; }
+
+    Vector3 GetRandomPosition()
+    {
+        std::uniform_real_distribution<float> coordinate(-WORLD_SIZE * 0.5f, WORLD_SIZE * 0.5f);
+        return Vector3(coordinate(m_rng), 0.0f, coordinate(m_rng));
+    }
+
+    int GetRandomInt(int _min, int _max)
+    {
+        return std::uniform_int_distribution<int>(_min, _max)(m_rng);
+    }
+
+    // @brief An enemy dies somewhere near a player and drops a few coins, one TrySpawnCoin each.
+    // The positions are rolled first and the spawns timed as one batch, as a spawn costs little more
+    // than reading the clock.
+    void DropCoins(int _count, int _lifetimeFrames)
+    {
+        std::uniform_real_distribution<float> offset(-10.0f, 10.0f);
+        const Vector3& player = m_players[GetRandomInt(0, PLAYER_COUNT - 1)];
+        Vector3 position = player + Vector3(offset(m_rng), 0.0f, offset(m_rng));
+
+        m_dropPositions.resize(_count);
+        for (Vector3& scatter : m_dropPositions)
+        {
+            scatter = position + Vector3(offset(m_rng) * 0.1f, 0.0f, offset(m_rng) * 0.1f);
+        }
+
+        size_t failedCount = 0;
+        BenchmarkTimer timer;
+        for (const Vector3& scatter : m_dropPositions)
+        {
+            failedCount += m_pool.TrySpawnCoin(_lifetimeFrames, scatter).IsValid() ? 0 : 1;
+        }
+        m_spawnNanoseconds += GetTimedNanoseconds(timer);
+
+        m_spawnCount += _count;
+        m_failedSpawnCount += failedCount;
+    }
+
+    // @brief A burst of coins all dropped at once through TrySpawnCoins, e.g. a boss dying.
+    void DropCoinBurst(size_t _count, int _lifetimeFrames, const Vector3& _position)
+    {
+        m_burstHandles.resize(_count);
+
+        BenchmarkTimer timer;
+        size_t spawnedCount = m_pool.TrySpawnCoins(_count, _lifetimeFrames, m_burstHandles, CoinBatchFill::PARTIAL_FILL, _position);
+        m_spawnNanoseconds += GetTimedNanoseconds(timer);
+
+        m_spawnCount += _count;
+        m_failedSpawnCount += _count - spawnedCount;
+    }
+
+    // @brief Picks up every coin within _radius of _center.
+    void PickUpCoins(const Vector3& _center, float _radius)
+    {
+        BenchmarkTimer timer;
+        size_t foundCount = m_pool.CollectCoinsInRadius(_center, _radius, m_nearbyCoins);
+        m_queryNanoseconds += GetTimedNanoseconds(timer);
+        ++m_queryCount;
+
+        // Most queries find nothing, and timing those would charge the clock reads to the releases
+        if (foundCount == 0)
+        {
+            return;
+        }
+
+        timer.Restart();
+        for (size_t i = 0; i < foundCount; ++i)
+        {
+            m_pool.ReleaseCoin(m_nearbyCoins[i]);
+        }
+        m_releaseNanoseconds += GetTimedNanoseconds(timer);
+        m_releaseCount += foundCount;
+    }
+
+    // @brief Every player takes a step in a random direction and picks up whatever is under them.
+    void MovePlayersAndPickUp()
+    {
+        std::uniform_real_distribution<float> step(-1.0f, 1.0f);
+        const float halfWorld = WORLD_SIZE * 0.5f;
+        for (Vector3& player : m_players)
+        {
+            player.SetX(std::clamp(player.GetX() + step(m_rng), -halfWorld, halfWorld));
+            player.SetZ(std::clamp(player.GetZ() + step(m_rng), -halfWorld, halfWorld));
+            PickUpCoins(player, PICKUP_RADIUS);
+        }
+    }
+
+    void Update()
+    {
+        BenchmarkTimer timer;
+        m_pool.Update();
+        m_updateNanoseconds += GetTimedNanoseconds(timer);
+        ++m_updateCount;
+    }
+
+    // @brief Writes ns per call for everything timed so far. Releases are per coin picked up, over the
+    // queries that found any.
+    void PrintTimings(std::ostream& _os) const
+    {
+        _os << "ns per spawn " << GetAverage(m_spawnNanoseconds, m_spawnCount)
+            << ", release " << GetAverage(m_releaseNanoseconds, m_releaseCount)
+            << ", pickup query " << GetAverage(m_queryNanoseconds, m_queryCount)
+            << ", Update() " << GetAverage(m_updateNanoseconds, m_updateCount)
+            << " (" << m_timerOverheadNanoseconds << " ns timer overhead taken off each timing)";
+    }
+
+    size_t GetSpawnCount() const { return m_spawnCount; }
+    size_t GetFailedSpawnCount() const { return m_failedSpawnCount; }
+    size_t GetReleaseCount() const { return m_releaseCount; }
+
+private:
+    static double GetAverage(double _nanoseconds, size_t _count)
+    {
+        return (_count > 0) ? _nanoseconds / (double)_count : 0.0;
+    }
+
+    // @brief Median time of an empty BenchmarkTimer, i.e. what starting it and reading it costs alone
+    static double MeasureTimerOverhead()
+    {
+        std::vector<double> samples(1001);
+        for (double& sample : samples)
+        {
+            BenchmarkTimer timer;
+            sample = timer.GetElapsedNanoseconds();
+        }
+        std::sort(samples.begin(), samples.end());
+        return GetPercentile(samples, 50.0);
+    }
+
+    // @brief Time since _timer started, less the timer's own overhead. A single call can come out
+    // negative, but the sums over a run are what get reported.
+    double GetTimedNanoseconds(const BenchmarkTimer& _timer) const
+    {
+        return _timer.GetElapsedNanoseconds() - m_timerOverheadNanoseconds;
+    }
+
+    CoinObjectPool m_pool;
+    std::mt19937 m_rng;
+    std::vector<Vector3> m_players;
+
+    // Scratch buffers, reserved up to the pool size so the workloads do not allocate while being timed
+    std::vector<CoinHandle> m_nearbyCoins;
+    std::vector<CoinHandle> m_burstHandles;
+    std::vector<Vector3> m_dropPositions;
+
+    double m_spawnNanoseconds;
+    double m_releaseNanoseconds;
+    double m_queryNanoseconds;
+    double m_updateNanoseconds;
+    size_t m_spawnCount;
+    size_t m_failedSpawnCount;
+    size_t m_releaseCount;
+    size_t m_queryCount;
+    size_t m_updateCount;
+    double m_timerOverheadNanoseconds;
+};
+
+
+
+// ~~~ Workloads ~~~
+
+static void SetUpNothing(WorkloadContext&)
+{
+}
+
+// @brief A few kills a frame, players collecting as they go.
+static void PlaySteadyDripFrame(WorkloadContext& _context, int)
+{
+    int killCount = _context.GetRandomInt(0, 3);
+    for (int i = 0; i < killCount; ++i)
+    {
+        _context.DropCoins(_context.GetRandomInt(1, 5), 300);
+    }
+    _context.MovePlayersAndPickUp();
+    _context.Update();
+}
+
+// @brief The drip, plus a boss dropping 2,500 coins every 10 seconds.
+static void PlayBossKillFrame(WorkloadContext& _context, int _frame)
+{
+    const int bossIntervalFrames = 600;
+    if (_frame % bossIntervalFrames == bossIntervalFrames - 1)
+    {
+        _context.DropCoinBurst(2500, 300, _context.GetRandomPosition());
+    }
+    PlaySteadyDripFrame(_context, _frame);
+}
+
+// @brief Scatters coins over the whole world until the pool is 95% full. Not timed.
+static void SetUpMassPickup(WorkloadContext& _context)
+{
+    CoinObjectPool& pool = _context.GetPool();
+    size_t coinCount = pool.GetTotalCoinCount() * 95 / 100;
+    for (size_t i = 0; i < coinCount; ++i)
+    {
+        pool.TrySpawnCoin(1 << 30, _context.GetRandomPosition());
+    }
+    pool.Update();
+}
+
+// @brief A coin magnet sweeps the world row by row, pulling in everything near it.
+static void PlayMassPickupFrame(WorkloadContext& _context, int _frame)
+{
+    const float magnetRadius = 10.0f;
+    const int stepsPerRow = (int)(WORLD_SIZE / magnetRadius) + 1;
+
+    int row = _frame / stepsPerRow;
+    int column = _frame % stepsPerRow;
+    if (row % 2 != 0)
+    {
+        column = stepsPerRow - 1 - column;
+    }
+
+    Vector3 magnet(-WORLD_SIZE * 0.5f + column * magnetRadius, 0.0f, -WORLD_SIZE * 0.5f + row * magnetRadius);
+    _context.PickUpCoins(magnet, magnetRadius);
+    _context.MovePlayersAndPickUp();
+    _context.Update();
+}
+
+// @brief 100 coins a frame with a 300 frame lifetime, three times what the pool can hold.
+static void PlayExhaustionFrame(WorkloadContext& _context, int)
+{
+    for (int i = 0; i < 20; ++i)
+    {
+        _context.DropCoins(5, 300);
+    }
+    _context.MovePlayersAndPickUp();
+    _context.Update();
+}
+
+
+struct CoinPoolWorkload
+{
+    const char* m_name;
+    int m_poolSize;
+    int m_frameCount;
+    void (*m_setUp)(WorkloadContext&);
+    void (*m_playFrame)(WorkloadContext&, int _frame);
+
+    // Played once per CoinExhaustionPolicy as well as per expiry mode, rather than under FAIL_SPAWN alone
+    bool m_comparesExhaustionPolicies;
+};
+
+static const int MASS_PICKUP_FRAMES = ((int)(WORLD_SIZE / 10.0f) + 1) * ((int)(WORLD_SIZE / 10.0f) + 1);
+
+static const CoinPoolWorkload s_workloads[] =
+{
+    { "steady-drip",    10000,  3600,               &SetUpNothing,      &PlaySteadyDripFrame,   false },
+    { "boss-kill",      10000,  3600,               &SetUpNothing,      &PlayBossKillFrame,     false },
+    { "mass-pickup",    10000,  MASS_PICKUP_FRAMES, &SetUpMassPickup,   &PlayMassPickupFrame,   false },
+    { "exhaustion",     10000,  1200,               &SetUpNothing,      &PlayExhaustionFrame,   true },
+};
+
+
+
+static const char* GetExhaustionPolicyName(CoinExhaustionPolicy _policy)
+{
+    switch (_policy)
+    {
+    case CoinExhaustionPolicy::RECYCLE_SOONEST_EXPIRING:    return "RECYCLE_SOONEST_EXPIRING";
+    case CoinExhaustionPolicy::GROW_BY_CHUNK:               return "GROW_BY_CHUNK";
+    default:                                                return "FAIL_SPAWN";
+    }
+}
+
+
+// @brief Plays the workload through once and writes out what it measured.
+// @param _isPolicyNamed Whether to name the exhaustion policy, for workloads that compare them.
+static void RunCoinPoolWorkload(const CoinPoolWorkload& _workload, CoinExpiryMode _expiryMode, CoinExhaustionPolicy _exhaustionPolicy, bool _isPolicyNamed)
+{
+    // Same seed for every expiry mode and policy, so they all play out the same game
+    WorkloadContext context(_workload.m_poolSize, _expiryMode, _exhaustionPolicy, 2026);
+    _workload.m_setUp(context);
+
+    std::vector<double> frameNanoseconds;
+    frameNanoseconds.reserve(_workload.m_frameCount);
+
+    // The counters run across the whole workload, so their syscalls stay out of the frame times
+    PerfEventCounters counters;
+    counters.Start();
+    for (int frame = 0; frame < _workload.m_frameCount; ++frame)
+    {
+        BenchmarkTimer timer;
+        _workload.m_playFrame(context, frame);
+        frameNanoseconds.push_back(timer.GetElapsedNanoseconds());
+    }
+    counters.Stop();
+    DoNotOptimise(context);
+
+    std::sort(frameNanoseconds.begin(), frameNanoseconds.end());
+
+    std::cout << "    " << ((_expiryMode == CoinExpiryMode::DENSE_SWEEP) ? "DENSE_SWEEP" : "TIMING_WHEEL");
+    if (_isPolicyNamed)
+    {
+        std::cout << ", " << GetExhaustionPolicyName(_exhaustionPolicy);
+    }
+    std::cout << std::endl;
+    std::cout << "        ";
+    context.PrintTimings(std::cout);
+    std::cout << std::endl;
+
+    std::cout << "        frame us p50 " << (GetPercentile(frameNanoseconds, 50.0) / 1000.0)
+              << ", p90 " << (GetPercentile(frameNanoseconds, 90.0) / 1000.0)
+              << ", p99 " << (GetPercentile(frameNanoseconds, 99.0) / 1000.0)
+              << ", max " << (frameNanoseconds.back() / 1000.0) << std::endl;
+
+    std::cout << "        cache misses per frame: LLC ";
+    if (counters.IsAvailable(PerfCounter::PERF_COUNTER_CACHE_MISSES))
+    {
+        std::cout << (counters.GetCount(PerfCounter::PERF_COUNTER_CACHE_MISSES) / (double)_workload.m_frameCount);
+    }
+    else
+    {
+        std::cout << "n/a";
+    }
+    std::cout << ", L1D ";
+    if (counters.IsAvailable(PerfCounter::PERF_COUNTER_L1D_READ_MISSES))
+    {
+        std::cout << (counters.GetCount(PerfCounter::PERF_COUNTER_L1D_READ_MISSES) / (double)_workload.m_frameCount);
+    }
+    else
+    {
+        std::cout << "n/a";
+    }
+    std::cout << std::endl;
+
+    const CoinObjectPool& pool = context.GetPool();
+    std::cout << "        " << context.GetSpawnCount() << " spawns asked for, " << context.GetFailedSpawnCount() << " turned away, "
+              << context.GetReleaseCount() << " picked up, " << pool.GetActiveCoinCount() << " of " << pool.GetTotalCoinCount()
+              << " active at the end" << std::endl;
+}
+
+
+// @brief Runs the workload called _name, or every workload if _name is nullptr.
+// @return Number of workloads run. 0 means no workload has that name.
+size_t RunCoinPoolWorkloads(const char* _name)
+{
+    const CoinExpiryMode expiryModes[] = { CoinExpiryMode::TIMING_WHEEL, CoinExpiryMode::DENSE_SWEEP };
+    const CoinExhaustionPolicy exhaustionPolicies[] =
+    {
+        CoinExhaustionPolicy::FAIL_SPAWN, CoinExhaustionPolicy::RECYCLE_SOONEST_EXPIRING, CoinExhaustionPolicy::GROW_BY_CHUNK
+    };
+
+    size_t runCount = 0;
+    for (const CoinPoolWorkload& workload : s_workloads)
+    {
+        if (_name != nullptr && std::strcmp(_name, workload.m_name) != 0)
+        {
+            continue;
+        }
+
+        std::cout << "CoinObjectPool workload " << workload.m_name << " (" << workload.m_poolSize << " coins, "
+                  << workload.m_frameCount << " frames)" << std::endl;
+        // Workloads that never run the pool dry would play out the same under every policy
+        size_t policyCount = workload.m_comparesExhaustionPolicies ? std::size(exhaustionPolicies) : 1;
+        for (CoinExpiryMode expiryMode : expiryModes)
+        {
+            for (size_t i = 0; i < policyCount; ++i)
+            {
+                RunCoinPoolWorkload(workload, expiryMode, exhaustionPolicies[i], workload.m_comparesExhaustionPolicies);
+            }
+        }
+        ++runCount;
+    }
+    return runCount;
+}
+
+// @brief Writes the name of every workload, one per line.
+void ListCoinPoolWorkloads(std::ostream& _os)
+{
+    for (const CoinPoolWorkload& workload : s_workloads)
+    {
+        _os << workload.m_name << std::endl;
+    }
+}
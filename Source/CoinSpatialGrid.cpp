@@ -0,0 +1,366 @@
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//             Coin Spatial Grid (cpp)
+//             Author: Christopher A
+//             Date: October 16, 2026
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//  Description:
+//
+//		Uniform spatial hash grid over pool slots, used by the CoinObjectPool
+//      to answer "which coins are near this player" without looking at every
+//      active coin.
+//
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <algorithm>
+#include <cmath>
+#include "CoinSpatialGrid.h"
+
+
+
+// @param _slotCapacity Number of slots that may ever be inserted. Slot indices must be below this.
+// @param _cellSize Edge length of a cell. Roughly the typical query radius works well.
+CoinSpatialGrid::CoinSpatialGrid(size_t _slotCapacity, float _cellSize)
+    : m_cellSize((_cellSize > 0.0f) ? _cellSize : 1.0f),
+      m_inverseCellSize(1.0f / m_cellSize),
+      m_bucketMask(0),
+      m_nextInBucket(_slotCapacity, EMPTY),
+      m_prevInBucket(_slotCapacity, EMPTY),
+      m_bucketOfSlot(_slotCapacity, EMPTY),
+      m_cellKeyOfSlot(_slotCapacity, 0),
+      m_positions(_slotCapacity),
+      m_dirtySlots(_slotCapacity),
+      m_dirtyBuckets(GetBucketCount(_slotCapacity))
+{
+    size_t bucketCount = GetBucketCount(_slotCapacity);
+    m_bucketHeads.assign(bucketCount, EMPTY);
+    m_bucketMask = (uint32_t)(bucketCount - 1);
+}
+
+// @brief Makes room for slots up to _slotCapacity. Slots already in the grid stay in it. Allocates.
+void CoinSpatialGrid::Grow(size_t _slotCapacity)
+{
+    size_t oldSlotCapacity = m_positions.size();
+    m_nextInBucket.resize(_slotCapacity, EMPTY);
+    m_prevInBucket.resize(_slotCapacity, EMPTY);
+    m_bucketOfSlot.resize(_slotCapacity, EMPTY);
+    m_cellKeyOfSlot.resize(_slotCapacity, 0);
+    m_positions.resize(_slotCapacity);
+    m_dirtySlots.Resize(_slotCapacity);
+
+    size_t bucketCount = GetBucketCount(_slotCapacity);
+    if (bucketCount == m_bucketHeads.size())
+    {
+        return;
+    }
+    m_dirtyBuckets.Resize(bucketCount);
+
+    // More buckets means a different mask, so every slot in the grid is hashed again
+    m_bucketHeads.assign(bucketCount, EMPTY);
+    m_bucketMask = (uint32_t)(bucketCount - 1);
+    for (uint32_t slot = 0; slot < (uint32_t)oldSlotCapacity; ++slot)
+    {
+        if (m_bucketOfSlot[slot] != EMPTY)
+        {
+            Insert(slot, m_positions[slot]);
+        }
+    }
+}
+
+
+// @brief Adds a slot to the cell containing _position. The slot must not already be in the grid.
+void CoinSpatialGrid::Insert(uint32_t _slot, const Vector3& _position)
+{
+    int32_t x = GetCellCoordinate(_position.GetX());
+    int32_t y = GetCellCoordinate(_position.GetY());
+    int32_t z = GetCellCoordinate(_position.GetZ());
+    uint32_t bucket = GetBucket(x, y, z);
+
+    m_positions[_slot] = _position;
+    m_cellKeyOfSlot[_slot] = PackCellKey(x, y, z);
+    m_bucketOfSlot[_slot] = bucket;
+
+    uint32_t head = m_bucketHeads[bucket];
+    m_prevInBucket[_slot] = EMPTY;
+    m_nextInBucket[_slot] = head;
+    if (head != EMPTY)
+    {
+        m_prevInBucket[head] = _slot;
+        m_dirtySlots.Mark(head);
+    }
+    m_bucketHeads[bucket] = _slot;
+    m_dirtySlots.Mark(_slot);
+    m_dirtyBuckets.Mark(bucket);
+}
+
+
+// @brief Adds several slots to the cell containing _position, e.g. a burst of coins spawned together.
+// The cell is only worked out once and the slots join its bucket as one chain. None may already be in the grid.
+void CoinSpatialGrid::InsertBatch(std::span<const uint32_t> _slots, const Vector3& _position)
+{
+    if (_slots.empty())
+    {
+        return;
+    }
+
+    int32_t x = GetCellCoordinate(_position.GetX());
+    int32_t y = GetCellCoordinate(_position.GetY());
+    int32_t z = GetCellCoordinate(_position.GetZ());
+    uint32_t bucket = GetBucket(x, y, z);
+    uint64_t cellKey = PackCellKey(x, y, z);
+
+    // Each slot links to its neighbours in _slots, and the last one to the bucket's old head
+    const size_t lastIndex = _slots.size() - 1;
+    uint32_t head = m_bucketHeads[bucket];
+    for (size_t i = 0; i < _slots.size(); ++i)
+    {
+        uint32_t slot = _slots[i];
+        m_positions[slot] = _position;
+        m_cellKeyOfSlot[slot] = cellKey;
+        m_bucketOfSlot[slot] = bucket;
+        m_prevInBucket[slot] = (i > 0) ? _slots[i - 1] : EMPTY;
+        m_nextInBucket[slot] = (i < lastIndex) ? _slots[i + 1] : head;
+        m_dirtySlots.Mark(slot);
+    }
+
+    if (head != EMPTY)
+    {
+        m_prevInBucket[head] = _slots[lastIndex];
+        m_dirtySlots.Mark(head);
+    }
+    m_bucketHeads[bucket] = _slots[0];
+    m_dirtyBuckets.Mark(bucket);
+}
+
+
+// @brief Takes a slot out of its cell in O(1). The slot must be in the grid.
+void CoinSpatialGrid::Remove(uint32_t _slot)
+{
+    uint32_t prev = m_prevInBucket[_slot];
+    uint32_t next = m_nextInBucket[_slot];
+    if (prev != EMPTY)
+    {
+        m_nextInBucket[prev] = next;
+        m_dirtySlots.Mark(prev);
+    }
+    else
+    {
+        m_bucketHeads[m_bucketOfSlot[_slot]] = next;
+        m_dirtyBuckets.Mark(m_bucketOfSlot[_slot]);
+    }
+
+    if (next != EMPTY)
+    {
+        m_prevInBucket[next] = prev;
+        m_dirtySlots.Mark(next);
+    }
+
+    m_dirtySlots.Mark(_slot);
+    m_prevInBucket[_slot] = EMPTY;
+    m_nextInBucket[_slot] = EMPTY;
+    m_bucketOfSlot[_slot] = EMPTY;
+}
+
+
+// @brief Number of cells a query of _radius has to visit. Kept in double, as a huge radius covers
+// more cells than a size_t can count.
+double CoinSpatialGrid::GetCellCountInRadius(float _radius) const
+{
+    // A sphere's bounding box can straddle one more cell than its diameter covers on each axis
+    double cellsPerAxis = std::floor(2.0 * _radius * m_inverseCellSize) + 2.0;
+    return cellsPerAxis * cellsPerAxis * cellsPerAxis;
+}
+
+const Vector3& CoinSpatialGrid::GetPosition(uint32_t _slot) const
+{
+    return m_positions[_slot];
+}
+
+float CoinSpatialGrid::GetCellSize() const
+{
+    return m_cellSize;
+}
+
+
+// @brief Upper bound on the bytes WriteSnapshot() needs.
+size_t CoinSpatialGrid::GetMaxSnapshotSize() const
+{
+    const size_t slotCount = m_positions.size();
+    const size_t blockCount = DirtyBlockSet::GetBlockCount(slotCount) + DirtyBlockSet::GetBlockCount(m_bucketHeads.size());
+    return sizeof(uint32_t) * 3 + blockCount * sizeof(uint32_t) + slotCount * SNAPSHOT_BYTES_PER_SLOT + m_bucketHeads.size() * sizeof(uint32_t);
+}
+
+// @brief Writes the whole grid, or with _deltaOnly just the blocks of slots and buckets changed since
+// the last WriteSnapshot() or ReadSnapshot().
+void CoinSpatialGrid::WriteSnapshot(SnapshotWriter& _writer, bool _deltaOnly)
+{
+    const size_t slotCount = m_positions.size();
+    const size_t bucketCount = m_bucketHeads.size();
+    _writer.WriteValue<uint32_t>(_deltaOnly ? 1 : 0);
+
+    if (_deltaOnly == false)
+    {
+        WriteSlotRange(_writer, 0, slotCount);
+        _writer.Write(m_bucketHeads.data(), sizeof(uint32_t) * bucketCount);
+    }
+    else
+    {
+        // Each changed block goes out as its index followed by its slice of every array
+        _writer.WriteValue<uint32_t>((uint32_t)m_dirtySlots.GetMarkedBlockCount());
+        m_dirtySlots.ForEachMarkedBlock([&](uint32_t _block)
+        {
+            uint32_t firstSlot = _block << DirtyBlockSet::BLOCK_SHIFT;
+            _writer.WriteValue(_block);
+            WriteSlotRange(_writer, firstSlot, std::min<size_t>(DirtyBlockSet::BLOCK_SIZE, slotCount - firstSlot));
+        });
+
+        _writer.WriteValue<uint32_t>((uint32_t)m_dirtyBuckets.GetMarkedBlockCount());
+        m_dirtyBuckets.ForEachMarkedBlock([&](uint32_t _block)
+        {
+            uint32_t firstBucket = _block << DirtyBlockSet::BLOCK_SHIFT;
+            _writer.WriteValue(_block);
+            _writer.Write(&m_bucketHeads[firstBucket], sizeof(uint32_t) * std::min<size_t>(DirtyBlockSet::BLOCK_SIZE, bucketCount - firstBucket));
+        });
+    }
+
+    m_dirtySlots.Clear();
+    m_dirtyBuckets.Clear();
+}
+
+// @brief Steps over what ReadSnapshot() would read, checking it without changing anything.
+// @return false if the data is malformed.
+bool CoinSpatialGrid::ValidateSnapshot(SnapshotReader& _reader) const
+{
+    const size_t slotCount = m_positions.size();
+    const size_t bucketCount = m_bucketHeads.size();
+    if (_reader.ReadValue<uint32_t>() == 0)
+    {
+        _reader.Take(SNAPSHOT_BYTES_PER_SLOT * slotCount);
+        _reader.Take(sizeof(uint32_t) * bucketCount);
+        return _reader.HasOverflowed() == false;
+    }
+
+    uint32_t slotBlockCount = _reader.ReadValue<uint32_t>();
+    for (uint32_t i = 0; i < slotBlockCount; ++i)
+    {
+        size_t firstSlot = (size_t)_reader.ReadValue<uint32_t>() << DirtyBlockSet::BLOCK_SHIFT;
+        if (_reader.HasOverflowed() || firstSlot >= slotCount)
+        {
+            return false;
+        }
+        _reader.Take(SNAPSHOT_BYTES_PER_SLOT * std::min<size_t>(DirtyBlockSet::BLOCK_SIZE, slotCount - firstSlot));
+    }
+
+    uint32_t bucketBlockCount = _reader.ReadValue<uint32_t>();
+    for (uint32_t i = 0; i < bucketBlockCount; ++i)
+    {
+        size_t firstBucket = (size_t)_reader.ReadValue<uint32_t>() << DirtyBlockSet::BLOCK_SHIFT;
+        if (_reader.HasOverflowed() || firstBucket >= bucketCount)
+        {
+            return false;
+        }
+        _reader.Take(sizeof(uint32_t) * std::min<size_t>(DirtyBlockSet::BLOCK_SIZE, bucketCount - firstBucket));
+    }
+    return _reader.HasOverflowed() == false;
+}
+
+// @brief Reads back what WriteSnapshot() wrote. A delta must be read into the state it was taken after.
+// @return false if the data is malformed.
+bool CoinSpatialGrid::ReadSnapshot(SnapshotReader& _reader)
+{
+    const size_t slotCount = m_positions.size();
+    const size_t bucketCount = m_bucketHeads.size();
+    m_dirtySlots.Clear();
+    m_dirtyBuckets.Clear();
+
+    if (_reader.ReadValue<uint32_t>() == 0)
+    {
+        ReadSlotRange(_reader, 0, slotCount);
+        _reader.Read(m_bucketHeads.data(), sizeof(uint32_t) * bucketCount);
+        return _reader.HasOverflowed() == false;
+    }
+
+    uint32_t slotBlockCount = _reader.ReadValue<uint32_t>();
+    for (uint32_t i = 0; i < slotBlockCount; ++i)
+    {
+        size_t firstSlot = (size_t)_reader.ReadValue<uint32_t>() << DirtyBlockSet::BLOCK_SHIFT;
+        if (firstSlot >= slotCount)
+        {
+            return false;
+        }
+        ReadSlotRange(_reader, (uint32_t)firstSlot, std::min<size_t>(DirtyBlockSet::BLOCK_SIZE, slotCount - firstSlot));
+    }
+
+    uint32_t bucketBlockCount = _reader.ReadValue<uint32_t>();
+    for (uint32_t i = 0; i < bucketBlockCount; ++i)
+    {
+        size_t firstBucket = (size_t)_reader.ReadValue<uint32_t>() << DirtyBlockSet::BLOCK_SHIFT;
+        if (firstBucket >= bucketCount)
+        {
+            return false;
+        }
+        _reader.Read(&m_bucketHeads[firstBucket], sizeof(uint32_t) * std::min<size_t>(DirtyBlockSet::BLOCK_SIZE, bucketCount - firstBucket));
+    }
+    return _reader.HasOverflowed() == false;
+}
+
+
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//              Private
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+int32_t CoinSpatialGrid::GetCellCoordinate(float _position) const
+{
+    float cell = std::floor(_position * m_inverseCellSize);
+    // Written so NaN fails the test and clamps too; infinities clamp like any other far position
+    if ((cell >= (float)-MAX_CELL_COORDINATE) == false)
+    {
+        return -MAX_CELL_COORDINATE;
+    }
+    if (cell > (float)MAX_CELL_COORDINATE)
+    {
+        return MAX_CELL_COORDINATE;
+    }
+    return (int32_t)cell;
+}
+
+uint64_t CoinSpatialGrid::PackCellKey(int32_t _x, int32_t _y, int32_t _z)
+{
+    const uint64_t mask = (1u << 21) - 1;
+    return ((uint64_t)(_x & mask) << 42) | ((uint64_t)(_y & mask) << 21) | (uint64_t)(_z & mask);
+}
+
+size_t CoinSpatialGrid::GetBucketCount(size_t _slotCapacity)
+{
+    // A power of two bucket count of at least the slot count keeps the lists short even when every
+    // slot is in use, and lets the hash be masked instead of divided
+    size_t bucketCount = 1;
+    while (bucketCount < _slotCapacity)
+    {
+        bucketCount <<= 1;
+    }
+    return bucketCount;
+}
+
+uint32_t CoinSpatialGrid::GetBucket(int32_t _x, int32_t _y, int32_t _z) const
+{
+    // Large primes from Teschner et al., "Optimized Spatial Hashing for Collision Detection of Deformable Objects"
+    uint32_t hash = ((uint32_t)_x * 73856093u) ^ ((uint32_t)_y * 19349663u) ^ ((uint32_t)_z * 83492791u);
+    return hash & m_bucketMask;
+}
+
+void CoinSpatialGrid::WriteSlotRange(SnapshotWriter& _writer, uint32_t _firstSlot, size_t _count) const
+{
+    _writer.Write(m_nextInBucket.data() + _firstSlot, sizeof(uint32_t) * _count);
+    _writer.Write(m_prevInBucket.data() + _firstSlot, sizeof(uint32_t) * _count);
+    _writer.Write(m_bucketOfSlot.data() + _firstSlot, sizeof(uint32_t) * _count);
+    _writer.Write(m_cellKeyOfSlot.data() + _firstSlot, sizeof(uint64_t) * _count);
+    _writer.Write(m_positions.data() + _firstSlot, sizeof(Vector3) * _count);
+}
+
+void CoinSpatialGrid::ReadSlotRange(SnapshotReader& _reader, uint32_t _firstSlot, size_t _count)
+{
+    _reader.Read(m_nextInBucket.data() + _firstSlot, sizeof(uint32_t) * _count);
+    _reader.Read(m_prevInBucket.data() + _firstSlot, sizeof(uint32_t) * _count);
+    _reader.Read(m_bucketOfSlot.data() + _firstSlot, sizeof(uint32_t) * _count);
+    _reader.Read(m_cellKeyOfSlot.data() + _firstSlot, sizeof(uint64_t) * _count);
+    _reader.Read(m_positions.data() + _firstSlot, sizeof(Vector3) * _count);
+}
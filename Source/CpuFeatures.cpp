@@ -0,0 +1,65 @@
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//             CPU Features (cpp)
+//             Author: Christopher A
+//             Date: October 16, 2026
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//  Description:
+//
+//		Runtime CPU feature checks for the SIMD kernels.
+//
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include "CpuFeatures.h"
+
+#if defined(CPU_FEATURES_X86) && defined(_MSC_VER)
+#include <immintrin.h>
+#include <intrin.h>
+#elif defined(CPU_FEATURES_X86)
+#include <cpuid.h>
+#endif
+
+
+
+#ifdef CPU_FEATURES_X86
+bool IsAVX2Supported()
+{
+#ifdef _MSC_VER
+    // AVX2 is leaf 7 EBX bit 5. The OS must also save the AVX registers (OSXSAVE + XCR0 bits 1 and 2).
+    int cpuInfo[4] = {};
+    __cpuid(cpuInfo, 1);
+    bool hasOsAvx = (cpuInfo[2] & (1 << 27)) != 0 && (cpuInfo[2] & (1 << 28)) != 0 && (_xgetbv(0) & 0x6) == 0x6;
+    __cpuidex(cpuInfo, 7, 0);
+    return hasOsAvx && (cpuInfo[1] & (1 << 5)) != 0;
+#else
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+
+bool IsFMASupported()
+{
+#ifdef _MSC_VER
+    // FMA3 is leaf 1 ECX bit 12, and uses the AVX registers, so needs the same OS support
+    int cpuInfo[4] = {};
+    __cpuid(cpuInfo, 1);
+    bool hasOsAvx = (cpuInfo[2] & (1 << 27)) != 0 && (cpuInfo[2] & (1 << 28)) != 0 && (_xgetbv(0) & 0x6) == 0x6;
+    return hasOsAvx && (cpuInfo[2] & (1 << 12)) != 0;
+#else
+    return __builtin_cpu_supports("fma");
+#endif
+}
+
+bool IsF16CSupported()
+{
+#ifdef _MSC_VER
+    // F16C is leaf 1 ECX bit 29, also on the AVX registers
+    int cpuInfo[4] = {};
+    __cpuid(cpuInfo, 1);
+    bool hasOsAvx = (cpuInfo[2] & (1 << 27)) != 0 && (cpuInfo[2] & (1 << 28)) != 0 && (_xgetbv(0) & 0x6) == 0x6;
+    return hasOsAvx && (cpuInfo[2] & (1 << 29)) != 0;
+#else
+    // __builtin_cpu_supports has no "f16c" on older GCCs, so ask cpuid directly
+    unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+    __cpuid(1, eax, ebx, ecx, edx);
+    return __builtin_cpu_supports("avx") && (ecx & (1u << 29)) != 0;
+#endif
+}
+#endif
@@ -16,6 +16,8 @@
 //
 //=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 
+#include <algorithm>
+#include <iostream>
 #include <thread>
 #include "CubicBezierCurve.h"
 
@@ -69,32 +71,46 @@ Vector3 GetPointOnCubicBezierCurve(const Vector3& _pointStart, const Vector3& _t
 }
 
 
-// @brief This function chains multiple Cubic Bezier curves to interpolate an arbitrary number of points.
-// Math functionality came from: https://apoorvaj.io/cubic-bezier-through-four-points/
-Vector3 GetPointOnInterpolatedBezierSpline(const std::vector<Vector3>& _points, float _globalTime)
+// @brief Derivative of the Cubic Bezier curve at 't', normalised. Direction only, so this uses
+// NormalisedFast. A curve that stops dead at 't' (e.g. coincident control points) gives zero.
+Vector3 GetTangentOnCubicBezierCurve(const Vector3& _pointStart, const Vector3& _tangentPoint1,
+                                    const Vector3& _tangentPoint2, const Vector3& _endPoint,
+                                    float _t)
 {
-    size_t numPoints = _points.size();
-    if (numPoints == 0)
+    if (_t < 0.0f)
     {
-        std::cerr << "Error: Cannot interpolate an empty set of points." << std::endl;
-        return Vector3();
+        _t = 0.0f;
     }
-    if (numPoints == 1)
+    else if (_t > 1.0f)
     {
-        return _points[0];
+        _t = 1.0f;
     }
 
-    if (_globalTime <= 0.0f)
-    {
-        return _points[0];
-    }
-    else if (_globalTime >= 1.0f)
-    {
-        return _points[numPoints - 1];
-    }
+    // B'(t) = 3(1-t)^2 (P1 - P0) + 6(1-t)t (P2 - P1) + 3t^2 (P3 - P2)
+    float invertedT = 1.0f - _t;
+    float d0 = 3.0f * invertedT * invertedT;
+    float d1 = 6.0f * invertedT * _t;
+    float d2 = 3.0f * _t * _t;
+
+    Vector3 derivative = ((_tangentPoint1 - _pointStart) * d0)
+        + ((_tangentPoint2 - _tangentPoint1) * d1)
+        + ((_endPoint - _tangentPoint2) * d2);
 
+    return derivative.NormalisedFast();
+}
+
+
+// @brief Finds the segment _globalTime falls in, its four Bezier control points and the time along it.
+// _globalTime is clamped to [0, 1], and NaN counts as 0. Needs at least two points.
+// Math functionality came from: https://apoorvaj.io/cubic-bezier-through-four-points/
+static float GetBezierSplineSegment(const std::vector<Vector3>& _points, float _globalTime, Vector3 (&_outControlPoints)[4])
+{
+    size_t numPoints = _points.size();
     size_t numSegments = numPoints - 1;
-    float segmentSplit = _globalTime * numSegments;
+
+    // std::clamp lets NaN through, and a NaN cast to size_t is undefined, so NaN is caught first
+    float clampedTime = ((_globalTime >= 0.0f) == false) ? 0.0f : std::min(_globalTime, 1.0f);
+    float segmentSplit = clampedTime * numSegments;
     size_t segmentIndex = (size_t)segmentSplit;
 
     if (segmentIndex >= numSegments)
@@ -127,12 +143,56 @@ Vector3 GetPointOnInterpolatedBezierSpline(const std::vector<Vector3>& _points,
         tangentPoint2 = (_points[segmentIndex + 2] - _points[segmentIndex]) * 0.5f;
     }
 
-    Vector3 C0 = nowPoint;
-    Vector3 C1 = nowPoint + (tangentPoint1 * 0.33f);
-    Vector3 C2 = nextPoint - (tangentPoint2 * 0.33f);
-    Vector3 C3 = nextPoint;
+    _outControlPoints[0] = nowPoint;
+    _outControlPoints[1] = nowPoint + (tangentPoint1 * 0.33f);
+    _outControlPoints[2] = nextPoint - (tangentPoint2 * 0.33f);
+    _outControlPoints[3] = nextPoint;
+    return localT;
+}
+
+
+// @brief This function chains multiple Cubic Bezier curves to interpolate an arbitrary number of points.
+// A NaN _globalTime counts as 0.
+Vector3 GetPointOnInterpolatedBezierSpline(const std::vector<Vector3>& _points, float _globalTime)
+{
+    size_t numPoints = _points.size();
+    if (numPoints == 0)
+    {
+        std::cerr << "Error: Cannot interpolate an empty set of points." << std::endl;
+        return Vector3();
+    }
+    if (numPoints == 1)
+    {
+        return _points[0];
+    }
+
+    if ((_globalTime > 0.0f) == false)
+    {
+        return _points[0];
+    }
+    else if (_globalTime >= 1.0f)
+    {
+        return _points[numPoints - 1];
+    }
+
+    Vector3 controlPoints[4];
+    float localT = GetBezierSplineSegment(_points, _globalTime, controlPoints);
+    return GetPointOnCubicBezierCurve(controlPoints[0], controlPoints[1], controlPoints[2], controlPoints[3], localT);
+}
+
+
+// @brief Direction of travel along the spline at _globalTime, normalised with NormalisedFast.
+// A NaN _globalTime counts as 0.
+Vector3 GetTangentOnInterpolatedBezierSpline(const std::vector<Vector3>& _points, float _globalTime)
+{
+    if (_points.size() < 2)
+    {
+        return Vector3();
+    }
 
-    return GetPointOnCubicBezierCurve(C0, C1, C2, C3, localT);
+    Vector3 controlPoints[4];
+    float localT = GetBezierSplineSegment(_points, _globalTime, controlPoints);
+    return GetTangentOnCubicBezierCurve(controlPoints[0], controlPoints[1], controlPoints[2], controlPoints[3], localT);
 }
 
 
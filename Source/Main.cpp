@@ -1,18 +1,32 @@
 
+#include <cstring>
 #include "CalculateF.h"
 #include "CoinObjectPool.h"
+#include "CoinObjectPoolBenchmarks.h"
 #include "CubicBezierCurve.h"
 #include "GenericVectorTemplate.h"
 #include "HeightMapInterpolation.h"
+#include "ObjectPoolBenchmarks.h"
 #include "SlowString.h"
 #include "Vector3.h"
+#include "Vector3Benchmarks.h"
 
 
 
 
 
-int main()
+int main(int argc, char* argv[])
 {
+    // `CppTests --bench` runs the benchmarks instead of the console demos, and exits with 1 if any
+    // of their checks failed
+    if (argc > 1 && std::strcmp(argv[1], "--bench") == 0)
+    {
+        bool isPassing = RunCoinObjectPoolBenchmarks();
+        RunObjectPoolBenchmarks();
+        isPassing &= RunVector3Benchmarks();
+        return isPassing ? 0 : 1;
+    }
+
     std::vector<Vector3> bezierCurvePathPoints =
     {
         Vector3(0.0f, 0.0f),
@@ -0,0 +1,199 @@
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//             Matrix4x4 (cpp)
+//             Author: Christopher A
+//             Date: October 16, 2026
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//  Description:
+//
+//		Printing, and the scalar, SSE2 and AVX2 kernels behind TransformPoints
+//      and TransformDirections. The SIMD kernels read each Vector3 as its
+//      padded xyzw block, so they only exist where VECTOR3_ENABLE_SIMD lays
+//      Vector3 out that way. AVX2 does two Vector3s per register.
+//
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <algorithm>
+#include <iostream>
+#include "CpuFeatures.h"
+#include "Matrix4x4.h"
+
+#if defined(CPU_FEATURES_X86) && VECTOR3_ENABLE_SIMD
+#define MATRIX4X4_SIMD_KERNELS 1
+#include <immintrin.h>
+
+// The kernels load and store Vector3s as whole xyzw registers
+static_assert(sizeof(Vector3) == 4 * sizeof(float), "Vector3 must be one padded xyzw block for the SIMD kernels");
+#else
+#define MATRIX4X4_SIMD_KERNELS 0
+#endif
+
+
+
+
+std::ostream& operator << (std::ostream& _os, const Matrix4x4& _matrix)
+{
+    for (size_t row = 0; row < 4; ++row)
+    {
+        _os << "(" << _matrix.Get(row, 0) << ", " << _matrix.Get(row, 1) << ", " << _matrix.Get(row, 2) << ", " << _matrix.Get(row, 3) << ")";
+        if (row < 3)
+        {
+            _os << "\n";
+        }
+    }
+    return _os;
+}
+
+
+
+// ~~~ Scalar kernels ~~~
+// The same formulas as the scalar Matrix4x4 functions. Every component is read before any is written so
+// the output can be the input.
+
+template <bool IncludeTranslation>
+static void TransformScalar(const Matrix4x4& _matrix, const Vector3* _in, Vector3* _out, size_t _count)
+{
+    const float* m = _matrix.GetData();
+    for (size_t i = 0; i < _count; ++i)
+    {
+        float x = _in[i].GetX();
+        float y = _in[i].GetY();
+        float z = _in[i].GetZ();
+        if constexpr (IncludeTranslation)
+        {
+            _out[i] = Vector3(m[0] * x + m[4] * y + m[8] * z + m[12], m[1] * x + m[5] * y + m[9] * z + m[13], m[2] * x + m[6] * y + m[10] * z + m[14]);
+        }
+        else
+        {
+            _out[i] = Vector3(m[0] * x + m[4] * y + m[8] * z, m[1] * x + m[5] * y + m[9] * z, m[2] * x + m[6] * y + m[10] * z);
+        }
+    }
+}
+
+
+
+#if MATRIX4X4_SIMD_KERNELS
+// ~~~ SSE2 kernels ~~~
+// Matrix4x4::TransformPoint's SSE path with the columns loaded once for the whole array
+
+template <bool IncludeTranslation>
+static void TransformSSE2(const Matrix4x4& _matrix, const Vector3* _in, Vector3* _out, size_t _count)
+{
+    const float* m = _matrix.GetData();
+    const __m128 c0 = _mm_load_ps(m);
+    const __m128 c1 = _mm_load_ps(m + 4);
+    const __m128 c2 = _mm_load_ps(m + 8);
+    const __m128 c3 = _mm_load_ps(m + 12);
+    const __m128 xyzMask = _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+    const float* in = reinterpret_cast<const float*>(_in);
+    float* out = reinterpret_cast<float*>(_out);
+    for (size_t i = 0; i < _count; ++i)
+    {
+        __m128 vector = _mm_load_ps(in + i * 4);
+        __m128 sum = _mm_add_ps(_mm_mul_ps(c0, _mm_shuffle_ps(vector, vector, _MM_SHUFFLE(0, 0, 0, 0))),
+                                _mm_mul_ps(c1, _mm_shuffle_ps(vector, vector, _MM_SHUFFLE(1, 1, 1, 1))));
+        sum = _mm_add_ps(sum, _mm_mul_ps(c2, _mm_shuffle_ps(vector, vector, _MM_SHUFFLE(2, 2, 2, 2))));
+        if constexpr (IncludeTranslation)
+        {
+            sum = _mm_add_ps(sum, c3);
+        }
+        _mm_store_ps(out + i * 4, _mm_and_ps(sum, xyzMask));
+    }
+}
+
+
+
+// ~~~ AVX2 kernels ~~~
+// The SSE2 kernels with two Vector3s in each register and the columns repeated in both halves. No FMA, so
+// the rounding stays the same as Matrix4x4's.
+
+CPU_TARGET_AVX2
+static inline __m256 TransformPairAVX2(__m256 _vectors, __m256 _c0, __m256 _c1, __m256 _c2, __m256 _c3, __m256 _xyzMask, bool _includeTranslation)
+{
+    __m256 sum = _mm256_add_ps(_mm256_mul_ps(_c0, _mm256_permute_ps(_vectors, _MM_SHUFFLE(0, 0, 0, 0))),
+                                _mm256_mul_ps(_c1, _mm256_permute_ps(_vectors, _MM_SHUFFLE(1, 1, 1, 1))));
+    sum = _mm256_add_ps(sum, _mm256_mul_ps(_c2, _mm256_permute_ps(_vectors, _MM_SHUFFLE(2, 2, 2, 2))));
+    if (_includeTranslation)
+    {
+        sum = _mm256_add_ps(sum, _c3);
+    }
+    return _mm256_and_ps(sum, _xyzMask);
+}
+
+template <bool IncludeTranslation>
+CPU_TARGET_AVX2
+static void TransformAVX2(const Matrix4x4& _matrix, const Vector3* _in, Vector3* _out, size_t _count)
+{
+    const float* m = _matrix.GetData();
+    const __m256 c0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(m));
+    const __m256 c1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(m + 4));
+    const __m256 c2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(m + 8));
+    const __m256 c3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(m + 12));
+    const __m256 xyzMask = _mm256_castsi256_ps(_mm256_set_epi32(0, -1, -1, -1, 0, -1, -1, -1));
+    const float* in = reinterpret_cast<const float*>(_in);
+    float* out = reinterpret_cast<float*>(_out);
+    size_t i = 0;
+    for (; i + 4 <= _count; i += 4)
+    {
+        // Both pairs are read before either is written, for in place transforms
+        __m256 first = _mm256_loadu_ps(in + i * 4);
+        __m256 second = _mm256_loadu_ps(in + i * 4 + 8);
+        _mm256_storeu_ps(out + i * 4, TransformPairAVX2(first, c0, c1, c2, c3, xyzMask, IncludeTranslation));
+        _mm256_storeu_ps(out + i * 4 + 8, TransformPairAVX2(second, c0, c1, c2, c3, xyzMask, IncludeTranslation));
+    }
+    TransformScalar<IncludeTranslation>(_matrix, _in + i, _out + i, _count - i);
+}
+#endif
+
+
+
+// ~~~ Dispatch ~~~
+static const TransformKernels SCALAR_TRANSFORM_KERNELS = { "Scalar", &TransformScalar<true>, &TransformScalar<false> };
+
+#if MATRIX4X4_SIMD_KERNELS
+static const TransformKernels SSE2_TRANSFORM_KERNELS = { "SSE2", &TransformSSE2<true>, &TransformSSE2<false> };
+static const TransformKernels AVX2_TRANSFORM_KERNELS = { "AVX2", &TransformAVX2<true>, &TransformAVX2<false> };
+#endif
+
+
+const TransformKernels* GetTransformKernels(TransformKernelSet _set)
+{
+    switch (_set)
+    {
+    case TRANSFORM_SCALAR_KERNELS:
+        return &SCALAR_TRANSFORM_KERNELS;
+#if MATRIX4X4_SIMD_KERNELS
+    case TRANSFORM_SSE2_KERNELS:
+        return &SSE2_TRANSFORM_KERNELS;
+    case TRANSFORM_AVX2_KERNELS:
+        return IsAVX2Supported() ? &AVX2_TRANSFORM_KERNELS : nullptr;
+#endif
+    default:
+        return nullptr;
+    }
+}
+
+
+// @brief The widest kernels this CPU supports. The choice is made once, on the first call.
+static const TransformKernels& GetBestKernels()
+{
+#if MATRIX4X4_SIMD_KERNELS
+    static const TransformKernels& s_kernels = IsAVX2Supported() ? AVX2_TRANSFORM_KERNELS : SSE2_TRANSFORM_KERNELS;
+#else
+    static const TransformKernels& s_kernels = SCALAR_TRANSFORM_KERNELS;
+#endif
+    return s_kernels;
+}
+
+
+size_t TransformPoints(const Matrix4x4& _matrix, std::span<const Vector3> _in, std::span<Vector3> _out)
+{
+    size_t count = std::min(_in.size(), _out.size());
+    GetBestKernels().transformPoints(_matrix, _in.data(), _out.data(), count);
+    return count;
+}
+
+size_t TransformDirections(const Matrix4x4& _matrix, std::span<const Vector3> _in, std::span<Vector3> _out)
+{
+    size_t count = std::min(_in.size(), _out.size());
+    GetBestKernels().transformDirections(_matrix, _in.data(), _out.data(), count);
+    return count;
+}
@@ -0,0 +1,150 @@
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//             Object Pool Benchmarks (cpp)
+//             Author: Christopher A
+//             Date: October 16, 2026
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//  Description:
+//
+//		Micro benchmarks for the generic ObjectPool. Run with `CppTests --bench`.
+//      Results are written to std::cout.
+//
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+#include "Benchmark.h"
+#include "ObjectPool.h"
+#include "ObjectPoolBenchmarks.h"
+
+
+// Stand-in for a gameplay object. Deliberately has no default constructor.
+struct BenchmarkProjectile
+{
+    float position[3];
+    float velocity[3];
+    int remainingFrames;
+
+    BenchmarkProjectile(float _x, float _y, float _z, int _remainingFrames)
+        : position{ _x, _y, _z },
+          velocity{ 0.0f, 0.0f, 1.0f },
+          remainingFrames(_remainingFrames)
+    {
+    }
+};
+
+
+static const int LIVE_PROJECTILE_COUNT = 10000;
+static const int REPLACEMENT_COUNT = 1000000;
+
+
+// @brief Random victims, picked up front so the timed loops only measure the allocation strategy.
+static std::vector<int> MakeReplacementOrder()
+{
+    std::mt19937 rng(4321);
+    std::uniform_int_distribution<int> distribution(0, LIVE_PROJECTILE_COUNT - 1);
+    std::vector<int> order(REPLACEMENT_COUNT);
+    for (int& index : order)
+    {
+        index = distribution(rng);
+    }
+    return order;
+}
+
+template <typename PoolType>
+static double MeasurePoolChurn(PoolType& _pool, const std::vector<int>& _replacementOrder)
+{
+    std::vector<BenchmarkProjectile*> liveProjectiles(LIVE_PROJECTILE_COUNT);
+    for (int i = 0; i < LIVE_PROJECTILE_COUNT; ++i)
+    {
+        liveProjectiles[i] = _pool.Spawn((float)i, 0.0f, 0.0f, 300);
+    }
+
+    BenchmarkTimer timer;
+    for (int index : _replacementOrder)
+    {
+        _pool.Release(liveProjectiles[index]);
+        liveProjectiles[index] = _pool.Spawn((float)index, 1.0f, 0.0f, 300);
+    }
+    double elapsedNanoseconds = timer.GetElapsedNanoseconds();
+    DoNotOptimise(liveProjectiles);
+
+    for (BenchmarkProjectile* projectile : liveProjectiles)
+    {
+        _pool.Release(projectile);
+    }
+    return elapsedNanoseconds / REPLACEMENT_COUNT;
+}
+
+static double MeasureNewDeleteChurn(const std::vector<int>& _replacementOrder)
+{
+    std::vector<BenchmarkProjectile*> liveProjectiles(LIVE_PROJECTILE_COUNT);
+    for (int i = 0; i < LIVE_PROJECTILE_COUNT; ++i)
+    {
+        liveProjectiles[i] = new BenchmarkProjectile((float)i, 0.0f, 0.0f, 300);
+    }
+
+    BenchmarkTimer timer;
+    for (int index : _replacementOrder)
+    {
+        delete liveProjectiles[index];
+        liveProjectiles[index] = new BenchmarkProjectile((float)index, 1.0f, 0.0f, 300);
+    }
+    double elapsedNanoseconds = timer.GetElapsedNanoseconds();
+    DoNotOptimise(liveProjectiles);
+
+    for (BenchmarkProjectile* projectile : liveProjectiles)
+    {
+        delete projectile;
+    }
+    return elapsedNanoseconds / REPLACEMENT_COUNT;
+}
+
+static double MeasureVectorChurn(const std::vector<int>& _replacementOrder)
+{
+    // Objects stored by value; removal swaps the last element into the hole like the pool's active list does
+    std::vector<BenchmarkProjectile> liveProjectiles;
+    for (int i = 0; i < LIVE_PROJECTILE_COUNT; ++i)
+    {
+        liveProjectiles.emplace_back((float)i, 0.0f, 0.0f, 300);
+    }
+
+    BenchmarkTimer timer;
+    for (int index : _replacementOrder)
+    {
+        liveProjectiles[index] = liveProjectiles.back();
+        liveProjectiles.pop_back();
+        liveProjectiles.emplace_back((float)index, 1.0f, 0.0f, 300);
+    }
+    double elapsedNanoseconds = timer.GetElapsedNanoseconds();
+    DoNotOptimise(liveProjectiles);
+
+    return elapsedNanoseconds / REPLACEMENT_COUNT;
+}
+
+
+// @brief Keeps 10,000 projectiles alive and replaces random ones, comparing ObjectPool
+// (runtime and compile-time capacity) against new/delete and a swap-and-pop std::vector.
+void RunObjectPoolChurnBenchmark()
+{
+    std::vector<int> replacementOrder = MakeReplacementOrder();
+
+    ObjectPool<BenchmarkProjectile> runtimeCapacityPool(LIVE_PROJECTILE_COUNT);
+
+    // Too big for the stack, so the fixed capacity pool itself goes on the heap once at init
+    std::unique_ptr<ObjectPool<BenchmarkProjectile, LIVE_PROJECTILE_COUNT>> fixedCapacityPool =
+        std::make_unique<ObjectPool<BenchmarkProjectile, LIVE_PROJECTILE_COUNT>>();
+
+    std::cout << "ObjectPool churn (" << LIVE_PROJECTILE_COUNT << " live objects, ns per release + spawn)" << std::endl;
+    std::cout << "    ObjectPool<T>:           " << MeasurePoolChurn(runtimeCapacityPool, replacementOrder) << std::endl;
+    std::cout << "    ObjectPool<T, Capacity>: " << MeasurePoolChurn(*fixedCapacityPool, replacementOrder) << std::endl;
+    std::cout << "    new / delete:            " << MeasureNewDeleteChurn(replacementOrder) << std::endl;
+    std::cout << "    std::vector:             " << MeasureVectorChurn(replacementOrder) << std::endl;
+}
+
+
+// @brief Runs every ObjectPool benchmark in turn.
+void RunObjectPoolBenchmarks()
+{
+    RunObjectPoolChurnBenchmark();
+}
@@ -0,0 +1,113 @@
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//             Perf Event Counters (cpp)
+//             Author: Christopher A
+//             Date: October 16, 2026
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//  Description:
+//
+//		Hardware cache miss counters for the benchmarks, read through Linux's
+//      perf_event_open. Everything is a no-op elsewhere.
+//
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include "PerfEventCounters.h"
+
+#if defined(__linux__)
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+
+
+#if defined(__linux__)
+static int OpenPerfEvent(uint32_t _type, uint64_t _config)
+{
+    perf_event_attr attributes;
+    std::memset(&attributes, 0, sizeof(attributes));
+    attributes.size = sizeof(attributes);
+    attributes.type = _type;
+    attributes.config = _config;
+    attributes.disabled = 1;
+    attributes.exclude_kernel = 1;
+    attributes.exclude_hv = 1;
+
+    // This thread, on whichever CPU it runs on. Returns -1 if the kernel says no.
+    return (int)syscall(__NR_perf_event_open, &attributes, 0, -1, -1, 0);
+}
+#endif
+
+
+PerfEventCounters::PerfEventCounters()
+{
+    for (int i = 0; i < PERF_COUNTER_COUNT; ++i)
+    {
+        m_fileDescriptors[i] = -1;
+        m_counts[i] = 0;
+    }
+
+#if defined(__linux__)
+    m_fileDescriptors[PERF_COUNTER_CACHE_MISSES] = OpenPerfEvent(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+    m_fileDescriptors[PERF_COUNTER_L1D_READ_MISSES] = OpenPerfEvent(PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D
+                                                                            | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+                                                                            | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16));
+#endif
+}
+
+PerfEventCounters::~PerfEventCounters()
+{
+#if defined(__linux__)
+    for (int fileDescriptor : m_fileDescriptors)
+    {
+        if (fileDescriptor >= 0)
+        {
+            close(fileDescriptor);
+        }
+    }
+#endif
+}
+
+bool PerfEventCounters::IsAvailable(PerfCounter _counter) const
+{
+    return m_fileDescriptors[_counter] >= 0;
+}
+
+// @brief Zeroes and starts every available counter.
+void PerfEventCounters::Start()
+{
+#if defined(__linux__)
+    for (int fileDescriptor : m_fileDescriptors)
+    {
+        if (fileDescriptor >= 0)
+        {
+            ioctl(fileDescriptor, PERF_EVENT_IOC_RESET, 0);
+            ioctl(fileDescriptor, PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+#endif
+}
+
+// @brief Stops the counters and reads them, for GetCount().
+void PerfEventCounters::Stop()
+{
+#if defined(__linux__)
+    for (int i = 0; i < PERF_COUNTER_COUNT; ++i)
+    {
+        if (m_fileDescriptors[i] < 0)
+        {
+            continue;
+        }
+
+        ioctl(m_fileDescriptors[i], PERF_EVENT_IOC_DISABLE, 0);
+        uint64_t count = 0;
+        m_counts[i] = (read(m_fileDescriptors[i], &count, sizeof(count)) == (ssize_t)sizeof(count)) ? count : 0;
+    }
+#endif
+}
+
+// @brief Events counted between the last Start() and Stop(). 0 if the counter is unavailable.
+uint64_t PerfEventCounters::GetCount(PerfCounter _counter) const
+{
+    return m_counts[_counter];
+}
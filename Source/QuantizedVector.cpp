@@ -0,0 +1,238 @@
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//             Quantized Vector (cpp)
+//             Author: Christopher A
+//             Date: October 16, 2026
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//  Description:
+//
+//		The scalar, SSE2 and AVX2 + F16C half and int16_t conversion kernels.
+//      The SIMD kernels convert whole registers from the front of the array
+//      and finish the rest with the scalar conversions, so any count works.
+//
+//      cvtps2dq rounds by the MXCSR rounding mode, so the int16_t kernels
+//      match QuantizeComponent only under the default, round to nearest.
+//
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include "CpuFeatures.h"
+#include "QuantizedVector.h"
+
+#ifdef CPU_FEATURES_X86
+#include <immintrin.h>
+#endif
+
+
+
+// ~~~ Scalar kernels ~~~
+static void EncodeHalfsScalar(const float* _in, Half* _out, size_t _count)
+{
+    for (size_t i = 0; i < _count; ++i)
+    {
+        _out[i] = Half(_in[i]);
+    }
+}
+
+static void DecodeHalfsScalar(const Half* _in, float* _out, size_t _count)
+{
+    for (size_t i = 0; i < _count; ++i)
+    {
+        _out[i] = (float)_in[i];
+    }
+}
+
+static void QuantizeScalar(const float* _in, int16_t* _out, size_t _count, const VectorQuantization& _quantization)
+{
+    for (size_t i = 0; i < _count; ++i)
+    {
+        _out[i] = QuantizeComponent(_in[i], _quantization);
+    }
+}
+
+static void DequantizeScalar(const int16_t* _in, float* _out, size_t _count, const VectorQuantization& _quantization)
+{
+    for (size_t i = 0; i < _count; ++i)
+    {
+        _out[i] = DequantizeComponent(_in[i], _quantization);
+    }
+}
+
+
+
+#ifdef CPU_FEATURES_X86
+// ~~~ SSE2 kernels ~~~
+static inline __m128i QuantizeSSE2(__m128 _values, __m128 _offset, __m128 _inverseScale)
+{
+    const __m128 low = _mm_set1_ps(-(float)QUANTIZED_COMPONENT_MAX);
+    const __m128 high = _mm_set1_ps((float)QUANTIZED_COMPONENT_MAX);
+    __m128 scaled = _mm_mul_ps(_mm_sub_ps(_values, _offset), _inverseScale);
+    return _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(scaled, low), high));
+}
+
+static void QuantizeSSE2(const float* _in, int16_t* _out, size_t _count, const VectorQuantization& _quantization)
+{
+    const __m128 offset = _mm_set1_ps(_quantization.offset);
+    const __m128 inverseScale = _mm_set1_ps(_quantization.inverseScale);
+    size_t i = 0;
+    for (; i + 8 <= _count; i += 8)
+    {
+        __m128i low = QuantizeSSE2(_mm_loadu_ps(_in + i), offset, inverseScale);
+        __m128i high = QuantizeSSE2(_mm_loadu_ps(_in + i + 4), offset, inverseScale);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(_out + i), _mm_packs_epi32(low, high));
+    }
+    QuantizeScalar(_in + i, _out + i, _count - i, _quantization);
+}
+
+static void DequantizeSSE2(const int16_t* _in, float* _out, size_t _count, const VectorQuantization& _quantization)
+{
+    const __m128 scale = _mm_set1_ps(_quantization.scale);
+    const __m128 offset = _mm_set1_ps(_quantization.offset);
+    size_t i = 0;
+    for (; i + 8 <= _count; i += 8)
+    {
+        __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_in + i));
+
+        // Each int16_t into the top of an int32_t, then shifted down with its sign
+        __m128i low = _mm_srai_epi32(_mm_unpacklo_epi16(values, values), 16);
+        __m128i high = _mm_srai_epi32(_mm_unpackhi_epi16(values, values), 16);
+        _mm_storeu_ps(_out + i, _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(low), scale), offset));
+        _mm_storeu_ps(_out + i + 4, _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(high), scale), offset));
+    }
+    DequantizeScalar(_in + i, _out + i, _count - i, _quantization);
+}
+
+
+
+// ~~~ AVX2 + F16C kernels ~~~
+// The SSE2 int16_t kernels eight lanes wide, plus vcvtps2ph / vcvtph2ps for halves. No FMA, so the
+// dequantize rounding stays the same as DequantizeComponent's.
+
+CPU_TARGET_AVX2_F16C
+static void EncodeHalfsAVX2(const float* _in, Half* _out, size_t _count)
+{
+    size_t i = 0;
+    for (; i + 8 <= _count; i += 8)
+    {
+        __m128i halves = _mm256_cvtps_ph(_mm256_loadu_ps(_in + i), _MM_FROUND_TO_NEAREST_INT);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(_out + i), halves);
+    }
+    EncodeHalfsScalar(_in + i, _out + i, _count - i);
+}
+
+CPU_TARGET_AVX2_F16C
+static void DecodeHalfsAVX2(const Half* _in, float* _out, size_t _count)
+{
+    size_t i = 0;
+    for (; i + 8 <= _count; i += 8)
+    {
+        __m128i halves = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_in + i));
+        _mm256_storeu_ps(_out + i, _mm256_cvtph_ps(halves));
+    }
+    DecodeHalfsScalar(_in + i, _out + i, _count - i);
+}
+
+CPU_TARGET_AVX2_F16C
+static inline __m256i QuantizeAVX2(__m256 _values, __m256 _offset, __m256 _inverseScale)
+{
+    const __m256 low = _mm256_set1_ps(-(float)QUANTIZED_COMPONENT_MAX);
+    const __m256 high = _mm256_set1_ps((float)QUANTIZED_COMPONENT_MAX);
+    __m256 scaled = _mm256_mul_ps(_mm256_sub_ps(_values, _offset), _inverseScale);
+    return _mm256_cvtps_epi32(_mm256_min_ps(_mm256_max_ps(scaled, low), high));
+}
+
+CPU_TARGET_AVX2_F16C
+static void QuantizeAVX2(const float* _in, int16_t* _out, size_t _count, const VectorQuantization& _quantization)
+{
+    const __m256 offset = _mm256_set1_ps(_quantization.offset);
+    const __m256 inverseScale = _mm256_set1_ps(_quantization.inverseScale);
+    size_t i = 0;
+    for (; i + 16 <= _count; i += 16)
+    {
+        __m256i low = QuantizeAVX2(_mm256_loadu_ps(_in + i), offset, inverseScale);
+        __m256i high = QuantizeAVX2(_mm256_loadu_ps(_in + i + 8), offset, inverseScale);
+
+        // packs works within each 128 bit half, giving 0-3 8-11 4-7 12-15; the permute puts them back in order
+        __m256i packed = _mm256_permute4x64_epi64(_mm256_packs_epi32(low, high), _MM_SHUFFLE(3, 1, 2, 0));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(_out + i), packed);
+    }
+    QuantizeScalar(_in + i, _out + i, _count - i, _quantization);
+}
+
+CPU_TARGET_AVX2_F16C
+static void DequantizeAVX2(const int16_t* _in, float* _out, size_t _count, const VectorQuantization& _quantization)
+{
+    const __m256 scale = _mm256_set1_ps(_quantization.scale);
+    const __m256 offset = _mm256_set1_ps(_quantization.offset);
+    size_t i = 0;
+    for (; i + 8 <= _count; i += 8)
+    {
+        __m256i values = _mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(_in + i)));
+        _mm256_storeu_ps(_out + i, _mm256_add_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(values), scale), offset));
+    }
+    DequantizeScalar(_in + i, _out + i, _count - i, _quantization);
+}
+#endif
+
+
+
+// ~~~ Dispatch ~~~
+static const VectorQuantizationKernels SCALAR_QUANTIZATION_KERNELS = { "Scalar", &EncodeHalfsScalar, &DecodeHalfsScalar, &QuantizeScalar, &DequantizeScalar };
+
+#ifdef CPU_FEATURES_X86
+static const VectorQuantizationKernels SSE2_QUANTIZATION_KERNELS = { "SSE2", &EncodeHalfsScalar, &DecodeHalfsScalar, &QuantizeSSE2, &DequantizeSSE2 };
+static const VectorQuantizationKernels AVX2_F16C_QUANTIZATION_KERNELS = { "AVX2 F16C", &EncodeHalfsAVX2, &DecodeHalfsAVX2, &QuantizeAVX2, &DequantizeAVX2 };
+
+static bool IsAVX2F16CSupported()
+{
+    return IsAVX2Supported() && IsF16CSupported();
+}
+#endif
+
+
+const VectorQuantizationKernels* GetVectorQuantizationKernels(VectorQuantizationKernelSet _set)
+{
+    switch (_set)
+    {
+    case QUANTIZATION_SCALAR_KERNELS:
+        return &SCALAR_QUANTIZATION_KERNELS;
+#ifdef CPU_FEATURES_X86
+    case QUANTIZATION_SSE2_KERNELS:
+        return &SSE2_QUANTIZATION_KERNELS;
+    case QUANTIZATION_AVX2_F16C_KERNELS:
+        return IsAVX2F16CSupported() ? &AVX2_F16C_QUANTIZATION_KERNELS : nullptr;
+#endif
+    default:
+        return nullptr;
+    }
+}
+
+
+// @brief The widest kernels this CPU supports. The choice is made once, on the first call.
+static const VectorQuantizationKernels& GetBestKernels()
+{
+#ifdef CPU_FEATURES_X86
+    static const VectorQuantizationKernels& s_kernels = IsAVX2F16CSupported() ? AVX2_F16C_QUANTIZATION_KERNELS : SSE2_QUANTIZATION_KERNELS;
+#else
+    static const VectorQuantizationKernels& s_kernels = SCALAR_QUANTIZATION_KERNELS;
+#endif
+    return s_kernels;
+}
+
+
+void EncodeHalfs(const float* _in, Half* _out, size_t _count)
+{
+    GetBestKernels().encodeHalfs(_in, _out, _count);
+}
+
+void DecodeHalfs(const Half* _in, float* _out, size_t _count)
+{
+    GetBestKernels().decodeHalfs(_in, _out, _count);
+}
+
+void QuantizeFloats(const float* _in, int16_t* _out, size_t _count, const VectorQuantization& _quantization)
+{
+    GetBestKernels().quantize(_in, _out, _count, _quantization);
+}
+
+void DequantizeFloats(const int16_t* _in, float* _out, size_t _count, const VectorQuantization& _quantization)
+{
+    GetBestKernels().dequantize(_in, _out, _count, _quantization);
+}
@@ -0,0 +1,22 @@
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//             Quaternion (cpp)
+//             Author: Christopher A
+//             Date: October 16, 2026
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//  Description:
+//
+//		A rotation quaternion x, y, z, w. Everything but printing is inline in
+//      Quaternion.h.
+//
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <iostream>
+#include "Quaternion.h"
+
+
+
+
+std::ostream& operator << (std::ostream& _os, const Quaternion& _quaternion)
+{
+    _os << "(" << _quaternion.GetX() << ", " << _quaternion.GetY() << ", " << _quaternion.GetZ() << ", " << _quaternion.GetW() << ")";
+    return _os;
+}
@@ -0,0 +1,2185 @@
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//             Vector3 Benchmarks (cpp)
+//             Author: Christopher A
+//             Date: October 16, 2026
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//  Description:
+//
+//		Micro benchmarks for Vector3 and Vector<N, T>. Run with `CppTests --bench`.
+//      Results are written to std::cout.
+//
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "3DTriangleList.h"
+#include "Benchmark.h"
+#include "CubicBezierCurve.h"
+#include "GenericVectorTemplate.h"
+#include "Matrix4x4.h"
+#include "QuantizedVector.h"
+#include "Quaternion.h"
+#include "Vector3.h"
+#include "Vector3Benchmarks.h"
+#include "Vector3HashMap.h"
+#include "Vector3Stream.h"
+#include "VectorDotKernels.h"
+
+
+
+// Both vector types work at compile time
+static_assert(Vector3(1.0f, 0.0f, 0.0f).Cross(Vector3(0.0f, 1.0f, 0.0f)) == Vector3(0.0f, 0.0f, 1.0f));
+static_assert(Vector3(3.0f, 4.0f, 0.0f).Magnitude() == 5.0f);
+static_assert(Vector3(3.0f, 4.0f, 0.0f).NormalisedFast() == Vector3(0.6f, 0.8f, 0.0f));
+static_assert(Vector<3, int16_t>(1, 2, 3).Dot(Vector<3, int16_t>(4, 5, 6)) == 32);
+static_assert(Vector<2, double>(3.0, 4.0).Normalised() == Vector<2, double>(0.6, 0.8));
+static_assert(Vector<3, int>(1, 4, 8) == Vector<3, int>(3, 4, 5) * 2 - Vector<3, int>(4, 3, 2) - -Vector<3, int>(-1, -1, 0));
+static_assert(Vector<64, float>().MagnitudeSqr() == 0.0f && Vector<2, float>(3.0f, 4.0f).DotAccurate(Vector<2, float>(3.0f, 4.0f)) == 25.0f);
+static_assert(Vector<3, int16_t>(1, 0, 0).Cross(Vector<3, int16_t>(0, 1, 0)) == Vector<3, int16_t>(0, 0, 1));
+static_assert(Vector<4, int>(1, 2, 3, 4).Get<3>() == 4 && Vector<4, int>(1, 2, 3, 4)[2] == 3);
+
+// Accessors past the end, and Cross outside 3D, are compile errors rather than runtime ones
+template <typename VectorType> concept HasGetZ = requires(VectorType _vector) { _vector.GetZ(); _vector.SetZ(0); };
+template <typename VectorType> concept HasGetW = requires(VectorType _vector) { _vector.GetW(); _vector.SetW(0); };
+template <typename VectorType> concept HasGet4 = requires(VectorType _vector) { _vector.template Get<4>(); };
+template <typename VectorType> concept HasCross = requires(VectorType _vector) { _vector.Cross(_vector); };
+static_assert(HasGetZ<Vector<3, float>> && HasGetZ<Vector<2, float>> == false);
+static_assert(HasGetW<Vector<4, double>> && HasGetW<Vector<3, double>> == false);
+static_assert(HasGet4<Vector<5, int>> && HasGet4<Vector<4, int>> == false);
+static_assert(HasCross<Vector<3, int>> && HasCross<Vector<2, float>> == false && HasCross<Vector<4, float>> == false);
+
+// Half and int16_t storage convert at compile time too, and really are a half and a quarter of the size
+static_assert(sizeof(Vector<4, Half>) == 8 && sizeof(Vector<3, int16_t>) == 6);
+static_assert(ToFloatVector(ToHalfVector(Vector<3, float>(1.5f, -2.0f, 65504.0f))) == Vector<3, float>(1.5f, -2.0f, 65504.0f));
+static_assert(FloatToHalfBits(65520.0f) == 0x7C00 && FloatToHalfBits(5.9604645e-8f) == 0x0001 && FloatToHalfBits(2.9802322e-8f) == 0x0000);
+static_assert(QuantizeComponent(2.5f, VectorQuantization{ 1.0f, 0.0f, 1.0f }) == 2 && QuantizeComponent(1e9f, VectorQuantization::ForRange(-1.0f, 1.0f)) == 32767);
+
+// Transforms compose and invert at compile time
+static_assert(Matrix4x4::Translation(Vector3(1.0f, 2.0f, 3.0f)).TransformPoint(Vector3(1.0f, 1.0f, 1.0f)) == Vector3(2.0f, 3.0f, 4.0f));
+static_assert(Matrix4x4::Translation(Vector3(1.0f, 2.0f, 3.0f)).TransformDirection(Vector3(1.0f, 1.0f, 1.0f)) == Vector3(1.0f, 1.0f, 1.0f));
+static_assert(Quaternion(0.0f, 0.0f, 1.0f, 0.0f).Rotate(Vector3(1.0f, 2.0f, 3.0f)) == Vector3(-1.0f, -2.0f, 3.0f));
+static_assert(Matrix4x4::Scale(Vector3(2.0f, 0.0f, 1.0f)).Determinant() == 0.0f && Matrix4x4::Scale(Vector3(2.0f, 4.0f, 0.5f)).Determinant() == 4.0f);
+static_assert([]()
+{
+    Matrix4x4 transform = Matrix4x4::Compose(Vector3(1.0f, 2.0f, 3.0f), Quaternion(0.0f, 1.0f, 0.0f, 0.0f), Vector3(2.0f, 4.0f, 0.5f));
+    Matrix4x4 inverse;
+    Matrix4x4 unused;
+    return transform.Inverse(inverse) && inverse * transform == Matrix4x4() && transform == Matrix4x4::Translation(Vector3(1.0f, 2.0f, 3.0f))
+        * Matrix4x4::Rotation(Quaternion(0.0f, 1.0f, 0.0f, 0.0f)) * Matrix4x4::Scale(Vector3(2.0f, 4.0f, 0.5f)) && Matrix4x4::Scale(Vector3()).Inverse(unused) == false;
+}());
+
+
+// The plain float formulas Vector3 has to match, kept apart from Vector3 so the SIMD build has
+// something to be checked against
+struct ScalarVector3
+{
+    float x;
+    float y;
+    float z;
+};
+
+static ScalarVector3 ToScalar(const Vector3& _vector)
+{
+    return { _vector.GetX(), _vector.GetY(), _vector.GetZ() };
+}
+
+static ScalarVector3 ScalarAdd(const ScalarVector3& _a, const ScalarVector3& _b) { return { _a.x + _b.x, _a.y + _b.y, _a.z + _b.z }; }
+static ScalarVector3 ScalarSubtract(const ScalarVector3& _a, const ScalarVector3& _b) { return { _a.x - _b.x, _a.y - _b.y, _a.z - _b.z }; }
+static ScalarVector3 ScalarScale(const ScalarVector3& _a, float _scalar) { return { _a.x * _scalar, _a.y * _scalar, _a.z * _scalar }; }
+static ScalarVector3 ScalarDivide(const ScalarVector3& _a, float _scalar) { return { _a.x / _scalar, _a.y / _scalar, _a.z / _scalar }; }
+static float ScalarDot(const ScalarVector3& _a, const ScalarVector3& _b) { return _a.x * _b.x + _a.y * _b.y + _a.z * _b.z; }
+static float ScalarMagnitude(const ScalarVector3& _a) { return std::sqrt(ScalarDot(_a, _a)); }
+
+static ScalarVector3 ScalarCross(const ScalarVector3& _a, const ScalarVector3& _b)
+{
+    return { _a.y * _b.z - _a.z * _b.y, _a.z * _b.x - _a.x * _b.z, _a.x * _b.y - _a.y * _b.x };
+}
+
+static ScalarVector3 ScalarNormalised(const ScalarVector3& _a)
+{
+    float magnitude = ScalarMagnitude(_a);
+    if (std::abs(magnitude) < EPSILON)
+    {
+        return { 0.0f, 0.0f, 0.0f };
+    }
+    return ScalarDivide(_a, magnitude);
+}
+
+
+// @brief Same bits, or both NaN. NaN payloads depend on operand order, which the compiler may swap.
+static bool IsSameFloat(float _a, float _b)
+{
+    return std::bit_cast<uint32_t>(_a) == std::bit_cast<uint32_t>(_b) || (std::isnan(_a) && std::isnan(_b));
+}
+
+static bool IsSameVector(const Vector3& _vector, const ScalarVector3& _expected)
+{
+    return IsSameFloat(_vector.GetX(), _expected.x) && IsSameFloat(_vector.GetY(), _expected.y) && IsSameFloat(_vector.GetZ(), _expected.z);
+}
+
+
+
+// @brief Checks that every Vector3 operation gives bit for bit the same floats as the plain
+// scalar formulas, over a million random vectors plus zeroes, negative zeroes and infinities.
+// @return true if every result matched.
+bool RunVector3BitCompatibilityTest()
+{
+    const int randomCount = 1000000;
+    const float infinity = std::numeric_limits<float>::infinity();
+
+    std::vector<Vector3> vectors =
+    {
+        Vector3(0.0f, 0.0f, 0.0f),
+        Vector3(-0.0f, -0.0f, -0.0f),
+        Vector3(infinity, -infinity, 1.0f),
+        Vector3(1e-30f, -1e-30f, 1e-30f),
+        Vector3(3e38f, 3e38f, -3e38f),
+    };
+    std::mt19937 rng(314);
+    std::uniform_real_distribution<float> component(-1000.0f, 1000.0f);
+    std::uniform_int_distribution<int> exponent(-40, 40);
+    for (int i = 0; i < randomCount; ++i)
+    {
+        // Mixed magnitudes, so additions actually have to round
+        vectors.push_back(Vector3(std::ldexp(component(rng), exponent(rng)), component(rng), std::ldexp(component(rng), exponent(rng))));
+    }
+
+    size_t mismatchCount = 0;
+    for (size_t i = 0; i < vectors.size(); ++i)
+    {
+        const Vector3& a = vectors[i];
+        const Vector3& b = vectors[(i * 7 + 3) % vectors.size()];
+        ScalarVector3 scalarA = ToScalar(a);
+        ScalarVector3 scalarB = ToScalar(b);
+        float scalar = b.GetY();
+
+        bool isSame = IsSameVector(a + b, ScalarAdd(scalarA, scalarB))
+            && IsSameVector(a - b, ScalarSubtract(scalarA, scalarB))
+            && IsSameVector(-a, ScalarScale(scalarA, -1.0f))
+            && IsSameVector(a * scalar, ScalarScale(scalarA, scalar))
+            && IsSameVector(a.Cross(b), ScalarCross(scalarA, scalarB))
+            && IsSameVector(a.Normalised(), ScalarNormalised(scalarA))
+            && IsSameFloat(a.Dot(b), ScalarDot(scalarA, scalarB))
+            && IsSameFloat(a.Magnitude(), ScalarMagnitude(scalarA));
+
+        // What division by (nearly) zero gives depends on VECTOR_DIVISION_DEFAULT_POLICY, so it is left out here
+        if (std::abs(scalar) >= EPSILON)
+        {
+            isSame &= IsSameVector(a / scalar, ScalarDivide(scalarA, scalar));
+        }
+
+        mismatchCount += isSame ? 0 : 1;
+    }
+
+    std::cout << "Vector3 " << (VECTOR3_ENABLE_SIMD ? "SSE" : "scalar") << " results against the scalar formulas ("
+              << vectors.size() << " vectors): " << ((mismatchCount == 0) ? "OK" : "FAILED") << std::endl;
+    return mismatchCount == 0;
+}
+
+
+// @brief Times Vector3's arithmetic, Dot, Cross, Magnitude and Normalised over 100,000 vectors
+// against the plain scalar formulas.
+void RunVector3OperationBenchmark()
+{
+    const int vectorCount = 100000;
+    const int roundCount = 50;
+
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> component(-100.0f, 100.0f);
+    std::vector<Vector3> vectors;
+    std::vector<ScalarVector3> scalarVectors;
+    for (int i = 0; i < vectorCount; ++i)
+    {
+        vectors.push_back(Vector3(component(rng), component(rng), component(rng)));
+        scalarVectors.push_back(ToScalar(vectors.back()));
+    }
+
+    std::cout << "Vector3 operations (" << (VECTOR3_ENABLE_SIMD ? "SSE" : "scalar") << " build, ns per operation, Vector3 vs scalar formulas)" << std::endl;
+
+    auto report = [&](const char* _name, double _vectorNanoseconds, double _scalarNanoseconds)
+    {
+        double operationCount = (double)vectorCount * roundCount;
+        std::cout << "    " << _name << ": " << (_vectorNanoseconds / operationCount) << " vs " << (_scalarNanoseconds / operationCount) << std::endl;
+    };
+
+    // ~~~ a * s + b ~~~
+    {
+        Vector3 sum;
+        BenchmarkTimer timer;
+        for (int round = 0; round < roundCount; ++round)
+        {
+            for (int i = 1; i < vectorCount; ++i)
+            {
+                sum += vectors[i] * 0.5f - vectors[i - 1];
+            }
+        }
+        double vectorNanoseconds = timer.GetElapsedNanoseconds();
+        DoNotOptimise(sum);
+
+        ScalarVector3 scalarSum = { 0.0f, 0.0f, 0.0f };
+        timer.Restart();
+        for (int round = 0; round < roundCount; ++round)
+        {
+            for (int i = 1; i < vectorCount; ++i)
+            {
+                scalarSum = ScalarAdd(scalarSum, ScalarSubtract(ScalarScale(scalarVectors[i], 0.5f), scalarVectors[i - 1]));
+            }
+        }
+        double scalarNanoseconds = timer.GetElapsedNanoseconds();
+        DoNotOptimise(scalarSum);
+        report("scale, subtract, add", vectorNanoseconds, scalarNanoseconds);
+    }
+
+    // ~~~ Dot ~~~
+    {
+        float sum = 0.0f;
+        BenchmarkTimer timer;
+        for (int round = 0; round < roundCount; ++round)
+        {
+            for (int i = 1; i < vectorCount; ++i)
+            {
+                sum += vectors[i].Dot(vectors[i - 1]);
+            }
+        }
+        double vectorNanoseconds = timer.GetElapsedNanoseconds();
+        DoNotOptimise(sum);
+
+        float scalarSum = 0.0f;
+        timer.Restart();
+        for (int round = 0; round < roundCount; ++round)
+        {
+            for (int i = 1; i < vectorCount; ++i)
+            {
+                scalarSum += ScalarDot(scalarVectors[i], scalarVectors[i - 1]);
+            }
+        }
+        double scalarNanoseconds = timer.GetElapsedNanoseconds();
+        DoNotOptimise(scalarSum);
+        report("Dot", vectorNanoseconds, scalarNanoseconds);
+    }
+
+    // ~~~ Cross ~~~
+    {
+        Vector3 sum;
+        BenchmarkTimer timer;
+        for (int round = 0; round < roundCount; ++round)
+        {
+            for (int i = 1; i < vectorCount; ++i)
+            {
+                sum += vectors[i].Cross(vectors[i - 1]);
+            }
+        }
+        double vectorNanoseconds = timer.GetElapsedNanoseconds();
+        DoNotOptimise(sum);
+
+        ScalarVector3 scalarSum = { 0.0f, 0.0f, 0.0f };
+        timer.Restart();
+        for (int round = 0; round < roundCount; ++round)
+        {
+            for (int i = 1; i < vectorCount; ++i)
+            {
+                scalarSum = ScalarAdd(scalarSum, ScalarCross(scalarVectors[i], scalarVectors[i - 1]));
+            }
+        }
+        double scalarNanoseconds = timer.GetElapsedNanoseconds();
+        DoNotOptimise(scalarSum);
+        report("Cross", vectorNanoseconds, scalarNanoseconds);
+    }
+
+    // ~~~ Magnitude ~~~
+    {
+        float sum = 0.0f;
+        BenchmarkTimer timer;
+        for (int round = 0; round < roundCount; ++round)
+        {
+            for (const Vector3& vector : vectors)
+            {
+                sum += vector.Magnitude();
+            }
+        }
+        double vectorNanoseconds = timer.GetElapsedNanoseconds();
+        DoNotOptimise(sum);
+
+        float scalarSum = 0.0f;
+        timer.Restart();
+        for (int round = 0; round < roundCount; ++round)
+        {
+            for (const ScalarVector3& vector : scalarVectors)
+            {
+                scalarSum += ScalarMagnitude(vector);
+            }
+        }
+        double scalarNanoseconds = timer.GetElapsedNanoseconds();
+        DoNotOptimise(scalarSum);
+        report("Magnitude", vectorNanoseconds, scalarNanoseconds);
+    }
+
+    // ~~~ Normalised ~~~
+    {
+        Vector3 sum;
+        BenchmarkTimer timer;
+        for (int round = 0; round < roundCount; ++round)
+        {
+            for (const Vector3& vector : vectors)
+            {
+                sum += vector.Normalised();
+            }
+        }
+        double vectorNanoseconds = timer.GetElapsedNanoseconds();
+        DoNotOptimise(sum);
+
+        ScalarVector3 scalarSum = { 0.0f, 0.0f, 0.0f };
+        timer.Restart();
+        for (int round = 0; round < roundCount; ++round)
+        {
+            for (const ScalarVector3& vector : scalarVectors)
+            {
+                scalarSum = ScalarAdd(scalarSum, ScalarNormalised(vector));
+            }
+        }
+        double scalarNanoseconds = timer.GetElapsedNanoseconds();
+        DoNotOptimise(scalarSum);
+        report("Normalised", vectorNanoseconds, scalarNanoseconds);
+    }
+}
+
+
+// The same operation with a call boundary in the middle, the way every operator used to be called
+template <typename VectorType, typename Scalar>
+BENCHMARK_NOINLINE static VectorType MultiplyOutOfLine(const VectorType& _vector, Scalar _scalar)
+{
+    return _vector * _scalar;
+}
+
+template <typename VectorType>
+BENCHMARK_NOINLINE static VectorType AddOutOfLine(const VectorType& _a, const VectorType& _b)
+{
+    return _a + _b;
+}
+
+// @brief ns per a * s + b, inlined and through calls.
+template <typename VectorType, typename Scalar>
+static void TimeCallBoundary(const char* _name, const std::vector<VectorType>& _vectors, Scalar _scalar, int _roundCount)
+{
+    VectorType sum;
+    BenchmarkTimer timer;
+    for (int round = 0; round < _roundCount; ++round)
+    {
+        for (const VectorType& vector : _vectors)
+        {
+            sum = vector * _scalar + sum;
+        }
+    }
+    double inlineNanoseconds = timer.GetElapsedNanoseconds();
+    DoNotOptimise(sum);
+
+    VectorType outOfLineSum;
+    timer.Restart();
+    for (int round = 0; round < _roundCount; ++round)
+    {
+        for (const VectorType& vector : _vectors)
+        {
+            outOfLineSum = AddOutOfLine(MultiplyOutOfLine(vector, _scalar), outOfLineSum);
+        }
+    }
+    double outOfLineNanoseconds = timer.GetElapsedNanoseconds();
+    DoNotOptimise(outOfLineSum);
+
+    double operationCount = (double)_vectors.size() * _roundCount;
+    std::cout << "    " << _name << ": inline " << (inlineNanoseconds / operationCount)
+              << ", out of line " << (outOfLineNanoseconds / operationCount)
+              << ((sum == outOfLineSum) ? "" : "  (MISMATCH)") << std::endl;
+}
+
+
+// @brief a * s + b over 100,000 vectors for Vector3, Vector<3, float> and Vector<3, int16_t>, with the
+// operators inlined against the same operators behind a call each, as they were when they lived in cpps.
+void RunVectorCallBoundaryBenchmark()
+{
+    const int vectorCount = 100000;
+    const int roundCount = 50;
+
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> component(-1.0f, 1.0f);
+    std::uniform_int_distribution<int> smallComponent(-3, 3);
+    std::vector<Vector3> vectors;
+    std::vector<Vector<3, float>> genericVectors;
+    std::vector<Vector<3, int16_t>> shortVectors;
+    for (int i = 0; i < vectorCount; ++i)
+    {
+        float x = component(rng), y = component(rng), z = component(rng);
+        vectors.push_back(Vector3(x, y, z));
+        genericVectors.push_back(Vector<3, float>(x, y, z));
+        shortVectors.push_back(Vector<3, int16_t>(smallComponent(rng), smallComponent(rng), smallComponent(rng)));
+    }
+
+    std::cout << "Vector a * s + b across a call boundary (ns per operation)" << std::endl;
+    TimeCallBoundary("Vector3", vectors, 0.5f, roundCount);
+    TimeCallBoundary("Vector<3, float>", genericVectors, 0.5f, roundCount);
+    TimeCallBoundary("Vector<3, int16_t>", shortVectors, (int16_t)2, roundCount);
+}
+
+
+// @brief Times one operation as a Vector3 loop and then through every available stream kernel set,
+// checking each kernel set's output against the Vector3 loop's.
+// @return true if every kernel set matched.
+template <typename Vector3Function, typename StreamFunction, typename CheckFunction>
+static bool TimeStreamOperation(const char* _name, double _bytesPerRound, int _roundCount, Vector3Function _runVector3s, StreamFunction _runStream, CheckFunction _isSame)
+{
+    const Vector3StreamKernelSet kernelSets[] = { VECTOR3_STREAM_SCALAR_KERNELS, VECTOR3_STREAM_SSE2_KERNELS, VECTOR3_STREAM_AVX2_KERNELS };
+    auto toGigabytesPerSecond = [&](double _nanoseconds) { return _bytesPerRound * _roundCount / _nanoseconds; };
+
+    BenchmarkTimer timer;
+    for (int round = 0; round < _roundCount; ++round)
+    {
+        _runVector3s();
+    }
+    std::cout << "    " << _name << ": Vector3 " << toGigabytesPerSecond(timer.GetElapsedNanoseconds());
+
+    bool isEverySame = true;
+    for (Vector3StreamKernelSet kernelSet : kernelSets)
+    {
+        const Vector3StreamKernels* kernels = GetVector3StreamKernels(kernelSet);
+        if (kernels == nullptr)
+        {
+            continue;
+        }
+
+        timer.Restart();
+        for (int round = 0; round < _roundCount; ++round)
+        {
+            _runStream(*kernels);
+        }
+        double nanoseconds = timer.GetElapsedNanoseconds();
+        bool isSame = _isSame();
+        isEverySame &= isSame;
+        std::cout << ", " << kernels->name << " " << toGigabytesPerSecond(nanoseconds) << (isSame ? "" : " (MISMATCH)");
+    }
+    std::cout << std::endl;
+    return isEverySame;
+}
+
+
+// @brief Add, scale, Dot, Cross, Normalised, Magnitude and bounds over a million vectors, as a loop of
+// Vector3 operators against the Vector3Stream kernels, in GB/s of x, y, z read and written.
+// Also checks every kernel set's results against the Vector3 operators bit for bit.
+// @return true if every result matched.
+bool RunVector3StreamBenchmark()
+{
+    const size_t vectorCount = 1000000;
+    const int roundCount = 20;
+    const double bytesPerVector = 3 * sizeof(float);
+
+    std::mt19937 rng(1234);
+    std::uniform_real_distribution<float> component(-100.0f, 100.0f);
+    std::vector<Vector3> a(vectorCount);
+    std::vector<Vector3> b(vectorCount);
+    for (size_t i = 0; i < vectorCount; ++i)
+    {
+        a[i] = Vector3(component(rng), component(rng), component(rng));
+        b[i] = Vector3(component(rng), component(rng), component(rng));
+    }
+    a[0] = Vector3(0.0f, 0.0f, 0.0f);
+    a[1] = Vector3(1e-30f, 0.0f, -1e-30f);
+
+    Vector3Stream streamA(a);
+    Vector3Stream streamB(b);
+    Vector3Stream streamOut(vectorCount);
+    std::vector<Vector3> vector3Out(vectorCount);
+    std::vector<float> floatOut(vectorCount);
+    std::vector<float> streamFloatOut(vectorCount);
+
+    auto isSameVectors = [&]()
+    {
+        for (size_t i = 0; i < vectorCount; ++i)
+        {
+            if (IsSameVector(streamOut.Get(i), ToScalar(vector3Out[i])) == false)
+            {
+                return false;
+            }
+        }
+        return true;
+    };
+    auto isSameFloats = [&]()
+    {
+        for (size_t i = 0; i < vectorCount; ++i)
+        {
+            if (IsSameFloat(streamFloatOut[i], floatOut[i]) == false)
+            {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    std::cout << "Vector3Stream kernels (" << vectorCount << " vectors, GB/s)" << std::endl;
+    bool isEverySame = true;
+
+    isEverySame &= TimeStreamOperation("a + b", bytesPerVector * 3 * vectorCount, roundCount,
+        [&]() { for (size_t i = 0; i < vectorCount; ++i) { vector3Out[i] = a[i] + b[i]; } },
+        [&](const Vector3StreamKernels& _kernels) { _kernels.add(streamA.GetView(), streamB.GetView(), streamOut.GetView()); },
+        isSameVectors);
+
+    isEverySame &= TimeStreamOperation("a * s", bytesPerVector * 2 * vectorCount, roundCount,
+        [&]() { for (size_t i = 0; i < vectorCount; ++i) { vector3Out[i] = a[i] * 0.25f; } },
+        [&](const Vector3StreamKernels& _kernels) { _kernels.scale(streamA.GetView(), 0.25f, streamOut.GetView()); },
+        isSameVectors);
+
+    isEverySame &= TimeStreamOperation("Dot", (bytesPerVector * 2 + sizeof(float)) * vectorCount, roundCount,
+        [&]() { for (size_t i = 0; i < vectorCount; ++i) { floatOut[i] = a[i].Dot(b[i]); } },
+        [&](const Vector3StreamKernels& _kernels) { _kernels.dot(streamA.GetView(), streamB.GetView(), streamFloatOut.data()); },
+        isSameFloats);
+
+    isEverySame &= TimeStreamOperation("Cross", bytesPerVector * 3 * vectorCount, roundCount,
+        [&]() { for (size_t i = 0; i < vectorCount; ++i) { vector3Out[i] = a[i].Cross(b[i]); } },
+        [&](const Vector3StreamKernels& _kernels) { _kernels.cross(streamA.GetView(), streamB.GetView(), streamOut.GetView()); },
+        isSameVectors);
+
+    isEverySame &= TimeStreamOperation("Normalised", bytesPerVector * 2 * vectorCount, roundCount,
+        [&]() { for (size_t i = 0; i < vectorCount; ++i) { vector3Out[i] = a[i].Normalised(); } },
+        [&](const Vector3StreamKernels& _kernels) { _kernels.normalise(streamA.GetView(), streamOut.GetView()); },
+        isSameVectors);
+
+    isEverySame &= TimeStreamOperation("Magnitude", (bytesPerVector + sizeof(float)) * vectorCount, roundCount,
+        [&]() { for (size_t i = 0; i < vectorCount; ++i) { floatOut[i] = a[i].Magnitude(); } },
+        [&](const Vector3StreamKernels& _kernels) { _kernels.length(streamA.GetView(), streamFloatOut.data()); },
+        isSameFloats);
+
+    // There is no Vector3 min / max, so the Vector3 side is the same compare written out per component
+    ScalarVector3 min = ToScalar(a[0]);
+    ScalarVector3 max = min;
+    Vector3 streamMin;
+    Vector3 streamMax;
+    isEverySame &= TimeStreamOperation("Bounds", bytesPerVector * vectorCount, roundCount,
+        [&]()
+        {
+            min = max = ToScalar(a[0]);
+            for (size_t i = 1; i < vectorCount; ++i)
+            {
+                ScalarVector3 v = ToScalar(a[i]);
+                min = { (v.x < min.x) ? v.x : min.x, (v.y < min.y) ? v.y : min.y, (v.z < min.z) ? v.z : min.z };
+                max = { (v.x > max.x) ? v.x : max.x, (v.y > max.y) ? v.y : max.y, (v.z > max.z) ? v.z : max.z };
+            }
+        },
+        [&](const Vector3StreamKernels& _kernels) { _kernels.bounds(streamA.GetView(), streamMin, streamMax); },
+        [&]() { return IsSameVector(streamMin, min) && IsSameVector(streamMax, max); });
+
+    // The same kernels straight on the Vector3 arrays, through strided views, and the round trip back out
+    std::vector<Vector3> viewOut(vectorCount);
+    AddVector3Streams(ViewConstVector3s(a), ViewConstVector3s(b), ViewVector3s(viewOut));
+    std::vector<Vector3> roundTrip = streamA.ToVector3s();
+    bool isViewSame = true;
+    for (size_t i = 0; i < vectorCount; ++i)
+    {
+        isViewSame &= (viewOut[i] == a[i] + b[i]) && (roundTrip[i] == a[i]);
+    }
+    std::cout << "    Vector3 views and round trip: " << (isViewSame ? "OK" : "FAILED") << std::endl;
+
+    return isEverySame && isViewSame;
+}
+
+
+// @brief Largest componentwise difference between _fast and _exact, plus 1 if exactly one of them is zero.
+// Both should be unit length or zero, so this is the relative error.
+static float GetNormaliseError(const Vector3& _fast, const Vector3& _exact)
+{
+    const Vector3 zero(0.0f, 0.0f, 0.0f);
+    float error = (_fast == zero) != (_exact == zero) ? 1.0f : 0.0f;
+    error = std::max(error, std::abs(_fast.GetX() - _exact.GetX()));
+    error = std::max(error, std::abs(_fast.GetY() - _exact.GetY()));
+    error = std::max(error, std::abs(_fast.GetZ() - _exact.GetZ()));
+    return std::isnan(error) ? 1.0f : error;
+}
+
+
+// @brief Derivative of the cubic Bezier through _p0 to _p3 from its power basis, a t^3 + b t^2 + c t + d,
+// rather than the Bernstein form GetTangentOnCubicBezierCurve works in.
+static Vector3 GetPowerBasisBezierDerivative(const Vector3& _p0, const Vector3& _p1, const Vector3& _p2, const Vector3& _p3, float _t)
+{
+    Vector3 a = (_p3 - _p0) + (_p1 - _p2) * 3.0f;
+    Vector3 b = (_p0 - _p1 * 2.0f + _p2) * 3.0f;
+    Vector3 c = (_p1 - _p0) * 3.0f;
+    return a * (3.0f * _t * _t) + b * (2.0f * _t) + c;
+}
+
+// @brief Exact tangent of GetPointOnInterpolatedBezierSpline at _globalTime, with the segment's control
+// points rebuilt from _points the way the spline builds them.
+static Vector3 GetExactSplineTangent(const std::vector<Vector3>& _points, float _globalTime)
+{
+    size_t lastIndex = _points.size() - 1;
+    float segmentSplit = _globalTime * lastIndex;
+    size_t segment = std::min((size_t)segmentSplit, lastIndex - 1);
+
+    Vector3 startTangent = (segment == 0) ? _points[1] - _points[0] : (_points[segment + 1] - _points[segment - 1]) * 0.5f;
+    Vector3 endTangent = (segment + 1 == lastIndex) ? _points[lastIndex] - _points[lastIndex - 1] : (_points[segment + 2] - _points[segment]) * 0.5f;
+    return GetPowerBasisBezierDerivative(_points[segment], _points[segment] + startTangent * 0.33f,
+                                         _points[segment + 1] - endTangent * 0.33f, _points[segment + 1], segmentSplit - segment).Normalised();
+}
+
+
+// @brief Checks NormalisedFast on Vector3, Vector<3, float>, every stream kernel set, TriangleList
+// face normals and the Bezier tangents against the exact Normalised, and times the two against each other.
+// @return true if every fast result was within 1e-4 of the exact one.
+bool RunVector3FastNormaliseTest()
+{
+    const int randomCount = 1000000;
+    const float maxError = 1e-4f;
+
+    std::vector<Vector3> vectors =
+    {
+        Vector3(0.0f, 0.0f, 0.0f),
+        Vector3(-0.0f, 0.0f, -0.0f),
+        Vector3(1e-30f, 0.0f, 0.0f),
+        Vector3(1e-7f, 0.0f, 0.0f),
+        Vector3(1e15f, -1e15f, 1e15f),
+    };
+    std::mt19937 rng(2718);
+    std::uniform_real_distribution<float> component(-1000.0f, 1000.0f);
+    std::uniform_int_distribution<int> exponent(-16, 16);
+    for (int i = 0; i < randomCount; ++i)
+    {
+        float scale = std::ldexp(1.0f, exponent(rng));
+        vectors.push_back(Vector3(component(rng), component(rng), component(rng)) * scale);
+    }
+
+    std::vector<Vector3> exact(vectors.size());
+    for (size_t i = 0; i < vectors.size(); ++i)
+    {
+        exact[i] = vectors[i].Normalised();
+    }
+
+    std::cout << "NormalisedFast against Normalised (" << vectors.size() << " vectors, max error must be under " << maxError << ")" << std::endl;
+    bool isEveryWithin = true;
+    auto report = [&](const char* _name, float _error)
+    {
+        isEveryWithin &= (_error < maxError);
+        std::cout << "    " << _name << ": max error " << _error << ((_error < maxError) ? "" : "  (TOO LARGE)") << std::endl;
+    };
+
+    float vector3Error = 0.0f;
+    float genericError = 0.0f;
+    for (size_t i = 0; i < vectors.size(); ++i)
+    {
+        const Vector3& vector = vectors[i];
+        Vector<3, float> generic = Vector<3, float>(vector.GetX(), vector.GetY(), vector.GetZ()).NormalisedFast();
+        vector3Error = std::max(vector3Error, GetNormaliseError(vector.NormalisedFast(), exact[i]));
+        genericError = std::max(genericError, GetNormaliseError(Vector3(generic[0], generic[1], generic[2]), exact[i]));
+    }
+    report("Vector3", vector3Error);
+    report("Vector<3, float>", genericError);
+
+    Vector3Stream stream(vectors);
+    Vector3Stream streamOut(vectors.size());
+    const Vector3StreamKernelSet kernelSets[] = { VECTOR3_STREAM_SCALAR_KERNELS, VECTOR3_STREAM_SSE2_KERNELS, VECTOR3_STREAM_AVX2_KERNELS };
+    for (Vector3StreamKernelSet kernelSet : kernelSets)
+    {
+        const Vector3StreamKernels* kernels = GetVector3StreamKernels(kernelSet);
+        if (kernels == nullptr)
+        {
+            continue;
+        }
+        kernels->normaliseFast(stream.GetView(), streamOut.GetView());
+        float streamError = 0.0f;
+        for (size_t i = 0; i < vectors.size(); ++i)
+        {
+            streamError = std::max(streamError, GetNormaliseError(streamOut.Get(i), exact[i]));
+        }
+        std::string name = std::string("Vector3Stream ") + kernels->name;
+        report(name.c_str(), streamError);
+    }
+
+    float faceNormalError = 0.0f;
+    for (size_t i = 2; i < vectors.size(); i += 3)
+    {
+        Vector3 exactNormal = (vectors[i - 1] - vectors[i - 2]).Cross(vectors[i] - vectors[i - 2]).Normalised();
+        faceNormalError = std::max(faceNormalError, GetNormaliseError(TriangleList::CalculateFaceNormal(vectors[i - 2], vectors[i - 1], vectors[i]), exactNormal));
+    }
+    report("TriangleList face normals", faceNormalError);
+
+    // The Bezier tangents, over a general curve, one that starts with zero speed, and the spline through
+    // the console demo's points. A curve that never moves has no direction and must give zero.
+    const int tangentSampleCount = 10000;
+    const Vector3 curves[2][4] =
+    {
+        { Vector3(0.0f, 0.0f, 0.0f), Vector3(9.0f, -1.0f, 2.0f), Vector3(10.0f, 10.0f, -4.0f), Vector3(2.0f, 8.0f, -3.0f) },
+        { Vector3(1.0f, 2.0f, 3.0f), Vector3(1.0f, 2.0f, 3.0f), Vector3(-5.0f, 0.0f, 1.0f), Vector3(4.0f, 4.0f, 4.0f) },
+    };
+    const std::vector<Vector3> splinePoints =
+    {
+        Vector3(0.0f, 0.0f), Vector3(2.0f, 8.0f), Vector3(6.0f, 2.0f), Vector3(10.0f, 10.0f),
+        Vector3(-1.0f, 4.0f), Vector3(7.0f, 0.0f), Vector3(2.0f, 11.0f),
+    };
+    const Vector3& still = curves[1][0];
+    float curveTangentError = GetNormaliseError(GetTangentOnCubicBezierCurve(still, still, still, still, 0.5f), Vector3(0.0f, 0.0f, 0.0f));
+    float splineTangentError = 0.0f;
+    for (int i = 0; i <= tangentSampleCount; ++i)
+    {
+        float t = (float)i / tangentSampleCount;
+        for (const auto& curve : curves)
+        {
+            Vector3 exactCurveTangent = GetPowerBasisBezierDerivative(curve[0], curve[1], curve[2], curve[3], t).Normalised();
+            curveTangentError = std::max(curveTangentError, GetNormaliseError(GetTangentOnCubicBezierCurve(curve[0], curve[1], curve[2], curve[3], t), exactCurveTangent));
+        }
+        splineTangentError = std::max(splineTangentError, GetNormaliseError(GetTangentOnInterpolatedBezierSpline(splinePoints, t), GetExactSplineTangent(splinePoints, t)));
+    }
+
+    // A NaN time counts as 0, rather than reaching the float to size_t cast that picks the segment
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    splineTangentError = std::max(splineTangentError, GetNormaliseError(GetTangentOnInterpolatedBezierSpline(splinePoints, nan), GetExactSplineTangent(splinePoints, 0.0f)));
+    splineTangentError = std::max(splineTangentError, (GetPointOnInterpolatedBezierSpline(splinePoints, nan) == splinePoints[0]) ? 0.0f : 1.0f);
+    report("Bezier curve tangents", curveTangentError);
+    report("Bezier spline tangents", splineTangentError);
+
+    // ~~~ Timing ~~~
+    // A cache sized slice, written out rather than summed, so neither memory nor an add chain hides the difference
+    const size_t timedCount = 4096;
+    const int timedRoundCount = 2000;
+    std::vector<Vector3> timedVectors(vectors.end() - timedCount, vectors.end());
+    std::vector<Vector3> timedOut(timedCount);
+    Vector3Stream timedStream(timedVectors);
+    Vector3Stream timedStreamOut(timedCount);
+
+    BenchmarkTimer timer;
+    for (int round = 0; round < timedRoundCount; ++round)
+    {
+        for (size_t i = 0; i < timedCount; ++i)
+        {
+            timedOut[i] = timedVectors[i].Normalised();
+        }
+        DoNotOptimise(timedOut[round % timedCount]);
+    }
+    double exactNanoseconds = timer.GetElapsedNanoseconds();
+
+    timer.Restart();
+    for (int round = 0; round < timedRoundCount; ++round)
+    {
+        for (size_t i = 0; i < timedCount; ++i)
+        {
+            timedOut[i] = timedVectors[i].NormalisedFast();
+        }
+        DoNotOptimise(timedOut[round % timedCount]);
+    }
+    double fastNanoseconds = timer.GetElapsedNanoseconds();
+
+    timer.Restart();
+    for (int round = 0; round < timedRoundCount; ++round)
+    {
+        NormaliseVector3Stream(timedStream.GetView(), timedStreamOut.GetView());
+    }
+    double streamExactNanoseconds = timer.GetElapsedNanoseconds();
+
+    timer.Restart();
+    for (int round = 0; round < timedRoundCount; ++round)
+    {
+        NormaliseVector3StreamFast(timedStream.GetView(), timedStreamOut.GetView());
+    }
+    double streamFastNanoseconds = timer.GetElapsedNanoseconds();
+
+    double operationCount = (double)timedCount * timedRoundCount;
+    std::cout << "    ns per vector, Normalised vs NormalisedFast: Vector3 " << (exactNanoseconds / operationCount) << " vs " << (fastNanoseconds / operationCount)
+              << ", Vector3Stream " << (streamExactNanoseconds / operationCount) << " vs " << (streamFastNanoseconds / operationCount) << std::endl;
+
+    return isEveryWithin;
+}
+
+
+// How operator / used to guard every divide: a branch, with std::cerr behind it
+template <typename VectorType, typename Scalar>
+static VectorType LegacyCheckedDivide(const VectorType& _vector, Scalar _scalar)
+{
+    if (std::abs(_scalar) < EPSILON)
+    {
+        std::cerr << "Attempted division by zero" << std::endl;
+        return VectorType();
+    }
+    return _vector.template Divide<VECTOR_DIVISION_UNCHECKED>(_scalar);
+}
+
+// @brief ns per divide over _vectors for the old checked operator / and each VectorDivisionPolicy.
+template <typename VectorType>
+static void TimeDivisionPolicies(const char* _name, const std::vector<VectorType>& _vectors, const std::vector<float>& _scalars, int _roundCount)
+{
+    std::vector<VectorType> out(_vectors.size());
+    auto time = [&](auto _divide)
+    {
+        BenchmarkTimer timer;
+        for (int round = 0; round < _roundCount; ++round)
+        {
+            for (size_t i = 0; i < _vectors.size(); ++i)
+            {
+                out[i] = _divide(_vectors[i], _scalars[i]);
+            }
+            DoNotOptimise(out[round % out.size()]);
+        }
+        return timer.GetElapsedNanoseconds() / ((double)_vectors.size() * _roundCount);
+    };
+
+    double legacy = time([](const VectorType& _vector, float _scalar) { return LegacyCheckedDivide(_vector, _scalar); });
+    double unchecked = time([](const VectorType& _vector, float _scalar) { return _vector.template Divide<VECTOR_DIVISION_UNCHECKED>(_scalar); });
+    double asserted = time([](const VectorType& _vector, float _scalar) { return _vector.template Divide<VECTOR_DIVISION_ASSERT>(_scalar); });
+    double saturate = time([](const VectorType& _vector, float _scalar) { return _vector.template Divide<VECTOR_DIVISION_SATURATE>(_scalar); });
+    std::cout << "    " << _name << ": branch and std::cerr " << legacy << ", UNCHECKED " << unchecked
+              << ", ASSERT " << asserted << ", SATURATE " << saturate << std::endl;
+}
+
+
+// @brief Times a vector divided by a scalar under each VectorDivisionPolicy against the old branch and
+// std::cerr check, for Vector3 and Vector<4, float>, and checks SATURATE zeroes (nearly) zero divisors.
+// @return true if SATURATE gave zero for every unsafe divisor and the plain quotient for safe ones.
+bool RunVectorDivisionBenchmark()
+{
+    const size_t vectorCount = 4096;
+    const int roundCount = 2000;
+
+    std::mt19937 rng(99);
+    std::uniform_real_distribution<float> component(-100.0f, 100.0f);
+    std::uniform_real_distribution<float> divisor(0.5f, 2.0f);
+    std::vector<Vector3> vectors;
+    std::vector<Vector<4, float>> genericVectors;
+    std::vector<float> scalars;
+    for (size_t i = 0; i < vectorCount; ++i)
+    {
+        float x = component(rng), y = component(rng), z = component(rng), w = component(rng);
+        vectors.push_back(Vector3(x, y, z));
+        genericVectors.push_back(Vector<4, float>(x, y, z, w));
+        scalars.push_back(divisor(rng));
+    }
+
+    std::cout << "Vector divide by scalar (ns per divide, default policy is "
+              << ((VECTOR_DIVISION_DEFAULT_POLICY == VECTOR_DIVISION_UNCHECKED) ? "UNCHECKED" : (VECTOR_DIVISION_DEFAULT_POLICY == VECTOR_DIVISION_ASSERT) ? "ASSERT" : "SATURATE")
+              << ")" << std::endl;
+    TimeDivisionPolicies("Vector3", vectors, scalars, roundCount);
+    TimeDivisionPolicies("Vector<4, float>", genericVectors, scalars, roundCount);
+
+    const float unsafeDivisors[] = { 0.0f, -0.0f, 1e-8f, -1e-8f, (float)EPSILON * 0.99f, std::numeric_limits<float>::quiet_NaN() };
+    const Vector3 vector(1.0f, -2.0f, 3.0f);
+    const Vector<3, int> intVector(4, -6, 8);
+    bool isSaturating = true;
+    for (float unsafeDivisor : unsafeDivisors)
+    {
+        isSaturating &= IsSameVector(vector.Divide<VECTOR_DIVISION_SATURATE>(unsafeDivisor), { 0.0f, 0.0f, 0.0f });
+        isSaturating &= (Vector<3, float>(1.0f, -2.0f, 3.0f).Divide<VECTOR_DIVISION_SATURATE>(unsafeDivisor) == Vector<3, float>());
+
+        // Infinite and NaN components are zeroed too, not divided through to NaN
+        const float infinity = std::numeric_limits<float>::infinity();
+        const float nan = std::numeric_limits<float>::quiet_NaN();
+        Vector3 nonFiniteQuotient = Vector3(infinity, nan, -infinity).Divide<VECTOR_DIVISION_SATURATE>(unsafeDivisor);
+        isSaturating &= IsSameVector(nonFiniteQuotient, { 0.0f, 0.0f, 0.0f });
+        Vector<4, float> genericQuotient = Vector<4, float>(infinity, nan, -infinity, 1.0f).Divide<VECTOR_DIVISION_SATURATE>(unsafeDivisor);
+        for (int i = 0; i < 4; ++i)
+        {
+            isSaturating &= (std::bit_cast<uint32_t>(genericQuotient[i]) == 0u);
+        }
+    }
+    isSaturating &= (intVector.Divide<VECTOR_DIVISION_SATURATE>(0) == Vector<3, int>());
+    isSaturating &= (intVector.Divide<VECTOR_DIVISION_SATURATE>(2) == Vector<3, int>(2, -3, 4));
+    isSaturating &= IsSameVector(vector.Divide<VECTOR_DIVISION_SATURATE>(GetEpsilonAsFloat()), ScalarDivide(ToScalar(vector), GetEpsilonAsFloat()));
+    isSaturating &= IsSameVector(vector.Divide<VECTOR_DIVISION_SATURATE>(0.3f), ScalarDivide(ToScalar(vector), 0.3f));
+    std::cout << "    SATURATE zeroes unsafe divisors only: " << (isSaturating ? "OK" : "FAILED") << std::endl;
+    return isSaturating;
+}
+
+
+// The operators as they were before expression templates: every one fills a whole temporary Vector
+template <int N, typename T>
+static Vector<N, T> LegacyAdd(const Vector<N, T>& _a, const Vector<N, T>& _b)
+{
+    Vector<N, T> result;
+    for (int i = 0; i < N; ++i)
+    {
+        result[i] = _a.GetComponent(i) + _b.GetComponent(i);
+    }
+    return result;
+}
+
+template <int N, typename T>
+static Vector<N, T> LegacySubtract(const Vector<N, T>& _a, const Vector<N, T>& _b)
+{
+    Vector<N, T> result;
+    for (int i = 0; i < N; ++i)
+    {
+        result[i] = _a.GetComponent(i) - _b.GetComponent(i);
+    }
+    return result;
+}
+
+template <int N, typename T>
+static Vector<N, T> LegacyScale(const Vector<N, T>& _a, T _scalar)
+{
+    Vector<N, T> result;
+    for (int i = 0; i < N; ++i)
+    {
+        result[i] = _a.GetComponent(i) * _scalar;
+    }
+    return result;
+}
+
+// @brief ns per a + b * s - c over _vectorCount Vector<N, float>s, with a temporary per operator against
+// one fused loop, and whether both gave the same floats.
+template <int N>
+static bool TimeExpression(size_t _vectorCount, int _roundCount)
+{
+    std::mt19937 rng(N);
+    std::uniform_real_distribution<float> component(-100.0f, 100.0f);
+    std::vector<Vector<N, float>> a(_vectorCount), b(_vectorCount), c(_vectorCount);
+    for (size_t i = 0; i < _vectorCount; ++i)
+    {
+        for (int j = 0; j < N; ++j)
+        {
+            a[i][j] = component(rng);
+            b[i][j] = component(rng);
+            c[i][j] = component(rng);
+        }
+    }
+    const float scalar = 0.75f;
+
+    std::vector<Vector<N, float>> legacyOut(_vectorCount), fusedOut(_vectorCount);
+    BenchmarkTimer legacyTimer;
+    for (int round = 0; round < _roundCount; ++round)
+    {
+        for (size_t i = 0; i < _vectorCount; ++i)
+        {
+            legacyOut[i] = LegacySubtract(LegacyAdd(a[i], LegacyScale(b[i], scalar)), c[i]);
+        }
+        DoNotOptimise(legacyOut[round % _vectorCount]);
+    }
+    double legacyNanoseconds = legacyTimer.GetElapsedNanoseconds();
+
+    BenchmarkTimer fusedTimer;
+    for (int round = 0; round < _roundCount; ++round)
+    {
+        for (size_t i = 0; i < _vectorCount; ++i)
+        {
+            fusedOut[i] = a[i] + b[i] * scalar - c[i];
+        }
+        DoNotOptimise(fusedOut[round % _vectorCount]);
+    }
+    double fusedNanoseconds = fusedTimer.GetElapsedNanoseconds();
+
+    bool isSame = (legacyOut == fusedOut);
+    double operationCount = (double)_vectorCount * _roundCount;
+    std::cout << "    Vector<" << N << ", float>: temporaries " << (legacyNanoseconds / operationCount)
+              << ", expression " << (fusedNanoseconds / operationCount) << (isSame ? "" : " (results differ)") << std::endl;
+    return isSame;
+}
+
+
+// @brief Times out = a + b * s - c for Vector<N, float> with N of 3, 16 and 64, with the operators
+// making a temporary Vector each as they used to against the expression templates.
+// @return true if both ways gave the same floats.
+bool RunVectorExpressionBenchmark()
+{
+    std::cout << "Vector a + b * s - c, temporaries vs expression templates (ns per expression)" << std::endl;
+    bool isSame = true;
+    isSame &= TimeExpression<3>(4096, 2000);
+    isSame &= TimeExpression<16>(4096, 500);
+    isSame &= TimeExpression<64>(1024, 500);
+    return isSame;
+}
+
+
+// Dot as it was for every N: one accumulator, so every add waits on the one before
+template <int N>
+static float LegacyDot(const Vector<N, float>& _a, const Vector<N, float>& _b)
+{
+    float sum = 0.0f;
+    for (int i = 0; i < N; ++i)
+    {
+        sum += _a.GetComponent(i) * _b.GetComponent(i);
+    }
+    return sum;
+}
+
+template <int N>
+static std::vector<Vector<N, float>> MakeRandomVectors(size_t _count, std::mt19937& _rng)
+{
+    std::uniform_real_distribution<float> component(-1.0f, 1.0f);
+    std::vector<Vector<N, float>> vectors(_count);
+    for (Vector<N, float>& vector : vectors)
+    {
+        for (int i = 0; i < N; ++i)
+        {
+            vector[i] = component(_rng);
+        }
+    }
+    return vectors;
+}
+
+// @brief ns per dot for the old single accumulator loop, Dot, each dot kernel set and DotAccurate on
+// Vector<N, float>, and the largest error of each against a long double sum.
+// @return true if DotAccurate was within one float rounding of the long double sum every time.
+template <int N>
+static bool TimeDotProducts()
+{
+    const VectorDotKernelSet kernelSets[] = { DOT_SCALAR_KERNELS, DOT_SSE2_KERNELS, DOT_AVX2_FMA_KERNELS };
+    const size_t pairCount = std::max<size_t>(64, 16384 / N);
+    const int roundCount = (int)(50000000 / (pairCount * N));
+
+    std::mt19937 rng(N);
+    std::vector<Vector<N, float>> a = MakeRandomVectors<N>(pairCount, rng);
+    std::vector<Vector<N, float>> b = MakeRandomVectors<N>(pairCount, rng);
+    std::vector<float> dots(pairCount);
+    auto time = [&](auto _dot)
+    {
+        BenchmarkTimer timer;
+        for (int round = 0; round < roundCount; ++round)
+        {
+            for (size_t i = 0; i < pairCount; ++i)
+            {
+                dots[i] = _dot(a[i], b[i]);
+            }
+            DoNotOptimise(dots[round % pairCount]);
+        }
+        return timer.GetElapsedNanoseconds() / ((double)pairCount * roundCount);
+    };
+
+    double legacy = time([](const Vector<N, float>& _a, const Vector<N, float>& _b) { return LegacyDot(_a, _b); });
+    double dot = time([](const Vector<N, float>& _a, const Vector<N, float>& _b) { return _a.Dot(_b); });
+    double accurate = time([](const Vector<N, float>& _a, const Vector<N, float>& _b) { return _a.DotAccurate(_b); });
+    std::cout << "    N " << N << ": single accumulator " << legacy << ", Dot " << dot << " (" << (legacy / dot) << "x)";
+    for (VectorDotKernelSet kernelSet : kernelSets)
+    {
+        const VectorDotKernels* kernels = GetVectorDotKernels(kernelSet);
+        if (kernels != nullptr)
+        {
+            std::cout << ", " << kernels->name << " " << time([&](const Vector<N, float>& _a, const Vector<N, float>& _b) { return kernels->dot(&_a[0], &_b[0], N); });
+        }
+    }
+    std::cout << ", DotAccurate " << accurate << std::endl;
+
+    // Errors are relative to the sum of |a[i] * b[i]|, as cancellation can make the dot itself any size
+    double legacyError = 0.0, dotError = 0.0, accurateError = 0.0;
+    bool isAccurate = true;
+    for (size_t i = 0; i < pairCount; ++i)
+    {
+        long double exact = 0.0L, magnitude = 0.0L;
+        for (int j = 0; j < N; ++j)
+        {
+            long double product = (long double)a[i][j] * b[i][j];
+            exact += product;
+            magnitude += std::abs(product);
+        }
+        auto getError = [&](float _dot) { return (double)(std::abs(_dot - exact) / magnitude); };
+        legacyError = std::max(legacyError, getError(LegacyDot(a[i], b[i])));
+        dotError = std::max(dotError, getError(a[i].Dot(b[i])));
+        float accurateDot = a[i].DotAccurate(b[i]);
+        accurateError = std::max(accurateError, getError(accurateDot));
+
+        // Rounding to float is the only error left: half an ulp of the result, plus the double sum's error
+        isAccurate &= (std::abs(accurateDot - exact) <= std::abs(exact) * 0x1p-24L + magnitude * 0x1p-45L);
+    }
+    std::cout << "        max error: single accumulator " << legacyError << ", Dot " << dotError << ", DotAccurate " << accurateError
+              << (isAccurate ? "" : "  (DotAccurate INACCURATE)") << std::endl;
+    return isAccurate;
+}
+
+// @brief ns per vector for a query dotted against _vectorCount Vector<N, float>s one Dot at a time and
+// with DotBatch, and every kernel set's dotBatch checked against its dot.
+// @return true if every batch gave the same bits as the single dots.
+template <int N>
+static bool TimeDotBatch(size_t _vectorCount, int _roundCount)
+{
+    const VectorDotKernelSet kernelSets[] = { DOT_SCALAR_KERNELS, DOT_SSE2_KERNELS, DOT_AVX2_FMA_KERNELS };
+    std::mt19937 rng(N + 1);
+    const Vector<N, float> query = MakeRandomVectors<N>(1, rng)[0];
+    const std::vector<Vector<N, float>> vectors = MakeRandomVectors<N>(_vectorCount, rng);
+    std::vector<float> legacyDots(_vectorCount), dots(_vectorCount), batchDots(_vectorCount);
+
+    BenchmarkTimer timer;
+    for (int round = 0; round < _roundCount; ++round)
+    {
+        for (size_t i = 0; i < _vectorCount; ++i)
+        {
+            legacyDots[i] = LegacyDot(query, vectors[i]);
+        }
+        DoNotOptimise(legacyDots[round % _vectorCount]);
+    }
+    double legacyNanoseconds = timer.GetElapsedNanoseconds();
+
+    timer.Restart();
+    for (int round = 0; round < _roundCount; ++round)
+    {
+        for (size_t i = 0; i < _vectorCount; ++i)
+        {
+            dots[i] = query.Dot(vectors[i]);
+        }
+        DoNotOptimise(dots[round % _vectorCount]);
+    }
+    double dotNanoseconds = timer.GetElapsedNanoseconds();
+
+    timer.Restart();
+    for (int round = 0; round < _roundCount; ++round)
+    {
+        DotBatch(query, vectors, batchDots.data());
+        DoNotOptimise(batchDots[round % _vectorCount]);
+    }
+    double batchNanoseconds = timer.GetElapsedNanoseconds();
+
+    bool isSame = (dots == batchDots);
+    for (VectorDotKernelSet kernelSet : kernelSets)
+    {
+        const VectorDotKernels* kernels = GetVectorDotKernels(kernelSet);
+        if (kernels != nullptr)
+        {
+            // An odd count, so the pairs and the single row left over are both checked
+            size_t rowCount = _vectorCount - 1;
+            kernels->dotBatch(&query[0], &vectors[0][0], N, rowCount, N, batchDots.data());
+            for (size_t i = 0; i < rowCount; ++i)
+            {
+                isSame &= (batchDots[i] == kernels->dot(&query[0], &vectors[i][0], N));
+            }
+        }
+    }
+
+    double operationCount = (double)_vectorCount * _roundCount;
+    std::cout << "    Vector<" << N << ", float> x " << _vectorCount << ": single accumulator " << (legacyNanoseconds / operationCount)
+              << ", Dot " << (dotNanoseconds / operationCount) << ", DotBatch " << (batchNanoseconds / operationCount)
+              << (isSame ? "" : "  (BATCH MISMATCH)") << std::endl;
+    return isSame;
+}
+
+
+// @brief Times Dot on Vector<N, float> for N from 4 to 1024 against the old single accumulator loop and
+// each dot kernel set, reports each one's error, and times DotBatch against a loop of Dot.
+// @return true if DotAccurate was accurate and DotBatch matched Dot bit for bit.
+bool RunVectorDotBenchmark()
+{
+    std::cout << "Vector<N, float> Dot (ns per dot)" << std::endl;
+    bool isOk = true;
+    isOk &= TimeDotProducts<4>();
+    isOk &= TimeDotProducts<8>();
+    isOk &= TimeDotProducts<16>();
+    isOk &= TimeDotProducts<32>();
+    isOk &= TimeDotProducts<64>();
+    isOk &= TimeDotProducts<128>();
+    isOk &= TimeDotProducts<256>();
+    isOk &= TimeDotProducts<512>();
+    isOk &= TimeDotProducts<1024>();
+
+    std::cout << "One query dotted against many vectors (ns per vector)" << std::endl;
+    isOk &= TimeDotBatch<16>(8191, 200);
+    isOk &= TimeDotBatch<128>(4095, 100);
+    isOk &= TimeDotBatch<1024>(511, 100);
+    return isOk;
+}
+
+
+// operator [] as it was: a bounds check, and a throw behind it, on every access
+template <int N, typename T>
+static const T& LegacyCheckedComponent(const Vector<N, T>& _vector, int _index)
+{
+    if (_index >= N)
+    {
+        throw std::out_of_range("Vector::operator [] : index out of bounds");
+    }
+    return _vector[_index];
+}
+
+// @brief ns per access reading one component of each of 4096 Vector<16, float>s at a runtime index, and
+// summing every component with a loop over operator [], through the old checked access and the new one.
+// @return true if both gave the same results.
+bool RunVectorAccessBenchmark()
+{
+    const size_t vectorCount = 4096;
+    const int roundCount = 2000;
+    const int componentCount = 16;
+
+    std::mt19937 rng(21);
+    std::vector<Vector<componentCount, float>> vectors = MakeRandomVectors<componentCount>(vectorCount, rng);
+    std::uniform_int_distribution<int> index(0, componentCount - 1);
+    std::vector<int> indices(vectorCount);
+    for (int& i : indices)
+    {
+        i = index(rng);
+    }
+
+    std::vector<float> out(vectorCount);
+    auto time = [&](auto _access)
+    {
+        BenchmarkTimer timer;
+        for (int round = 0; round < roundCount; ++round)
+        {
+            for (size_t i = 0; i < vectorCount; ++i)
+            {
+                out[i] = _access(vectors[i], indices[i]);
+            }
+            DoNotOptimise(out[round % vectorCount]);
+        }
+        return timer.GetElapsedNanoseconds() / ((double)vectorCount * roundCount);
+    };
+
+    using VectorType = Vector<componentCount, float>;
+    double legacyGather = time([](const VectorType& _vector, int _index) { return LegacyCheckedComponent(_vector, _index); });
+    std::vector<float> legacyOut = out;
+    double gather = time([](const VectorType& _vector, int _index) { return _vector[_index]; });
+    bool isSame = (out == legacyOut);
+
+    auto sumComponents = [](auto _access)
+    {
+        return [=](const VectorType& _vector, int)
+        {
+            float sum = 0.0f;
+            for (int i = 0; i < componentCount; ++i)
+            {
+                sum += _access(_vector, i);
+            }
+            return sum;
+        };
+    };
+    double legacySum = time(sumComponents([](const VectorType& _vector, int _index) { return LegacyCheckedComponent(_vector, _index); }));
+    legacyOut = out;
+    double sum = time(sumComponents([](const VectorType& _vector, int _index) { return _vector[_index]; }));
+    isSame &= (out == legacyOut);
+
+    std::cout << "Vector<16, float> operator [] (ns per vector), checked and throwing vs asserted" << std::endl;
+    std::cout << "    runtime index: " << legacyGather << " vs " << gather << ", sum over components: " << legacySum << " vs " << sum
+              << (isSame ? "" : "  (MISMATCH)") << std::endl;
+    return isSame;
+}
+
+
+// @brief Checks every half and int16_t kernel set against the inline conversions bit for bit, over every half,
+// every int16_t and a million floats, and checks the round trip errors are within their bounds.
+// @return true if everything matched and every error was within bounds.
+static bool CheckQuantizationKernels()
+{
+    const VectorQuantizationKernelSet kernelSets[] = { QUANTIZATION_SCALAR_KERNELS, QUANTIZATION_SSE2_KERNELS, QUANTIZATION_AVX2_F16C_KERNELS };
+    const size_t floatCount = 1 << 20;
+    const VectorQuantization quantization = VectorQuantization::ForRange(-100.0f, 100.0f);
+
+    // Every half and every int16_t, and floats from random bits (every exponent, NaNs, infinities),
+    // from the half range, and from around the quantized range, plus the edges of each
+    std::vector<Half> allHalves(1 << 16);
+    std::vector<int16_t> allQuantized(1 << 16);
+    for (size_t i = 0; i < allHalves.size(); ++i)
+    {
+        allHalves[i] = Half::FromBits((uint16_t)i);
+        allQuantized[i] = (int16_t)(uint16_t)i;
+    }
+    std::mt19937 rng(22);
+    std::uniform_int_distribution<uint32_t> randomBits;
+    std::uniform_real_distribution<float> halfRange(-70000.0f, 70000.0f);
+    std::uniform_real_distribution<float> quantizedRange(-120.0f, 120.0f);
+    std::vector<float> floats(floatCount);
+    for (size_t i = 0; i < floatCount; ++i)
+    {
+        floats[i] = (i % 3 == 0) ? std::bit_cast<float>(randomBits(rng)) : (i % 3 == 1) ? halfRange(rng) : quantizedRange(rng);
+    }
+    const float edges[] = { 0.0f, -0.0f, 65504.0f, 65519.996f, 65520.0f, 6.1035156e-5f, 6.0975552e-5f, 2.9802322e-8f, 2.9802326e-8f,
+                            -100.0f, 100.0f, 100.00153f, std::numeric_limits<float>::infinity(), std::numeric_limits<float>::quiet_NaN() };
+    std::copy(std::begin(edges), std::end(edges), floats.begin());
+
+    auto isSameBits = [](float _a, float _b) { return std::bit_cast<uint32_t>(_a) == std::bit_cast<uint32_t>(_b); };
+    bool isSame = true;
+    for (VectorQuantizationKernelSet kernelSet : kernelSets)
+    {
+        const VectorQuantizationKernels* kernels = GetVectorQuantizationKernels(kernelSet);
+        if (kernels == nullptr)
+        {
+            continue;
+        }
+
+        // Odd counts, so the scalar tails are checked too
+        std::vector<float> decoded(allHalves.size());
+        kernels->decodeHalfs(allHalves.data(), decoded.data(), allHalves.size() - 3);
+        std::vector<Half> encoded(floatCount);
+        kernels->encodeHalfs(floats.data(), encoded.data(), floatCount - 5);
+        std::vector<float> dequantized(allQuantized.size());
+        kernels->dequantize(allQuantized.data(), dequantized.data(), allQuantized.size() - 7, quantization);
+        std::vector<int16_t> quantized(floatCount);
+        kernels->quantize(floats.data(), quantized.data(), floatCount - 9, quantization);
+
+        bool isKernelSame = true;
+        for (size_t i = 0; i + 3 < allHalves.size(); ++i)
+        {
+            isKernelSame &= isSameBits(decoded[i], (float)allHalves[i]);
+        }
+        for (size_t i = 0; i + 7 < allQuantized.size(); ++i)
+        {
+            isKernelSame &= isSameBits(dequantized[i], DequantizeComponent(allQuantized[i], quantization));
+        }
+        for (size_t i = 0; i + 9 < floatCount; ++i)
+        {
+            isKernelSame &= (i + 5 >= floatCount) || (encoded[i] == Half(floats[i]));
+            isKernelSame &= (quantized[i] == QuantizeComponent(floats[i], quantization));
+        }
+        std::cout << "    " << kernels->name << " kernels match the inline conversions: " << (isKernelSame ? "OK" : "FAILED") << std::endl;
+        isSame &= isKernelSame;
+    }
+
+    // Round trips: halves keep 11 significant bits over the normal range, int16_t within GetMaxError over its range
+    double halfError = 0.0, quantizedError = 0.0;
+    for (float value : floats)
+    {
+        float magnitude = std::abs(value);
+        if (magnitude >= 6.1035156e-5f && magnitude <= 65504.0f)
+        {
+            halfError = std::max(halfError, (double)std::abs((float)Half(value) - value) / magnitude);
+        }
+        if (value >= -100.0f && value <= 100.0f)
+        {
+            quantizedError = std::max(quantizedError, (double)std::abs(DequantizeComponent(QuantizeComponent(value, quantization), quantization) - value));
+        }
+    }
+    bool isWithinBounds = (halfError <= 1.0 / 2048.0) && (quantizedError <= quantization.GetMaxError());
+    std::cout << "    max round trip error: half " << halfError << " relative (bound " << (1.0 / 2048.0) << "), int16_t over [-100, 100] "
+              << quantizedError << " (bound " << quantization.GetMaxError() << ")" << (isWithinBounds ? "" : "  (OUT OF BOUNDS)") << std::endl;
+    return isSame && isWithinBounds;
+}
+
+// @brief Sum of _count floats read straight from memory, or decoded a block at a time with _decode.
+// _count must be a multiple of 8.
+template <typename Component, typename DecodeFunction>
+static float SumDecodedComponents(const Component* _components, size_t _count, DecodeFunction _decode)
+{
+    const size_t blockSize = 1024;
+    float block[blockSize];
+    float sums[8] = {};
+    for (size_t start = 0; start < _count; start += blockSize)
+    {
+        size_t count = std::min(blockSize, _count - start);
+        const float* values = _decode(_components + start, block, count);
+
+        // Eight independent sums, which the compiler turns into whole register adds
+        for (size_t i = 0; i + 8 <= count; i += 8)
+        {
+            for (size_t k = 0; k < 8; ++k)
+            {
+                sums[k] += values[i + k];
+            }
+        }
+    }
+    return ((sums[0] + sums[1]) + (sums[2] + sums[3])) + ((sums[4] + sums[5]) + (sums[6] + sums[7]));
+}
+
+
+// @brief Checks the half and int16_t conversions (see CheckQuantizationKernels), times each kernel set encoding
+// and decoding a million Vector<4, float>, and times summing 4 million Vector<4, float> read as floats, halves
+// and int16_ts, to show what the smaller storage saves in memory bandwidth.
+// @return true if every kernel set matched the inline conversions and every error was within bounds.
+bool RunVectorQuantizationBenchmark()
+{
+    std::cout << "Vector<N, Half> and Vector<N, int16_t> storage" << std::endl;
+    bool isOk = CheckQuantizationKernels();
+
+    const VectorQuantizationKernelSet kernelSets[] = { QUANTIZATION_SCALAR_KERNELS, QUANTIZATION_SSE2_KERNELS, QUANTIZATION_AVX2_F16C_KERNELS };
+    const VectorQuantization quantization = VectorQuantization::ForRange(-1.0f, 1.0f);
+    const size_t vectorCount = 1 << 20;
+    const int roundCount = 10;
+    std::mt19937 rng(23);
+    std::vector<Vector<4, float>> vectors = MakeRandomVectors<4>(vectorCount, rng);
+    std::vector<Vector<4, Half>> halfVectors(vectorCount);
+    std::vector<Vector<4, int16_t>> quantizedVectors(vectorCount);
+    std::vector<Vector<4, float>> decodedVectors(vectorCount);
+
+    auto time = [&](auto _convert)
+    {
+        BenchmarkTimer timer;
+        for (int round = 0; round < roundCount; ++round)
+        {
+            _convert();
+        }
+        return timer.GetElapsedNanoseconds() / ((double)vectorCount * roundCount);
+    };
+    std::cout << "    ns per Vector<4, float> for encode half, decode half, quantize, dequantize" << std::endl;
+    for (VectorQuantizationKernelSet kernelSet : kernelSets)
+    {
+        const VectorQuantizationKernels* kernels = GetVectorQuantizationKernels(kernelSet);
+        if (kernels == nullptr)
+        {
+            continue;
+        }
+        const size_t floatCount = vectorCount * 4;
+        double encodeHalf = time([&]() { kernels->encodeHalfs(&vectors[0][0], &halfVectors[0][0], floatCount); });
+        double decodeHalf = time([&]() { kernels->decodeHalfs(&halfVectors[0][0], &decodedVectors[0][0], floatCount); });
+        double quantize = time([&]() { kernels->quantize(&vectors[0][0], &quantizedVectors[0][0], floatCount, quantization); });
+        double dequantize = time([&]() { kernels->dequantize(&quantizedVectors[0][0], &decodedVectors[0][0], floatCount, quantization); });
+        std::cout << "        " << kernels->name << ": " << encodeHalf << ", " << decodeHalf << ", " << quantize << ", " << dequantize << std::endl;
+    }
+
+    // A scan over 4 million vectors, far bigger than the caches, reading 64 MB of floats or 32 MB of either 16 bit form
+    const size_t scanVectorCount = 4 * vectorCount;
+    const int scanRoundCount = 5;
+    std::vector<Vector<4, float>> scanVectors = MakeRandomVectors<4>(scanVectorCount, rng);
+    std::vector<Vector<4, Half>> scanHalfVectors(scanVectorCount);
+    std::vector<Vector<4, int16_t>> scanQuantizedVectors(scanVectorCount);
+    EncodeHalfVectors<4>(scanVectors, scanHalfVectors);
+    QuantizeVectors<4>(scanVectors, scanQuantizedVectors, quantization);
+
+    auto timeScan = [&](const auto* _components, auto _decode)
+    {
+        float sum = 0.0f;
+        BenchmarkTimer timer;
+        for (int round = 0; round < scanRoundCount; ++round)
+        {
+            sum += SumDecodedComponents(_components, scanVectorCount * 4, _decode);
+        }
+        DoNotOptimise(sum);
+        return timer.GetElapsedNanoseconds() / ((double)scanVectorCount * scanRoundCount);
+    };
+    double floatScan = timeScan(&scanVectors[0][0], [](const float* _in, float*, size_t) { return _in; });
+    double halfScan = timeScan(&scanHalfVectors[0][0], [](const Half* _in, float* _out, size_t _count) { DecodeHalfs(_in, _out, _count); return (const float*)_out; });
+    double quantizedScan = timeScan(&scanQuantizedVectors[0][0], [&](const int16_t* _in, float* _out, size_t _count) { DequantizeFloats(_in, _out, _count, quantization); return (const float*)_out; });
+    std::cout << "    sum over 4M Vector<4> (ns per vector): float " << floatScan << ", Half " << halfScan << ", int16_t " << quantizedScan << std::endl;
+    return isOk;
+}
+
+
+// ~~~ Matrix4x4 and Quaternion ~~~
+
+// Random transforms and vectors worked out at compile time, so each result comes from the constexpr
+// scalar paths and the checks below can hold the SSE paths to it bit for bit
+struct TransformCheckCase
+{
+    Matrix4x4 a;
+    Matrix4x4 b;
+    Vector3 vector;
+    Quaternion p;
+    Quaternion q;
+
+    Matrix4x4 product;
+    Matrix4x4 inverse;
+    bool isInvertible;
+    Vector3 point;
+    Vector3 direction;
+    Quaternion composed;
+};
+
+static const size_t TRANSFORM_CHECK_CASE_COUNT = 128;
+
+static constexpr std::array<TransformCheckCase, TRANSFORM_CHECK_CASE_COUNT> MakeTransformCheckCases()
+{
+    uint64_t state = 0x9E3779B97F4A7C15ull;
+    auto random = [&]()
+    {
+        // -10 to 10 in steps of 1 / 1024, so products and sums have to round
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        return (float)((int)(state >> 41) % 20480 - 10240) / 1024.0f;
+    };
+    auto randomMatrix = [&]()
+    {
+        float rows[16] = {};
+        for (float& value : rows)
+        {
+            value = random();
+        }
+        return Matrix4x4::FromRows(rows);
+    };
+
+    std::array<TransformCheckCase, TRANSFORM_CHECK_CASE_COUNT> cases = {};
+    for (size_t i = 0; i < cases.size(); ++i)
+    {
+        TransformCheckCase& check = cases[i];
+        check.a = randomMatrix();
+        check.b = randomMatrix();
+        check.vector = Vector3(random(), random(), random());
+        check.p = Quaternion(random(), random(), random(), random());
+        check.q = Quaternion(random(), random(), random(), random());
+    }
+    cases[0].a = Matrix4x4::Scale(Vector3(1.0f, 0.0f, 1.0f));
+    cases[1].a = Matrix4x4::FromRows({ 1, 2, 3, 4, 2, 4, 6, 8, 0, 1, 0, 1, 5, 0, 0, 1 });
+
+    for (TransformCheckCase& check : cases)
+    {
+        check.product = check.a * check.b;
+        check.isInvertible = check.a.Inverse(check.inverse);
+        check.point = check.a.TransformPoint(check.vector);
+        check.direction = check.a.TransformDirection(check.vector);
+        check.composed = check.p * check.q;
+    }
+    return cases;
+}
+
+static bool IsSameMatrix(const Matrix4x4& _a, const Matrix4x4& _b)
+{
+    for (size_t i = 0; i < 16; ++i)
+    {
+        if (IsSameFloat(_a.GetData()[i], _b.GetData()[i]) == false)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool IsSameQuaternion(const Quaternion& _a, const Quaternion& _b)
+{
+    return IsSameFloat(_a.GetX(), _b.GetX()) && IsSameFloat(_a.GetY(), _b.GetY()) && IsSameFloat(_a.GetZ(), _b.GetZ()) && IsSameFloat(_a.GetW(), _b.GetW());
+}
+
+static Quaternion MakeRandomRotation(std::mt19937& _rng)
+{
+    std::normal_distribution<float> component(0.0f, 1.0f);
+    return Quaternion(component(_rng), component(_rng), component(_rng), component(_rng)).Normalised();
+}
+
+static float GetRelativeError(const Vector3& _value, const Vector3& _expected)
+{
+    return (_value - _expected).Magnitude() / std::max(_expected.Magnitude(), 1.0f);
+}
+
+
+// @brief Runtime results against the constexpr ones bit for bit, every kernel set against TransformPoint
+// and TransformDirection bit for bit, and inverses and rotations against their error bounds.
+static bool CheckTransforms()
+{
+    static constexpr std::array<TransformCheckCase, TRANSFORM_CHECK_CASE_COUNT> CASES = MakeTransformCheckCases();
+    std::vector<TransformCheckCase> cases(CASES.begin(), CASES.end());
+
+    size_t mismatchCount = 0;
+    for (const TransformCheckCase& check : cases)
+    {
+        Matrix4x4 inverse;
+        bool isInvertible = check.a.Inverse(inverse);
+        bool isSame = IsSameMatrix(check.a * check.b, check.product)
+            && isInvertible == check.isInvertible && (isInvertible == false || IsSameMatrix(inverse, check.inverse))
+            && IsSameVector(check.a.TransformPoint(check.vector), ToScalar(check.point))
+            && IsSameVector(check.a.TransformDirection(check.vector), ToScalar(check.direction))
+            && IsSameQuaternion(check.p * check.q, check.composed);
+        mismatchCount += isSame ? 0 : 1;
+    }
+    std::cout << "    " << (VECTOR3_ENABLE_SIMD ? "SSE" : "scalar") << " results against constexpr (" << cases.size() << " cases): "
+              << ((mismatchCount == 0) ? "OK" : "FAILED") << std::endl;
+
+    // Every kernel set, out of place and in place, against a loop of TransformPoint / TransformDirection
+    const size_t vectorCount = 100003;
+    std::mt19937 rng(2718);
+    std::uniform_real_distribution<float> component(-100.0f, 100.0f);
+    std::vector<Vector3> vectors(vectorCount);
+    for (Vector3& vector : vectors)
+    {
+        vector = Vector3(component(rng), component(rng), component(rng));
+    }
+    const Matrix4x4& matrix = cases[2].a;
+    std::vector<Vector3> expectedPoints(vectorCount);
+    std::vector<Vector3> expectedDirections(vectorCount);
+    for (size_t i = 0; i < vectorCount; ++i)
+    {
+        expectedPoints[i] = matrix.TransformPoint(vectors[i]);
+        expectedDirections[i] = matrix.TransformDirection(vectors[i]);
+    }
+    auto isSameVectors = [&](const std::vector<Vector3>& _vectors, const std::vector<Vector3>& _expected)
+    {
+        for (size_t i = 0; i < _vectors.size(); ++i)
+        {
+            if (IsSameVector(_vectors[i], ToScalar(_expected[i])) == false)
+            {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    bool isEveryKernelSame = true;
+    const TransformKernelSet kernelSets[] = { TRANSFORM_SCALAR_KERNELS, TRANSFORM_SSE2_KERNELS, TRANSFORM_AVX2_KERNELS };
+    std::cout << "    kernels against TransformPoint:";
+    for (TransformKernelSet kernelSet : kernelSets)
+    {
+        const TransformKernels* kernels = GetTransformKernels(kernelSet);
+        if (kernels == nullptr)
+        {
+            continue;
+        }
+        std::vector<Vector3> points(vectorCount);
+        kernels->transformPoints(matrix, vectors.data(), points.data(), vectorCount);
+        std::vector<Vector3> directions = vectors;
+        kernels->transformDirections(matrix, directions.data(), directions.data(), vectorCount);
+        bool isSame = isSameVectors(points, expectedPoints) && isSameVectors(directions, expectedDirections);
+        isEveryKernelSame &= isSame;
+        std::cout << " " << kernels->name << " " << (isSame ? "OK" : "MISMATCH");
+    }
+    std::cout << std::endl;
+
+    // Random rotations, scales and translations, which are well conditioned, against their error bounds
+    std::uniform_real_distribution<float> scale(0.5f, 2.0f);
+    float maxInverseError = 0.0f;
+    float maxRotationError = 0.0f;
+    for (int i = 0; i < 10000; ++i)
+    {
+        Quaternion p = MakeRandomRotation(rng);
+        Quaternion q = MakeRandomRotation(rng);
+        Vector3 vector(component(rng), component(rng), component(rng));
+        Matrix4x4 transform = Matrix4x4::Compose(vector, p, Vector3(scale(rng), scale(rng), scale(rng)));
+        Matrix4x4 inverse;
+        if (transform.Inverse(inverse) == false)
+        {
+            maxInverseError = std::numeric_limits<float>::infinity();
+            continue;
+        }
+        Matrix4x4 identity = transform * inverse;
+        for (size_t column = 0; column < 4; ++column)
+        {
+            for (size_t row = 0; row < 4; ++row)
+            {
+                float expected = (row == column) ? 1.0f : 0.0f;
+                maxInverseError = std::max(maxInverseError, std::abs(identity.Get(row, column) - expected));
+            }
+        }
+
+        Vector3 rotated = p.Rotate(q.Rotate(vector));
+        maxRotationError = std::max(maxRotationError, GetRelativeError((p * q).Rotate(vector), rotated));
+        maxRotationError = std::max(maxRotationError, GetRelativeError(Matrix4x4::Rotation(p * q).TransformPoint(vector), rotated));
+        maxRotationError = std::max(maxRotationError, GetRelativeError((Matrix4x4::Rotation(p) * Matrix4x4::Rotation(q)).TransformDirection(vector), rotated));
+    }
+    bool isAccurate = maxInverseError < 1e-4f && maxRotationError < 1e-5f;
+    std::cout << "    max error of M * M^-1 against identity " << maxInverseError << ", of composed rotations " << maxRotationError
+              << (isAccurate ? "" : " (INACCURATE)") << std::endl;
+
+    return mismatchCount == 0 && isEveryKernelSame && isAccurate;
+}
+
+
+// A row major 4x4 multiplied with three plain loops, standing in for converting to another matrix library
+struct PlainMatrix4x4
+{
+    float m[4][4];
+};
+
+static PlainMatrix4x4 PlainMultiply(const PlainMatrix4x4& _a, const PlainMatrix4x4& _b)
+{
+    PlainMatrix4x4 result = {};
+    for (int row = 0; row < 4; ++row)
+    {
+        for (int column = 0; column < 4; ++column)
+        {
+            for (int k = 0; k < 4; ++k)
+            {
+                result.m[row][column] += _a.m[row][k] * _b.m[k][column];
+            }
+        }
+    }
+    return result;
+}
+
+static ScalarVector3 PlainTransformPoint(const PlainMatrix4x4& _matrix, const ScalarVector3& _point)
+{
+    const float (&m)[4][4] = _matrix.m;
+    return { m[0][0] * _point.x + m[0][1] * _point.y + m[0][2] * _point.z + m[0][3],
+                m[1][0] * _point.x + m[1][1] * _point.y + m[1][2] * _point.z + m[1][3],
+                m[2][0] * _point.x + m[2][1] * _point.y + m[2][2] * _point.z + m[2][3] };
+}
+
+static PlainMatrix4x4 ToPlain(const Matrix4x4& _matrix)
+{
+    PlainMatrix4x4 result = {};
+    for (size_t row = 0; row < 4; ++row)
+    {
+        for (size_t column = 0; column < 4; ++column)
+        {
+            result.m[row][column] = _matrix.Get(row, column);
+        }
+    }
+    return result;
+}
+
+
+// @brief Checks Matrix4x4 and Quaternion's SSE paths and every transform kernel set bit for bit, and
+// inverses and rotations against their error bounds. Times multiply, inverse and compose, TransformPoints
+// in and out of cache against a loop of plain float transforms and memcpy, and TriangleList::Transform.
+// @return true if every check passed.
+bool RunMatrixTransformBenchmark()
+{
+    std::cout << "Matrix4x4 and Quaternion" << std::endl;
+    bool isOk = CheckTransforms();
+
+    // ~~~ Single operations ~~~
+    const size_t transformCount = 4096;
+    const int roundCount = 200;
+    std::mt19937 rng(1618);
+    std::uniform_real_distribution<float> component(-10.0f, 10.0f);
+    std::vector<Matrix4x4> matrices(transformCount);
+    std::vector<Quaternion> rotations(transformCount);
+    for (size_t i = 0; i < transformCount; ++i)
+    {
+        rotations[i] = MakeRandomRotation(rng);
+        matrices[i] = Matrix4x4::Compose(Vector3(component(rng), component(rng), component(rng)), rotations[i], Vector3(1.0f, 2.0f, 0.5f));
+    }
+    std::vector<PlainMatrix4x4> plainMatrices(transformCount);
+    std::transform(matrices.begin(), matrices.end(), plainMatrices.begin(), ToPlain);
+
+    auto time = [&](auto _run)
+    {
+        BenchmarkTimer timer;
+        for (int round = 0; round < roundCount; ++round)
+        {
+            _run();
+        }
+        return timer.GetElapsedNanoseconds() / ((double)transformCount * roundCount);
+    };
+    std::vector<Matrix4x4> matrixOut(transformCount);
+    std::vector<PlainMatrix4x4> plainOut(transformCount);
+    std::vector<Quaternion> rotationOut(transformCount);
+    double plainMultiply = time([&]() { for (size_t i = 0; i < transformCount; ++i) { plainOut[i] = PlainMultiply(plainMatrices[i], plainMatrices[(i + 1) % transformCount]); } DoNotOptimise(plainOut); });
+    double multiply = time([&]() { for (size_t i = 0; i < transformCount; ++i) { matrixOut[i] = matrices[i] * matrices[(i + 1) % transformCount]; } DoNotOptimise(matrixOut); });
+    double inverse = time([&]() { for (size_t i = 0; i < transformCount; ++i) { matrices[i].Inverse(matrixOut[i]); } DoNotOptimise(matrixOut); });
+    double compose = time([&]() { for (size_t i = 0; i < transformCount; ++i) { rotationOut[i] = rotations[i] * rotations[(i + 1) % transformCount]; } DoNotOptimise(rotationOut); });
+    std::cout << "    ns per multiply: plain loops " << plainMultiply << ", Matrix4x4 " << multiply
+              << "; ns per Matrix4x4 inverse " << inverse << ", Quaternion compose " << compose << std::endl;
+
+    // ~~~ Batched transforms ~~~
+    // GB/s read and written: 1K points stay in L1, 4M points (64 MB each way) come from memory
+    const TransformKernelSet kernelSets[] = { TRANSFORM_SCALAR_KERNELS, TRANSFORM_SSE2_KERNELS, TRANSFORM_AVX2_KERNELS };
+    const Matrix4x4& matrix = matrices[0];
+    const PlainMatrix4x4& plainMatrix = plainMatrices[0];
+    const std::pair<size_t, int> sizes[] = { { 1024, 20000 }, { 4u << 20, 5 } };
+    for (const auto& [pointCount, pointRoundCount] : sizes)
+    {
+        std::vector<Vector3> points(pointCount);
+        for (Vector3& point : points)
+        {
+            point = Vector3(component(rng), component(rng), component(rng));
+        }
+        std::vector<Vector3> transformed(pointCount);
+        std::vector<ScalarVector3> plainPoints(pointCount);
+        std::transform(points.begin(), points.end(), plainPoints.begin(), ToScalar);
+        std::vector<ScalarVector3> plainTransformed(pointCount);
+
+        // Plain floats move 12 bytes a point each way, Vector3 16
+        auto timePoints = [&](auto _run, size_t _bytesPerPoint = sizeof(Vector3))
+        {
+            BenchmarkTimer timer;
+            for (int round = 0; round < pointRoundCount; ++round)
+            {
+                _run();
+            }
+            return 2.0 * (double)(pointCount * _bytesPerPoint) * pointRoundCount / timer.GetElapsedNanoseconds();
+        };
+        std::cout << "    TransformPoints over " << pointCount << " points (GB/s): memcpy "
+                  << timePoints([&]() { std::memcpy(transformed.data(), points.data(), pointCount * sizeof(Vector3)); DoNotOptimise(transformed); })
+                  << ", plain floats " << timePoints([&]() { for (size_t i = 0; i < pointCount; ++i) { plainTransformed[i] = PlainTransformPoint(plainMatrix, plainPoints[i]); } DoNotOptimise(plainTransformed); }, sizeof(ScalarVector3))
+                  << ", TransformPoint " << timePoints([&]() { for (size_t i = 0; i < pointCount; ++i) { transformed[i] = matrix.TransformPoint(points[i]); } DoNotOptimise(transformed); });
+        for (TransformKernelSet kernelSet : kernelSets)
+        {
+            const TransformKernels* kernels = GetTransformKernels(kernelSet);
+            if (kernels != nullptr)
+            {
+                std::cout << ", " << kernels->name << " " << timePoints([&]() { kernels->transformPoints(matrix, points.data(), transformed.data(), pointCount); DoNotOptimise(transformed); });
+            }
+        }
+        std::cout << std::endl;
+    }
+
+    // ~~~ TriangleList ~~~
+    // A rotation there and back each round, so the vertices stay put however many rounds run
+    const size_t triangleCount = 1 << 20;
+    const int triangleRoundCount = 4;
+    TriangleList triangles;
+    for (size_t i = 0; i < triangleCount; ++i)
+    {
+        Vector3 v0(component(rng), component(rng), component(rng));
+        triangles.AddTriangle(v0, v0 + Vector3(1.0f, 0.0f, 0.0f), v0 + Vector3(0.0f, 1.0f, 0.0f), Color(), Color(), Color());
+    }
+    Matrix4x4 forward = Matrix4x4::Compose(Vector3(1.0f, 2.0f, 3.0f), rotations[1], Vector3(1.0f, 1.0f, 1.0f));
+    Matrix4x4 back;
+    forward.Inverse(back);
+    BenchmarkTimer timer;
+    for (int round = 0; round < triangleRoundCount; ++round)
+    {
+        triangles.Transform(forward);
+        triangles.Transform(back);
+    }
+    double triangleTransform = timer.GetElapsedNanoseconds() / ((double)triangleCount * triangleRoundCount * 2);
+    std::cout << "    TriangleList::Transform over " << triangleCount << " triangles: ns per triangle " << triangleTransform
+              << ", first normal after the round trips " << triangles.GetTriangle(0).faceNormal << std::endl;
+    return isOk;
+}
+
+
+// ~~~ Vector3 hashing and welding ~~~
+
+// @brief operator == as it was: each axis in turn, compared against EPSILON in double
+static bool LegacyIsEqual(const Vector3& _a, const Vector3& _b)
+{
+    return std::abs(_a.GetX() - _b.GetX()) < EPSILON && std::abs(_a.GetY() - _b.GetY()) < EPSILON && std::abs(_a.GetZ() - _b.GetZ()) < EPSILON;
+}
+
+// @brief The vertices of _size by _size quads on a wavy grid as a triangle soup: two triangles a quad,
+// so most vertices appear six times
+static std::vector<Vector3> MakeTriangleSoup(size_t _size)
+{
+    auto vertex = [](size_t _x, size_t _y) { return Vector3((float)_x * 0.1f, std::sin((float)(_x + _y) * 0.05f), (float)_y * 0.1f); };
+    std::vector<Vector3> soup;
+    soup.reserve(_size * _size * 6);
+    for (size_t y = 0; y < _size; ++y)
+    {
+        for (size_t x = 0; x < _size; ++x)
+        {
+            Vector3 corners[4] = { vertex(x, y), vertex(x + 1, y), vertex(x, y + 1), vertex(x + 1, y + 1) };
+            soup.insert(soup.end(), { corners[0], corners[2], corners[1], corners[1], corners[2], corners[3] });
+        }
+    }
+    return soup;
+}
+
+
+// @brief Checks operator == against the old double compare, welding against std::unordered_map, and
+// times both, with the weld over a million triangle triangle soup.
+// @return true if operator == agreed with the old compare everywhere and both welds gave the same indices.
+bool RunVector3WeldBenchmark()
+{
+    std::cout << "Vector3 hashing and welding" << std::endl;
+
+    // ~~~ operator == ~~~
+    // Differences around EPSILON, so the float and double compares have to agree right at the edge
+    const size_t pairCount = 1000000;
+    const int compareRoundCount = 20;
+    const float infinity = std::numeric_limits<float>::infinity();
+    std::mt19937 rng(4242);
+    std::uniform_real_distribution<float> component(-1.0f, 1.0f);
+    std::uniform_real_distribution<float> offset(-2e-7f, 2e-7f);
+    std::vector<Vector3> a(pairCount);
+    std::vector<Vector3> b(pairCount);
+    for (size_t i = 0; i < pairCount; ++i)
+    {
+        a[i] = Vector3(component(rng) * 1e-3f, component(rng) * 1e-3f, component(rng) * 1e-3f);
+        b[i] = a[i] + Vector3(offset(rng), offset(rng), offset(rng));
+    }
+    a[0] = Vector3(0.0f, 0.0f, 0.0f);
+    b[0] = Vector3(1e-7f, 0.0f, 0.0f);
+    b[1] = Vector3(std::nanf(""), a[1].GetY(), a[1].GetZ());
+    a[2] = Vector3(infinity, 0.0f, 0.0f);
+    b[2] = a[2];
+    a[3] = Vector3(-0.0f, 0.0f, 0.0f);
+    b[3] = Vector3(0.0f, -0.0f, 0.0f);
+
+    size_t mismatchCount = 0;
+    size_t equalCount = 0;
+    for (size_t i = 0; i < pairCount; ++i)
+    {
+        bool isEqual = (a[i] == b[i]);
+        mismatchCount += (isEqual == LegacyIsEqual(a[i], b[i])) ? 0 : 1;
+        equalCount += isEqual ? 1 : 0;
+    }
+
+    auto timeCompare = [&](auto _isEqual)
+    {
+        size_t count = 0;
+        BenchmarkTimer timer;
+        for (int round = 0; round < compareRoundCount; ++round)
+        {
+            for (size_t i = 0; i < pairCount; ++i)
+            {
+                count += _isEqual(a[i], b[(i + round) % pairCount]) ? 1 : 0;
+            }
+        }
+        DoNotOptimise(count);
+        return timer.GetElapsedNanoseconds() / ((double)pairCount * compareRoundCount);
+    };
+    double legacyCompare = timeCompare([](const Vector3& _a, const Vector3& _b) { return LegacyIsEqual(_a, _b); });
+    double compare = timeCompare([](const Vector3& _a, const Vector3& _b) { return _a == _b; });
+    std::cout << "    operator == against the old compare (" << equalCount << " of " << pairCount << " equal): "
+              << ((mismatchCount == 0) ? "OK" : "FAILED") << "; ns per compare: old " << legacyCompare << ", new " << compare << std::endl;
+
+    // ~~~ Welding ~~~
+    const float cellSize = 1e-4f;
+    std::vector<Vector3> soup = MakeTriangleSoup(724);
+    std::vector<Vector3> unique;
+    std::vector<uint32_t> indices;
+    BenchmarkTimer timer;
+    WeldVector3s(soup, cellSize, unique, indices);
+    double weld = timer.GetElapsedNanoseconds() / (double)soup.size();
+
+    // The same weld through std::unordered_map with the same hash and equality
+    timer.Restart();
+    std::unordered_map<Vector3, uint32_t, Vector3GridHash, Vector3GridEqual> cells(16, Vector3GridHash(cellSize), Vector3GridEqual(cellSize));
+    std::vector<Vector3> legacyUnique;
+    std::vector<uint32_t> legacyIndices(soup.size());
+    for (size_t i = 0; i < soup.size(); ++i)
+    {
+        auto [cell, isNew] = cells.emplace(soup[i], (uint32_t)legacyUnique.size());
+        if (isNew)
+        {
+            legacyUnique.push_back(soup[i]);
+        }
+        legacyIndices[i] = cell->second;
+    }
+    double legacyWeld = timer.GetElapsedNanoseconds() / (double)soup.size();
+
+    // Lookups of every soup vertex in a map that already holds them all
+    Vector3HashMap<uint32_t> map(cellSize);
+    for (size_t i = 0; i < unique.size(); ++i)
+    {
+        map.Insert(unique[i], (uint32_t)i);
+    }
+    size_t findMismatchCount = 0;
+    timer.Restart();
+    for (size_t i = 0; i < soup.size(); ++i)
+    {
+        const uint32_t* index = map.Find(soup[i]);
+        findMismatchCount += (index != nullptr && *index == indices[i]) ? 0 : 1;
+    }
+    double find = timer.GetElapsedNanoseconds() / (double)soup.size();
+    timer.Restart();
+    for (size_t i = 0; i < soup.size(); ++i)
+    {
+        auto cell = cells.find(soup[i]);
+        findMismatchCount += (cell != cells.end() && cell->second == indices[i]) ? 0 : 1;
+    }
+    double legacyFind = timer.GetElapsedNanoseconds() / (double)soup.size();
+
+    bool isSameWeld = unique.size() == legacyUnique.size() && indices == legacyIndices && findMismatchCount == 0;
+    Vector3GridEqual isSameCell(cellSize);
+    for (size_t i = 0; i < soup.size() && isSameWeld; ++i)
+    {
+        isSameWeld = isSameCell(unique[indices[i]], soup[i]);
+    }
+    std::cout << "    weld " << soup.size() << " soup vertices to " << unique.size() << ": " << (isSameWeld ? "OK" : "MISMATCH")
+              << "; ns per vertex std::unordered_map " << legacyWeld << ", Vector3HashMap " << weld
+              << "; ns per find " << legacyFind << ", " << find << std::endl;
+    return mismatchCount == 0 && isSameWeld;
+}
+
+
+// ~~~ TriangleList storage ~~~
+
+static bool IsSameTriangle(const Triangle& _a, const Triangle& _b)
+{
+    auto isSameVector = [](const Vector3& _x, const Vector3& _y)
+    {
+        return IsSameFloat(_x.GetX(), _y.GetX()) && IsSameFloat(_x.GetY(), _y.GetY()) && IsSameFloat(_x.GetZ(), _y.GetZ());
+    };
+    for (size_t corner = 0; corner < 3; ++corner)
+    {
+        const Color& a = _a.colors[corner];
+        const Color& b = _b.colors[corner];
+        if (isSameVector(_a.vertices[corner], _b.vertices[corner]) == false
+            || IsSameFloat(a.r, b.r) == false || IsSameFloat(a.g, b.g) == false || IsSameFloat(a.b, b.b) == false)
+        {
+            return false;
+        }
+    }
+    return isSameVector(_a.faceNormal, _b.faceNormal);
+}
+
+static bool IsSameTriangleList(const TriangleList& _a, const TriangleList& _b)
+{
+    if (_a.Count() != _b.Count())
+    {
+        return false;
+    }
+    for (size_t i = 0; i < _a.Count(); ++i)
+    {
+        if (IsSameTriangle(_a.GetTriangle(i), _b.GetTriangle(i)) == false)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// @brief Running bounds of the positions folded in so far, kept as plain floats so each fold is six minss
+// and maxss with nothing written back to memory
+struct TriangleBounds
+{
+    float min[3] = { std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity() };
+    float max[3] = { -std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity() };
+
+    void Grow(const Vector3& _position)
+    {
+        float position[3] = { _position.GetX(), _position.GetY(), _position.GetZ() };
+        for (size_t axis = 0; axis < 3; ++axis)
+        {
+            min[axis] = std::min(min[axis], position[axis]);
+            max[axis] = std::max(max[axis], position[axis]);
+        }
+    }
+
+    double GetChecksum() const
+    {
+        return (double)min[0] + min[1] + min[2] + max[0] + max[1] + max[2];
+    }
+};
+
+
+// @brief Checks that AoS and SoA TriangleLists hold the same triangles through building, Transform and
+// switching storage, then times bounds, back-face culling and Transform over a million triangles: AoS
+// through GetTriangle, SoA through GetTriangle, and SoA through its streams.
+// @return true if both storage modes gave the same triangles, bounds and culling counts.
+bool RunTriangleListStorageBenchmark()
+{
+    std::cout << "TriangleList storage" << std::endl;
+
+    const size_t triangleCount = 1 << 20;
+    const int roundCount = 8;
+    std::mt19937 rng(2025);
+    std::uniform_real_distribution<float> component(-100.0f, 100.0f);
+    std::uniform_real_distribution<float> edge(-1.0f, 1.0f);
+    std::uniform_real_distribution<float> shade(0.0f, 1.0f);
+    TriangleList aos(TRIANGLE_STORAGE_AOS);
+    TriangleList soa(TRIANGLE_STORAGE_SOA);
+    aos.Reserve(triangleCount);
+    soa.Reserve(triangleCount);
+    for (size_t i = 0; i < triangleCount; ++i)
+    {
+        Vector3 v0(component(rng), component(rng), component(rng));
+        Vector3 v1 = v0 + Vector3(edge(rng), edge(rng), edge(rng));
+        Vector3 v2 = v0 + Vector3(edge(rng), edge(rng), edge(rng));
+        Color c0(shade(rng), shade(rng), shade(rng));
+        Color c1(shade(rng), shade(rng), shade(rng));
+        Color c2(shade(rng), shade(rng), shade(rng));
+        aos.AddTriangle(v0, v1, v2, c0, c1, c2);
+        soa.AddTriangle(v0, v1, v2, c0, c1, c2);
+    }
+
+    // ~~~ Checks ~~~
+    bool isSameBuild = IsSameTriangleList(aos, soa);
+    Matrix4x4 forward = Matrix4x4::Compose(Vector3(1.0f, 2.0f, 3.0f), MakeRandomRotation(rng), Vector3(1.0f, 2.0f, 0.5f));
+    aos.Transform(forward);
+    soa.Transform(forward);
+    bool isSameTransform = IsSameTriangleList(aos, soa);
+    // A singular matrix takes the recalculated normal path
+    Matrix4x4 flatten = Matrix4x4::Scale(Vector3(1.0f, 1.0f, 0.0f));
+    TriangleList flatAoS = aos;
+    TriangleList flatSoA = soa;
+    flatAoS.Transform(flatten);
+    flatSoA.Transform(flatten);
+    isSameTransform = isSameTransform && IsSameTriangleList(flatAoS, flatSoA);
+    TriangleList converted = soa;
+    converted.SetStorage(TRIANGLE_STORAGE_AOS);
+    bool isSameConversion = converted.GetStorage() == TRIANGLE_STORAGE_AOS && IsSameTriangleList(converted, aos);
+    converted.SetStorage(TRIANGLE_STORAGE_SOA);
+    isSameConversion = isSameConversion && converted.GetStorage() == TRIANGLE_STORAGE_SOA && IsSameTriangleList(converted, soa);
+    bool isThrowing = false;
+    try
+    {
+        aos.GetPositions();
+    }
+    catch (const std::logic_error&)
+    {
+        isThrowing = true;
+    }
+    std::cout << "    same triangles after building " << (isSameBuild ? "OK" : "MISMATCH")
+              << ", Transform " << (isSameTransform ? "OK" : "MISMATCH")
+              << ", SetStorage " << (isSameConversion ? "OK" : "MISMATCH")
+              << "; AoS streams throw " << (isThrowing ? "OK" : "FAILED") << std::endl;
+
+    // ~~~ Passes ~~~
+    // Each pass gives a checksum, so the three ways of running it have to agree as well as being timed
+    auto time = [&](auto _pass, double& _checksum)
+    {
+        _checksum = _pass();
+        BenchmarkTimer timer;
+        for (int round = 0; round < roundCount; ++round)
+        {
+            DoNotOptimise(_pass());
+        }
+        return timer.GetElapsedNanoseconds() / ((double)triangleCount * roundCount);
+    };
+    const Vector3 camera(0.0f, 0.0f, -300.0f);
+    bool isSamePass = true;
+
+    auto boundsByTriangle = [&](const TriangleList& _list)
+    {
+        TriangleBounds bounds;
+        for (size_t i = 0; i < _list.Count(); ++i)
+        {
+            Triangle triangle = _list.GetTriangle(i);
+            for (const Vector3& vertex : triangle.vertices)
+            {
+                bounds.Grow(vertex);
+            }
+        }
+        return bounds.GetChecksum();
+    };
+    auto boundsByStream = [&]()
+    {
+        TriangleBounds bounds;
+        for (const Vector3& position : soa.GetPositions())
+        {
+            bounds.Grow(position);
+        }
+        return bounds.GetChecksum();
+    };
+    // Facing the camera when the normal points back along the line of sight to the first corner
+    auto cullByTriangle = [&](const TriangleList& _list)
+    {
+        size_t facingCount = 0;
+        for (size_t i = 0; i < _list.Count(); ++i)
+        {
+            Triangle triangle = _list.GetTriangle(i);
+            facingCount += (triangle.faceNormal.Dot(camera - triangle.vertices[0]) > 0.0f) ? 1 : 0;
+        }
+        return (double)facingCount;
+    };
+    auto cullByStream = [&]()
+    {
+        std::span<const Vector3> positions = soa.GetPositions();
+        std::span<const Vector3> normals = soa.GetFaceNormals();
+        size_t facingCount = 0;
+        for (size_t i = 0; i < normals.size(); ++i)
+        {
+            facingCount += (normals[i].Dot(camera - positions[i * 3]) > 0.0f) ? 1 : 0;
+        }
+        return (double)facingCount;
+    };
+
+    auto report = [&](const char* _name, auto _byAoS, auto _bySoA, auto _byStream)
+    {
+        double aosChecksum = 0.0;
+        double soaChecksum = 0.0;
+        double streamChecksum = 0.0;
+        double aosTime = time(_byAoS, aosChecksum);
+        double soaTime = time(_bySoA, soaChecksum);
+        double streamTime = time(_byStream, streamChecksum);
+        bool isSame = aosChecksum == soaChecksum && aosChecksum == streamChecksum;
+        isSamePass = isSamePass && isSame;
+        std::cout << "    " << _name << ": " << (isSame ? "OK" : "MISMATCH") << "; ns per triangle AoS GetTriangle " << aosTime
+                  << ", SoA GetTriangle " << soaTime << ", SoA streams " << streamTime << std::endl;
+    };
+    report("bounds", [&]() { return boundsByTriangle(aos); }, [&]() { return boundsByTriangle(soa); }, boundsByStream);
+    report("back-face cull", [&]() { return cullByTriangle(aos); }, [&]() { return cullByTriangle(soa); }, cullByStream);
+
+    // A rotation there and back each round, so the triangles stay put however many rounds run
+    Matrix4x4 back;
+    forward.Inverse(back);
+    auto timeTransform = [&](TriangleList& _list)
+    {
+        BenchmarkTimer timer;
+        for (int round = 0; round < roundCount; ++round)
+        {
+            _list.Transform(forward);
+            _list.Transform(back);
+        }
+        return timer.GetElapsedNanoseconds() / ((double)triangleCount * roundCount * 2);
+    };
+    double aosTransform = timeTransform(aos);
+    double soaTransform = timeTransform(soa);
+    bool isSameRoundTrip = IsSameTriangleList(aos, soa);
+    std::cout << "    Transform: " << (isSameRoundTrip ? "OK" : "MISMATCH") << "; ns per triangle AoS " << aosTransform << ", SoA " << soaTransform << std::endl;
+    std::cout << "    bytes per triangle AoS " << sizeof(Triangle) << ", SoA positions " << 3 * sizeof(Vector3)
+              << ", colours " << 3 * sizeof(Color) << ", face normal " << sizeof(Vector3) << std::endl;
+
+    return isSameBuild && isSameTransform && isSameConversion && isThrowing && isSamePass && isSameRoundTrip;
+}
+
+
+// @brief Runs every Vector3 benchmark in turn, carrying on past a failed check so every result is printed.
+// @return true if every benchmark that checks its results passed.
+bool RunVector3Benchmarks()
+{
+    bool isPassing = RunVector3BitCompatibilityTest();
+    RunVector3OperationBenchmark();
+    RunVectorCallBoundaryBenchmark();
+    isPassing &= RunVector3StreamBenchmark();
+    isPassing &= RunVector3FastNormaliseTest();
+    isPassing &= RunVectorDivisionBenchmark();
+    isPassing &= RunVectorExpressionBenchmark();
+    isPassing &= RunVectorDotBenchmark();
+    isPassing &= RunVectorAccessBenchmark();
+    isPassing &= RunVectorQuantizationBenchmark();
+    isPassing &= RunMatrixTransformBenchmark();
+    isPassing &= RunVector3WeldBenchmark();
+    isPassing &= RunTriangleListStorageBenchmark();
+    return isPassing;
+}
@@ -0,0 +1,33 @@
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//             Vector3 Hash Map (cpp)
+//             Author: Christopher A
+//             Date: October 16, 2026
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//  Description:
+//
+//		Vertex welding on Vector3HashMap. The map itself is a template and
+//      lives in Vector3HashMap.h.
+//
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include "Vector3HashMap.h"
+
+
+
+
+void WeldVector3s(std::span<const Vector3> _vectors, float _cellSize, std::vector<Vector3>& _outUnique, std::vector<uint32_t>& _outIndices)
+{
+    // Not reserved up front: meshes usually share each vertex between several triangles, so sizing for
+    // every vector being unique would allocate several times what is used
+    Vector3HashMap<uint32_t> cells(_cellSize);
+    _outUnique.clear();
+    _outIndices.resize(_vectors.size());
+    for (size_t i = 0; i < _vectors.size(); ++i)
+    {
+        auto [index, isNew] = cells.Insert(_vectors[i], (uint32_t)_outUnique.size());
+        if (isNew)
+        {
+            _outUnique.push_back(_vectors[i]);
+        }
+        _outIndices[i] = *index;
+    }
+}
@@ -0,0 +1,845 @@
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//             Vector3 Stream (cpp)
+//             Author: Christopher A
+//             Date: October 16, 2026
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//  Description:
+//
+//		Vector3Stream storage and the scalar, SSE2 and AVX2 stream kernels.
+//      The SIMD kernels take whole registers from the front of the stream and
+//      hand whatever is left over to the scalar kernel, so any count works.
+//
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include "CpuFeatures.h"
+#include "Vector3Stream.h"
+
+#ifdef CPU_FEATURES_X86
+#include <immintrin.h>
+#endif
+
+
+// ViewVector3s and ViewConstVector3s read the floats straight out of Vector3, which is only allowed while it stays a plain
+// array of floats
+static_assert(std::is_standard_layout_v<Vector3>, "Vector3 must stay standard layout to be viewed as floats");
+static_assert(sizeof(Vector3) % sizeof(float) == 0, "Vector3 must be a whole number of floats");
+
+static const size_t VECTOR3_FLOAT_STRIDE = sizeof(Vector3) / sizeof(float);
+static const std::align_val_t STREAM_ALIGNMENT = std::align_val_t(32);
+
+
+// ~~~ Views ~~~
+Vector3StreamView ViewVector3s(std::span<Vector3> _vectors)
+{
+    float* components = reinterpret_cast<float*>(_vectors.data());
+    return { components, components + 1, components + 2, _vectors.size(), VECTOR3_FLOAT_STRIDE };
+}
+
+ConstVector3StreamView ViewConstVector3s(std::span<const Vector3> _vectors)
+{
+    const float* components = reinterpret_cast<const float*>(_vectors.data());
+    return ConstVector3StreamView(components, components + 1, components + 2, _vectors.size(), VECTOR3_FLOAT_STRIDE);
+}
+
+static ConstVector3StreamView SkipVectors(const ConstVector3StreamView& _view, size_t _skipCount)
+{
+    size_t offset = _skipCount * _view.stride;
+    return ConstVector3StreamView(_view.x + offset, _view.y + offset, _view.z + offset, _view.count - _skipCount, _view.stride);
+}
+
+static Vector3StreamView SkipVectors(const Vector3StreamView& _view, size_t _skipCount)
+{
+    size_t offset = _skipCount * _view.stride;
+    return { _view.x + offset, _view.y + offset, _view.z + offset, _view.count - _skipCount, _view.stride };
+}
+
+
+
+// ~~~ Vector3Stream ~~~
+Vector3Stream::Vector3Stream(size_t _count)
+    : m_block(nullptr), m_count(0), m_paddedCount(0)
+{
+    Resize(_count);
+}
+
+Vector3Stream::Vector3Stream(std::span<const Vector3> _vectors)
+    : m_block(nullptr), m_count(0), m_paddedCount(0)
+{
+    Assign(_vectors);
+}
+
+Vector3Stream::~Vector3Stream()
+{
+    if (m_block != nullptr)
+    {
+        ::operator delete(m_block, STREAM_ALIGNMENT);
+    }
+}
+
+Vector3Stream::Vector3Stream(Vector3Stream&& _other) noexcept
+    : m_block(_other.m_block), m_count(_other.m_count), m_paddedCount(_other.m_paddedCount)
+{
+    _other.m_block = nullptr;
+    _other.m_count = 0;
+    _other.m_paddedCount = 0;
+}
+
+Vector3Stream& Vector3Stream::operator = (Vector3Stream&& _other) noexcept
+{
+    if (this != &_other)
+    {
+        std::swap(m_block, _other.m_block);
+        std::swap(m_count, _other.m_count);
+        std::swap(m_paddedCount, _other.m_paddedCount);
+    }
+    return *this;
+}
+
+size_t Vector3Stream::GetPaddedCount(size_t _count)
+{
+    return (_count + LANE_COUNT - 1) / LANE_COUNT * LANE_COUNT;
+}
+
+size_t Vector3Stream::GetCount() const
+{
+    return m_count;
+}
+
+void Vector3Stream::Resize(size_t _count)
+{
+    size_t paddedCount = GetPaddedCount(_count);
+    if (paddedCount > m_paddedCount)
+    {
+        // Zeroed up front so both the new vectors and the padding start out as 0
+        float* block = static_cast<float*>(::operator new(paddedCount * 3 * sizeof(float), STREAM_ALIGNMENT));
+        std::memset(block, 0, paddedCount * 3 * sizeof(float));
+        if (m_block != nullptr)
+        {
+            for (size_t axis = 0; axis < 3; ++axis)
+            {
+                std::memcpy(block + axis * paddedCount, m_block + axis * m_paddedCount, m_count * sizeof(float));
+            }
+            ::operator delete(m_block, STREAM_ALIGNMENT);
+        }
+        m_block = block;
+        m_paddedCount = paddedCount;
+    }
+    else if (_count < m_count)
+    {
+        // Dropped vectors become padding, which has to read as 0
+        for (size_t axis = 0; axis < 3; ++axis)
+        {
+            std::memset(m_block + axis * m_paddedCount + _count, 0, (m_count - _count) * sizeof(float));
+        }
+    }
+    m_count = _count;
+}
+
+Vector3 Vector3Stream::Get(size_t _index) const
+{
+    return Vector3(GetX()[_index], GetY()[_index], GetZ()[_index]);
+}
+
+void Vector3Stream::Set(size_t _index, const Vector3& _vector)
+{
+    GetX()[_index] = _vector.GetX();
+    GetY()[_index] = _vector.GetY();
+    GetZ()[_index] = _vector.GetZ();
+}
+
+float* Vector3Stream::GetX() { return m_block; }
+float* Vector3Stream::GetY() { return m_block + m_paddedCount; }
+float* Vector3Stream::GetZ() { return m_block + m_paddedCount * 2; }
+const float* Vector3Stream::GetX() const { return m_block; }
+const float* Vector3Stream::GetY() const { return m_block + m_paddedCount; }
+const float* Vector3Stream::GetZ() const { return m_block + m_paddedCount * 2; }
+
+Vector3StreamView Vector3Stream::GetView()
+{
+    return { GetX(), GetY(), GetZ(), m_count, 1 };
+}
+
+ConstVector3StreamView Vector3Stream::GetView() const
+{
+    return ConstVector3StreamView(GetX(), GetY(), GetZ(), m_count, 1);
+}
+
+void Vector3Stream::Assign(std::span<const Vector3> _vectors)
+{
+    Resize(_vectors.size());
+    float* x = GetX();
+    float* y = GetY();
+    float* z = GetZ();
+    size_t i = 0;
+
+#if VECTOR3_ENABLE_SIMD
+    // SIMD Vector3 is an aligned xyzw, so four of them are a 4x4 matrix to transpose into x, y, z (and w) rows
+    const float* components = reinterpret_cast<const float*>(_vectors.data());
+    for (; i + 4 <= _vectors.size(); i += 4)
+    {
+        __m128 row0 = _mm_load_ps(components + i * 4);
+        __m128 row1 = _mm_load_ps(components + i * 4 + 4);
+        __m128 row2 = _mm_load_ps(components + i * 4 + 8);
+        __m128 row3 = _mm_load_ps(components + i * 4 + 12);
+        _MM_TRANSPOSE4_PS(row0, row1, row2, row3);
+        _mm_storeu_ps(x + i, row0);
+        _mm_storeu_ps(y + i, row1);
+        _mm_storeu_ps(z + i, row2);
+    }
+#endif
+
+    for (; i < _vectors.size(); ++i)
+    {
+        x[i] = _vectors[i].GetX();
+        y[i] = _vectors[i].GetY();
+        z[i] = _vectors[i].GetZ();
+    }
+}
+
+size_t Vector3Stream::CopyTo(std::span<Vector3> _outVectors) const
+{
+    size_t count = std::min(m_count, _outVectors.size());
+    const float* x = GetX();
+    const float* y = GetY();
+    const float* z = GetZ();
+    size_t i = 0;
+
+#if VECTOR3_ENABLE_SIMD
+    // The same transpose backwards. The fourth row is zero, which keeps every w at 0.
+    float* components = reinterpret_cast<float*>(_outVectors.data());
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 row0 = _mm_loadu_ps(x + i);
+        __m128 row1 = _mm_loadu_ps(y + i);
+        __m128 row2 = _mm_loadu_ps(z + i);
+        __m128 row3 = _mm_setzero_ps();
+        _MM_TRANSPOSE4_PS(row0, row1, row2, row3);
+        _mm_store_ps(components + i * 4, row0);
+        _mm_store_ps(components + i * 4 + 4, row1);
+        _mm_store_ps(components + i * 4 + 8, row2);
+        _mm_store_ps(components + i * 4 + 12, row3);
+    }
+#endif
+
+    for (; i < count; ++i)
+    {
+        _outVectors[i] = Vector3(x[i], y[i], z[i]);
+    }
+    return count;
+}
+
+std::vector<Vector3> Vector3Stream::ToVector3s() const
+{
+    std::vector<Vector3> vectors(m_count);
+    CopyTo(vectors);
+    return vectors;
+}
+
+
+
+// ~~~ Scalar kernels ~~~
+// The same formulas as the scalar Vector3 operators, element by element. Every component is read
+// before any is written so the output can be an input.
+
+static void AddScalar(ConstVector3StreamView _a, ConstVector3StreamView _b, Vector3StreamView _out)
+{
+    for (size_t i = 0; i < _a.count; ++i)
+    {
+        size_t a = i * _a.stride;
+        size_t b = i * _b.stride;
+        size_t o = i * _out.stride;
+        float x = _a.x[a] + _b.x[b];
+        float y = _a.y[a] + _b.y[b];
+        float z = _a.z[a] + _b.z[b];
+        _out.x[o] = x;
+        _out.y[o] = y;
+        _out.z[o] = z;
+    }
+}
+
+static void ScaleScalar(ConstVector3StreamView _a, float _scalar, Vector3StreamView _out)
+{
+    for (size_t i = 0; i < _a.count; ++i)
+    {
+        size_t a = i * _a.stride;
+        size_t o = i * _out.stride;
+        float x = _a.x[a] * _scalar;
+        float y = _a.y[a] * _scalar;
+        float z = _a.z[a] * _scalar;
+        _out.x[o] = x;
+        _out.y[o] = y;
+        _out.z[o] = z;
+    }
+}
+
+static void DotScalar(ConstVector3StreamView _a, ConstVector3StreamView _b, float* _outDots)
+{
+    for (size_t i = 0; i < _a.count; ++i)
+    {
+        size_t a = i * _a.stride;
+        size_t b = i * _b.stride;
+        _outDots[i] = _a.x[a] * _b.x[b] + _a.y[a] * _b.y[b] + _a.z[a] * _b.z[b];
+    }
+}
+
+static void CrossScalar(ConstVector3StreamView _a, ConstVector3StreamView _b, Vector3StreamView _out)
+{
+    for (size_t i = 0; i < _a.count; ++i)
+    {
+        size_t a = i * _a.stride;
+        size_t b = i * _b.stride;
+        size_t o = i * _out.stride;
+        float x = _a.y[a] * _b.z[b] - _a.z[a] * _b.y[b];
+        float y = _a.z[a] * _b.x[b] - _a.x[a] * _b.z[b];
+        float z = _a.x[a] * _b.y[b] - _a.y[a] * _b.x[b];
+        _out.x[o] = x;
+        _out.y[o] = y;
+        _out.z[o] = z;
+    }
+}
+
+static void NormaliseScalar(ConstVector3StreamView _a, Vector3StreamView _out)
+{
+    for (size_t i = 0; i < _a.count; ++i)
+    {
+        size_t a = i * _a.stride;
+        size_t o = i * _out.stride;
+        float x = _a.x[a];
+        float y = _a.y[a];
+        float z = _a.z[a];
+        float magnitude = std::sqrt(x * x + y * y + z * z);
+        if (std::abs(magnitude) < EPSILON)
+        {
+            x = y = z = 0.0f;
+        }
+        else
+        {
+            x /= magnitude;
+            y /= magnitude;
+            z /= magnitude;
+        }
+        _out.x[o] = x;
+        _out.y[o] = y;
+        _out.z[o] = z;
+    }
+}
+
+static void NormaliseFastScalar(ConstVector3StreamView _a, Vector3StreamView _out)
+{
+    for (size_t i = 0; i < _a.count; ++i)
+    {
+        size_t a = i * _a.stride;
+        size_t o = i * _out.stride;
+        float x = _a.x[a];
+        float y = _a.y[a];
+        float z = _a.z[a];
+        float magnitudeSqr = x * x + y * y + z * z;
+        float inverseMagnitude = (magnitudeSqr < FAST_NORMALISE_MIN_MAGNITUDE_SQR) ? 0.0f : ApproximateReciprocalSqrt(magnitudeSqr);
+        _out.x[o] = x * inverseMagnitude;
+        _out.y[o] = y * inverseMagnitude;
+        _out.z[o] = z * inverseMagnitude;
+    }
+}
+
+static void LengthScalar(ConstVector3StreamView _a, float* _outLengths)
+{
+    for (size_t i = 0; i < _a.count; ++i)
+    {
+        size_t a = i * _a.stride;
+        _outLengths[i] = std::sqrt(_a.x[a] * _a.x[a] + _a.y[a] * _a.y[a] + _a.z[a] * _a.z[a]);
+    }
+}
+
+// @brief Folds _a into the running min and max. (v < min) ? v : min is exactly what minps does, NaNs included.
+static void AccumulateBoundsScalar(ConstVector3StreamView _a, float* _min, float* _max)
+{
+    for (size_t i = 0; i < _a.count; ++i)
+    {
+        size_t a = i * _a.stride;
+        const float components[3] = { _a.x[a], _a.y[a], _a.z[a] };
+        for (size_t axis = 0; axis < 3; ++axis)
+        {
+            _min[axis] = (components[axis] < _min[axis]) ? components[axis] : _min[axis];
+            _max[axis] = (components[axis] > _max[axis]) ? components[axis] : _max[axis];
+        }
+    }
+}
+
+static bool BoundsScalar(ConstVector3StreamView _a, Vector3& _outMin, Vector3& _outMax)
+{
+    if (_a.count == 0)
+    {
+        return false;
+    }
+
+    float min[3] = { _a.x[0], _a.y[0], _a.z[0] };
+    float max[3] = { _a.x[0], _a.y[0], _a.z[0] };
+    AccumulateBoundsScalar(SkipVectors(_a, 1), min, max);
+    _outMin = Vector3(min[0], min[1], min[2]);
+    _outMax = Vector3(max[0], max[1], max[2]);
+    return true;
+}
+
+
+
+#ifdef CPU_FEATURES_X86
+// magnitude < this is the same test as the double compare magnitude < EPSILON that Vector3::Normalised makes
+static const float NORMALISE_THRESHOLD = GetEpsilonAsFloat();
+
+
+// ~~~ SSE2 kernels ~~~
+static void AddSSE2(ConstVector3StreamView _a, ConstVector3StreamView _b, Vector3StreamView _out)
+{
+    size_t i = 0;
+    for (; i + 4 <= _a.count; i += 4)
+    {
+        __m128 x = _mm_add_ps(_mm_loadu_ps(_a.x + i), _mm_loadu_ps(_b.x + i));
+        __m128 y = _mm_add_ps(_mm_loadu_ps(_a.y + i), _mm_loadu_ps(_b.y + i));
+        __m128 z = _mm_add_ps(_mm_loadu_ps(_a.z + i), _mm_loadu_ps(_b.z + i));
+        _mm_storeu_ps(_out.x + i, x);
+        _mm_storeu_ps(_out.y + i, y);
+        _mm_storeu_ps(_out.z + i, z);
+    }
+    AddScalar(SkipVectors(_a, i), SkipVectors(_b, i), SkipVectors(_out, i));
+}
+
+static void ScaleSSE2(ConstVector3StreamView _a, float _scalar, Vector3StreamView _out)
+{
+    const __m128 scalar = _mm_set1_ps(_scalar);
+    size_t i = 0;
+    for (; i + 4 <= _a.count; i += 4)
+    {
+        __m128 x = _mm_mul_ps(_mm_loadu_ps(_a.x + i), scalar);
+        __m128 y = _mm_mul_ps(_mm_loadu_ps(_a.y + i), scalar);
+        __m128 z = _mm_mul_ps(_mm_loadu_ps(_a.z + i), scalar);
+        _mm_storeu_ps(_out.x + i, x);
+        _mm_storeu_ps(_out.y + i, y);
+        _mm_storeu_ps(_out.z + i, z);
+    }
+    ScaleScalar(SkipVectors(_a, i), _scalar, SkipVectors(_out, i));
+}
+
+// @brief (ax * bx + ay * by) + az * bz, in the same order as Vector3::Dot
+static inline __m128 DotSSE2(__m128 _ax, __m128 _ay, __m128 _az, __m128 _bx, __m128 _by, __m128 _bz)
+{
+    return _mm_add_ps(_mm_add_ps(_mm_mul_ps(_ax, _bx), _mm_mul_ps(_ay, _by)), _mm_mul_ps(_az, _bz));
+}
+
+static void DotSSE2(ConstVector3StreamView _a, ConstVector3StreamView _b, float* _outDots)
+{
+    size_t i = 0;
+    for (; i + 4 <= _a.count; i += 4)
+    {
+        __m128 dots = DotSSE2(_mm_loadu_ps(_a.x + i), _mm_loadu_ps(_a.y + i), _mm_loadu_ps(_a.z + i),
+                              _mm_loadu_ps(_b.x + i), _mm_loadu_ps(_b.y + i), _mm_loadu_ps(_b.z + i));
+        _mm_storeu_ps(_outDots + i, dots);
+    }
+    DotScalar(SkipVectors(_a, i), SkipVectors(_b, i), _outDots + i);
+}
+
+static void CrossSSE2(ConstVector3StreamView _a, ConstVector3StreamView _b, Vector3StreamView _out)
+{
+    size_t i = 0;
+    for (; i + 4 <= _a.count; i += 4)
+    {
+        __m128 ax = _mm_loadu_ps(_a.x + i);
+        __m128 ay = _mm_loadu_ps(_a.y + i);
+        __m128 az = _mm_loadu_ps(_a.z + i);
+        __m128 bx = _mm_loadu_ps(_b.x + i);
+        __m128 by = _mm_loadu_ps(_b.y + i);
+        __m128 bz = _mm_loadu_ps(_b.z + i);
+        _mm_storeu_ps(_out.x + i, _mm_sub_ps(_mm_mul_ps(ay, bz), _mm_mul_ps(az, by)));
+        _mm_storeu_ps(_out.y + i, _mm_sub_ps(_mm_mul_ps(az, bx), _mm_mul_ps(ax, bz)));
+        _mm_storeu_ps(_out.z + i, _mm_sub_ps(_mm_mul_ps(ax, by), _mm_mul_ps(ay, bx)));
+    }
+    CrossScalar(SkipVectors(_a, i), SkipVectors(_b, i), SkipVectors(_out, i));
+}
+
+static void NormaliseSSE2(ConstVector3StreamView _a, Vector3StreamView _out)
+{
+    const __m128 threshold = _mm_set1_ps(NORMALISE_THRESHOLD);
+    size_t i = 0;
+    for (; i + 4 <= _a.count; i += 4)
+    {
+        __m128 x = _mm_loadu_ps(_a.x + i);
+        __m128 y = _mm_loadu_ps(_a.y + i);
+        __m128 z = _mm_loadu_ps(_a.z + i);
+        __m128 magnitude = _mm_sqrt_ps(DotSSE2(x, y, z, x, y, z));
+
+        // Too short lanes divide by ~0 like the rest, then get masked to +0
+        __m128 tooShort = _mm_cmplt_ps(magnitude, threshold);
+        _mm_storeu_ps(_out.x + i, _mm_andnot_ps(tooShort, _mm_div_ps(x, magnitude)));
+        _mm_storeu_ps(_out.y + i, _mm_andnot_ps(tooShort, _mm_div_ps(y, magnitude)));
+        _mm_storeu_ps(_out.z + i, _mm_andnot_ps(tooShort, _mm_div_ps(z, magnitude)));
+    }
+    NormaliseScalar(SkipVectors(_a, i), SkipVectors(_out, i));
+}
+
+// @brief rsqrtps plus one Newton-Raphson step, zeroed where _magnitudeSqr is too short to normalise
+static inline __m128 ReciprocalMagnitudeSSE2(__m128 _magnitudeSqr)
+{
+    __m128 estimate = _mm_rsqrt_ps(_magnitudeSqr);
+    __m128 halfMagnitudeSqr = _mm_mul_ps(_mm_set1_ps(0.5f), _magnitudeSqr);
+    estimate = _mm_mul_ps(estimate, _mm_sub_ps(_mm_set1_ps(1.5f), _mm_mul_ps(halfMagnitudeSqr, _mm_mul_ps(estimate, estimate))));
+    return _mm_and_ps(estimate, _mm_cmpge_ps(_magnitudeSqr, _mm_set1_ps(FAST_NORMALISE_MIN_MAGNITUDE_SQR)));
+}
+
+static void NormaliseFastSSE2(ConstVector3StreamView _a, Vector3StreamView _out)
+{
+    size_t i = 0;
+    for (; i + 4 <= _a.count; i += 4)
+    {
+        __m128 x = _mm_loadu_ps(_a.x + i);
+        __m128 y = _mm_loadu_ps(_a.y + i);
+        __m128 z = _mm_loadu_ps(_a.z + i);
+        __m128 inverseMagnitude = ReciprocalMagnitudeSSE2(DotSSE2(x, y, z, x, y, z));
+        _mm_storeu_ps(_out.x + i, _mm_mul_ps(x, inverseMagnitude));
+        _mm_storeu_ps(_out.y + i, _mm_mul_ps(y, inverseMagnitude));
+        _mm_storeu_ps(_out.z + i, _mm_mul_ps(z, inverseMagnitude));
+    }
+    NormaliseFastScalar(SkipVectors(_a, i), SkipVectors(_out, i));
+}
+
+static void LengthSSE2(ConstVector3StreamView _a, float* _outLengths)
+{
+    size_t i = 0;
+    for (; i + 4 <= _a.count; i += 4)
+    {
+        __m128 x = _mm_loadu_ps(_a.x + i);
+        __m128 y = _mm_loadu_ps(_a.y + i);
+        __m128 z = _mm_loadu_ps(_a.z + i);
+        _mm_storeu_ps(_outLengths + i, _mm_sqrt_ps(DotSSE2(x, y, z, x, y, z)));
+    }
+    LengthScalar(SkipVectors(_a, i), _outLengths + i);
+}
+
+static bool BoundsSSE2(ConstVector3StreamView _a, Vector3& _outMin, Vector3& _outMax)
+{
+    if (_a.count < 4)
+    {
+        return BoundsScalar(_a, _outMin, _outMax);
+    }
+
+    __m128 minX = _mm_loadu_ps(_a.x);
+    __m128 minY = _mm_loadu_ps(_a.y);
+    __m128 minZ = _mm_loadu_ps(_a.z);
+    __m128 maxX = minX;
+    __m128 maxY = minY;
+    __m128 maxZ = minZ;
+    size_t i = 4;
+    for (; i + 4 <= _a.count; i += 4)
+    {
+        __m128 x = _mm_loadu_ps(_a.x + i);
+        __m128 y = _mm_loadu_ps(_a.y + i);
+        __m128 z = _mm_loadu_ps(_a.z + i);
+        minX = _mm_min_ps(x, minX);
+        minY = _mm_min_ps(y, minY);
+        minZ = _mm_min_ps(z, minZ);
+        maxX = _mm_max_ps(x, maxX);
+        maxY = _mm_max_ps(y, maxY);
+        maxZ = _mm_max_ps(z, maxZ);
+    }
+
+    // Fold the lanes together, then the tail
+    alignas(16) float lanes[6][4];
+    _mm_store_ps(lanes[0], minX);
+    _mm_store_ps(lanes[1], minY);
+    _mm_store_ps(lanes[2], minZ);
+    _mm_store_ps(lanes[3], maxX);
+    _mm_store_ps(lanes[4], maxY);
+    _mm_store_ps(lanes[5], maxZ);
+    float min[3] = { lanes[0][0], lanes[1][0], lanes[2][0] };
+    float max[3] = { lanes[3][0], lanes[4][0], lanes[5][0] };
+    for (size_t lane = 1; lane < 4; ++lane)
+    {
+        for (size_t axis = 0; axis < 3; ++axis)
+        {
+            min[axis] = (lanes[axis][lane] < min[axis]) ? lanes[axis][lane] : min[axis];
+            max[axis] = (lanes[axis + 3][lane] > max[axis]) ? lanes[axis + 3][lane] : max[axis];
+        }
+    }
+    AccumulateBoundsScalar(SkipVectors(_a, i), min, max);
+
+    _outMin = Vector3(min[0], min[1], min[2]);
+    _outMax = Vector3(max[0], max[1], max[2]);
+    return true;
+}
+
+
+
+// ~~~ AVX2 kernels ~~~
+// Line for line the SSE2 kernels, eight lanes wide. Only AVX instructions are needed, and no FMA, so
+// the rounding stays the same as Vector3's.
+
+CPU_TARGET_AVX2
+static void AddAVX2(ConstVector3StreamView _a, ConstVector3StreamView _b, Vector3StreamView _out)
+{
+    size_t i = 0;
+    for (; i + 8 <= _a.count; i += 8)
+    {
+        __m256 x = _mm256_add_ps(_mm256_loadu_ps(_a.x + i), _mm256_loadu_ps(_b.x + i));
+        __m256 y = _mm256_add_ps(_mm256_loadu_ps(_a.y + i), _mm256_loadu_ps(_b.y + i));
+        __m256 z = _mm256_add_ps(_mm256_loadu_ps(_a.z + i), _mm256_loadu_ps(_b.z + i));
+        _mm256_storeu_ps(_out.x + i, x);
+        _mm256_storeu_ps(_out.y + i, y);
+        _mm256_storeu_ps(_out.z + i, z);
+    }
+    AddScalar(SkipVectors(_a, i), SkipVectors(_b, i), SkipVectors(_out, i));
+}
+
+CPU_TARGET_AVX2
+static void ScaleAVX2(ConstVector3StreamView _a, float _scalar, Vector3StreamView _out)
+{
+    const __m256 scalar = _mm256_set1_ps(_scalar);
+    size_t i = 0;
+    for (; i + 8 <= _a.count; i += 8)
+    {
+        __m256 x = _mm256_mul_ps(_mm256_loadu_ps(_a.x + i), scalar);
+        __m256 y = _mm256_mul_ps(_mm256_loadu_ps(_a.y + i), scalar);
+        __m256 z = _mm256_mul_ps(_mm256_loadu_ps(_a.z + i), scalar);
+        _mm256_storeu_ps(_out.x + i, x);
+        _mm256_storeu_ps(_out.y + i, y);
+        _mm256_storeu_ps(_out.z + i, z);
+    }
+    ScaleScalar(SkipVectors(_a, i), _scalar, SkipVectors(_out, i));
+}
+
+CPU_TARGET_AVX2
+static inline __m256 DotAVX2(__m256 _ax, __m256 _ay, __m256 _az, __m256 _bx, __m256 _by, __m256 _bz)
+{
+    return _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(_ax, _bx), _mm256_mul_ps(_ay, _by)), _mm256_mul_ps(_az, _bz));
+}
+
+CPU_TARGET_AVX2
+static void DotAVX2(ConstVector3StreamView _a, ConstVector3StreamView _b, float* _outDots)
+{
+    size_t i = 0;
+    for (; i + 8 <= _a.count; i += 8)
+    {
+        __m256 dots = DotAVX2(_mm256_loadu_ps(_a.x + i), _mm256_loadu_ps(_a.y + i), _mm256_loadu_ps(_a.z + i),
+                              _mm256_loadu_ps(_b.x + i), _mm256_loadu_ps(_b.y + i), _mm256_loadu_ps(_b.z + i));
+        _mm256_storeu_ps(_outDots + i, dots);
+    }
+    DotScalar(SkipVectors(_a, i), SkipVectors(_b, i), _outDots + i);
+}
+
+CPU_TARGET_AVX2
+static void CrossAVX2(ConstVector3StreamView _a, ConstVector3StreamView _b, Vector3StreamView _out)
+{
+    size_t i = 0;
+    for (; i + 8 <= _a.count; i += 8)
+    {
+        __m256 ax = _mm256_loadu_ps(_a.x + i);
+        __m256 ay = _mm256_loadu_ps(_a.y + i);
+        __m256 az = _mm256_loadu_ps(_a.z + i);
+        __m256 bx = _mm256_loadu_ps(_b.x + i);
+        __m256 by = _mm256_loadu_ps(_b.y + i);
+        __m256 bz = _mm256_loadu_ps(_b.z + i);
+        _mm256_storeu_ps(_out.x + i, _mm256_sub_ps(_mm256_mul_ps(ay, bz), _mm256_mul_ps(az, by)));
+        _mm256_storeu_ps(_out.y + i, _mm256_sub_ps(_mm256_mul_ps(az, bx), _mm256_mul_ps(ax, bz)));
+        _mm256_storeu_ps(_out.z + i, _mm256_sub_ps(_mm256_mul_ps(ax, by), _mm256_mul_ps(ay, bx)));
+    }
+    CrossScalar(SkipVectors(_a, i), SkipVectors(_b, i), SkipVectors(_out, i));
+}
+
+CPU_TARGET_AVX2
+static void NormaliseAVX2(ConstVector3StreamView _a, Vector3StreamView _out)
+{
+    const __m256 threshold = _mm256_set1_ps(NORMALISE_THRESHOLD);
+    size_t i = 0;
+    for (; i + 8 <= _a.count; i += 8)
+    {
+        __m256 x = _mm256_loadu_ps(_a.x + i);
+        __m256 y = _mm256_loadu_ps(_a.y + i);
+        __m256 z = _mm256_loadu_ps(_a.z + i);
+        __m256 magnitude = _mm256_sqrt_ps(DotAVX2(x, y, z, x, y, z));
+        __m256 tooShort = _mm256_cmp_ps(magnitude, threshold, _CMP_LT_OQ);
+        _mm256_storeu_ps(_out.x + i, _mm256_andnot_ps(tooShort, _mm256_div_ps(x, magnitude)));
+        _mm256_storeu_ps(_out.y + i, _mm256_andnot_ps(tooShort, _mm256_div_ps(y, magnitude)));
+        _mm256_storeu_ps(_out.z + i, _mm256_andnot_ps(tooShort, _mm256_div_ps(z, magnitude)));
+    }
+    NormaliseScalar(SkipVectors(_a, i), SkipVectors(_out, i));
+}
+
+CPU_TARGET_AVX2
+static inline __m256 ReciprocalMagnitudeAVX2(__m256 _magnitudeSqr)
+{
+    __m256 estimate = _mm256_rsqrt_ps(_magnitudeSqr);
+    __m256 halfMagnitudeSqr = _mm256_mul_ps(_mm256_set1_ps(0.5f), _magnitudeSqr);
+    estimate = _mm256_mul_ps(estimate, _mm256_sub_ps(_mm256_set1_ps(1.5f), _mm256_mul_ps(halfMagnitudeSqr, _mm256_mul_ps(estimate, estimate))));
+    return _mm256_and_ps(estimate, _mm256_cmp_ps(_magnitudeSqr, _mm256_set1_ps(FAST_NORMALISE_MIN_MAGNITUDE_SQR), _CMP_GE_OQ));
+}
+
+CPU_TARGET_AVX2
+static void NormaliseFastAVX2(ConstVector3StreamView _a, Vector3StreamView _out)
+{
+    size_t i = 0;
+    for (; i + 8 <= _a.count; i += 8)
+    {
+        __m256 x = _mm256_loadu_ps(_a.x + i);
+        __m256 y = _mm256_loadu_ps(_a.y + i);
+        __m256 z = _mm256_loadu_ps(_a.z + i);
+        __m256 inverseMagnitude = ReciprocalMagnitudeAVX2(DotAVX2(x, y, z, x, y, z));
+        _mm256_storeu_ps(_out.x + i, _mm256_mul_ps(x, inverseMagnitude));
+        _mm256_storeu_ps(_out.y + i, _mm256_mul_ps(y, inverseMagnitude));
+        _mm256_storeu_ps(_out.z + i, _mm256_mul_ps(z, inverseMagnitude));
+    }
+    NormaliseFastScalar(SkipVectors(_a, i), SkipVectors(_out, i));
+}
+
+CPU_TARGET_AVX2
+static void LengthAVX2(ConstVector3StreamView _a, float* _outLengths)
+{
+    size_t i = 0;
+    for (; i + 8 <= _a.count; i += 8)
+    {
+        __m256 x = _mm256_loadu_ps(_a.x + i);
+        __m256 y = _mm256_loadu_ps(_a.y + i);
+        __m256 z = _mm256_loadu_ps(_a.z + i);
+        _mm256_storeu_ps(_outLengths + i, _mm256_sqrt_ps(DotAVX2(x, y, z, x, y, z)));
+    }
+    LengthScalar(SkipVectors(_a, i), _outLengths + i);
+}
+
+CPU_TARGET_AVX2
+static bool BoundsAVX2(ConstVector3StreamView _a, Vector3& _outMin, Vector3& _outMax)
+{
+    if (_a.count < 8)
+    {
+        return BoundsScalar(_a, _outMin, _outMax);
+    }
+
+    __m256 minX = _mm256_loadu_ps(_a.x);
+    __m256 minY = _mm256_loadu_ps(_a.y);
+    __m256 minZ = _mm256_loadu_ps(_a.z);
+    __m256 maxX = minX;
+    __m256 maxY = minY;
+    __m256 maxZ = minZ;
+    size_t i = 8;
+    for (; i + 8 <= _a.count; i += 8)
+    {
+        __m256 x = _mm256_loadu_ps(_a.x + i);
+        __m256 y = _mm256_loadu_ps(_a.y + i);
+        __m256 z = _mm256_loadu_ps(_a.z + i);
+        minX = _mm256_min_ps(x, minX);
+        minY = _mm256_min_ps(y, minY);
+        minZ = _mm256_min_ps(z, minZ);
+        maxX = _mm256_max_ps(x, maxX);
+        maxY = _mm256_max_ps(y, maxY);
+        maxZ = _mm256_max_ps(z, maxZ);
+    }
+
+    alignas(32) float lanes[6][8];
+    _mm256_store_ps(lanes[0], minX);
+    _mm256_store_ps(lanes[1], minY);
+    _mm256_store_ps(lanes[2], minZ);
+    _mm256_store_ps(lanes[3], maxX);
+    _mm256_store_ps(lanes[4], maxY);
+    _mm256_store_ps(lanes[5], maxZ);
+    float min[3] = { lanes[0][0], lanes[1][0], lanes[2][0] };
+    float max[3] = { lanes[3][0], lanes[4][0], lanes[5][0] };
+    for (size_t lane = 1; lane < 8; ++lane)
+    {
+        for (size_t axis = 0; axis < 3; ++axis)
+        {
+            min[axis] = (lanes[axis][lane] < min[axis]) ? lanes[axis][lane] : min[axis];
+            max[axis] = (lanes[axis + 3][lane] > max[axis]) ? lanes[axis + 3][lane] : max[axis];
+        }
+    }
+    AccumulateBoundsScalar(SkipVectors(_a, i), min, max);
+
+    _outMin = Vector3(min[0], min[1], min[2]);
+    _outMax = Vector3(max[0], max[1], max[2]);
+    return true;
+}
+#endif
+
+
+
+// ~~~ Dispatch ~~~
+static const Vector3StreamKernels SCALAR_STREAM_KERNELS = { "Scalar", &AddScalar, &ScaleScalar, &DotScalar, &CrossScalar, &NormaliseScalar, &NormaliseFastScalar, &LengthScalar, &BoundsScalar };
+
+#ifdef CPU_FEATURES_X86
+static const Vector3StreamKernels SSE2_STREAM_KERNELS = { "SSE2", &AddSSE2, &ScaleSSE2, &DotSSE2, &CrossSSE2, &NormaliseSSE2, &NormaliseFastSSE2, &LengthSSE2, &BoundsSSE2 };
+static const Vector3StreamKernels AVX2_STREAM_KERNELS = { "AVX2", &AddAVX2, &ScaleAVX2, &DotAVX2, &CrossAVX2, &NormaliseAVX2, &NormaliseFastAVX2, &LengthAVX2, &BoundsAVX2 };
+#endif
+
+
+const Vector3StreamKernels* GetVector3StreamKernels(Vector3StreamKernelSet _set)
+{
+    switch (_set)
+    {
+    case VECTOR3_STREAM_SCALAR_KERNELS:
+        return &SCALAR_STREAM_KERNELS;
+#ifdef CPU_FEATURES_X86
+    case VECTOR3_STREAM_SSE2_KERNELS:
+        return &SSE2_STREAM_KERNELS;
+    case VECTOR3_STREAM_AVX2_KERNELS:
+        return IsAVX2Supported() ? &AVX2_STREAM_KERNELS : nullptr;
+#endif
+    default:
+        return nullptr;
+    }
+}
+
+
+// @brief The widest kernels this CPU supports. The choice is made once, on the first call.
+static const Vector3StreamKernels& GetBestKernels()
+{
+#ifdef CPU_FEATURES_X86
+    static const Vector3StreamKernels& s_kernels = IsAVX2Supported() ? AVX2_STREAM_KERNELS : SSE2_STREAM_KERNELS;
+#else
+    static const Vector3StreamKernels& s_kernels = SCALAR_STREAM_KERNELS;
+#endif
+    return s_kernels;
+}
+
+static const Vector3StreamKernels& GetKernelsFor(size_t _strideA, size_t _strideB, size_t _strideOut)
+{
+    return (_strideA == 1 && _strideB == 1 && _strideOut == 1) ? GetBestKernels() : SCALAR_STREAM_KERNELS;
+}
+
+
+void AddVector3Streams(ConstVector3StreamView _a, ConstVector3StreamView _b, Vector3StreamView _out)
+{
+    GetKernelsFor(_a.stride, _b.stride, _out.stride).add(_a, _b, _out);
+}
+
+void ScaleVector3Stream(ConstVector3StreamView _a, float _scalar, Vector3StreamView _out)
+{
+    GetKernelsFor(_a.stride, 1, _out.stride).scale(_a, _scalar, _out);
+}
+
+void DotVector3Streams(ConstVector3StreamView _a, ConstVector3StreamView _b, float* _outDots)
+{
+    GetKernelsFor(_a.stride, _b.stride, 1).dot(_a, _b, _outDots);
+}
+
+void CrossVector3Streams(ConstVector3StreamView _a, ConstVector3StreamView _b, Vector3StreamView _out)
+{
+    GetKernelsFor(_a.stride, _b.stride, _out.stride).cross(_a, _b, _out);
+}
+
+void NormaliseVector3Stream(ConstVector3StreamView _a, Vector3StreamView _out)
+{
+    GetKernelsFor(_a.stride, 1, _out.stride).normalise(_a, _out);
+}
+
+void NormaliseVector3StreamFast(ConstVector3StreamView _a, Vector3StreamView _out)
+{
+    GetKernelsFor(_a.stride, 1, _out.stride).normaliseFast(_a, _out);
+}
+
+void GetVector3StreamLengths(ConstVector3StreamView _a, float* _outLengths)
+{
+    GetKernelsFor(_a.stride, 1, 1).length(_a, _outLengths);
+}
+
+bool GetVector3StreamBounds(ConstVector3StreamView _a, Vector3& _outMin, Vector3& _outMax)
+{
+    return GetKernelsFor(_a.stride, 1, 1).bounds(_a, _outMin, _outMax);
+}
@@ -0,0 +1,377 @@
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//             Vector Dot Kernels (cpp)
+//             Author: Christopher A
+//             Date: October 16, 2026
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//  Description:
+//
+//		The scalar, SSE2 and AVX2 + FMA dot product kernels. Every kernel runs
+//      four accumulators of whole registers over the front of the arrays,
+//      then one register at a time, then finishes the last few floats with
+//      scalar code, so any count works.
+//
+//=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include "CpuFeatures.h"
+#include "VectorDotKernels.h"
+
+#ifdef CPU_FEATURES_X86
+#include <immintrin.h>
+#endif
+
+
+
+// ~~~ Scalar kernels ~~~
+static float DotScalar(const float* _a, const float* _b, size_t _count)
+{
+    float sums[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+    size_t i = 0;
+    for (; i + 4 <= _count; i += 4)
+    {
+        sums[0] += _a[i] * _b[i];
+        sums[1] += _a[i + 1] * _b[i + 1];
+        sums[2] += _a[i + 2] * _b[i + 2];
+        sums[3] += _a[i + 3] * _b[i + 3];
+    }
+    float dot = (sums[0] + sums[1]) + (sums[2] + sums[3]);
+    for (; i < _count; ++i)
+    {
+        dot += _a[i] * _b[i];
+    }
+    return dot;
+}
+
+static float DotAccurateScalar(const float* _a, const float* _b, size_t _count)
+{
+    double sums[4] = { 0.0, 0.0, 0.0, 0.0 };
+    size_t i = 0;
+    for (; i + 4 <= _count; i += 4)
+    {
+        sums[0] += (double)_a[i] * _b[i];
+        sums[1] += (double)_a[i + 1] * _b[i + 1];
+        sums[2] += (double)_a[i + 2] * _b[i + 2];
+        sums[3] += (double)_a[i + 3] * _b[i + 3];
+    }
+    double dot = (sums[0] + sums[1]) + (sums[2] + sums[3]);
+    for (; i < _count; ++i)
+    {
+        dot += (double)_a[i] * _b[i];
+    }
+    return (float)dot;
+}
+
+static void DotBatchScalar(const float* _query, const float* _rows, size_t _count, size_t _rowCount, size_t _rowStride, float* _outDots)
+{
+    for (size_t row = 0; row < _rowCount; ++row)
+    {
+        _outDots[row] = DotScalar(_query, _rows + row * _rowStride, _count);
+    }
+}
+
+
+
+#ifdef CPU_FEATURES_X86
+// ~~~ SSE2 kernels ~~~
+// One row's four accumulators. Named rather than an array, so they stay in registers.
+struct DotSumsSSE2
+{
+    __m128 sum0;
+    __m128 sum1;
+    __m128 sum2;
+    __m128 sum3;
+};
+
+static inline void AccumulateSSE2(DotSumsSSE2& _sums, const float* _row, __m128 _query0, __m128 _query1, __m128 _query2, __m128 _query3)
+{
+    _sums.sum0 = _mm_add_ps(_sums.sum0, _mm_mul_ps(_mm_loadu_ps(_row), _query0));
+    _sums.sum1 = _mm_add_ps(_sums.sum1, _mm_mul_ps(_mm_loadu_ps(_row + 4), _query1));
+    _sums.sum2 = _mm_add_ps(_sums.sum2, _mm_mul_ps(_mm_loadu_ps(_row + 8), _query2));
+    _sums.sum3 = _mm_add_ps(_sums.sum3, _mm_mul_ps(_mm_loadu_ps(_row + 12), _query3));
+}
+
+// @brief Sums the accumulators, (x0 + x2) + (x1 + x3) across the lanes, then adds the floats from _start on.
+static inline float FinishDotSSE2(const DotSumsSSE2& _sums, const float* _query, const float* _row, size_t _start, size_t _count)
+{
+    __m128 sum = _mm_add_ps(_mm_add_ps(_sums.sum0, _sums.sum1), _mm_add_ps(_sums.sum2, _sums.sum3));
+    sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+    sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(1, 1, 1, 1)));
+    float dot = _mm_cvtss_f32(sum);
+    for (size_t i = _start; i < _count; ++i)
+    {
+        dot += _query[i] * _row[i];
+    }
+    return dot;
+}
+
+// @brief _outDots[r] = the dot of _query with row r, for one or two rows. The rows share each load of _query.
+template <size_t RowCount>
+static inline void DotRowsSSE2(const float* _query, const float* _rows, size_t _count, size_t _rowStride, float* _outDots)
+{
+    static_assert(RowCount == 1 || RowCount == 2, "DotRowsSSE2 has accumulators for one or two rows");
+    const float* row0 = _rows;
+    const float* row1 = _rows + _rowStride;
+    DotSumsSSE2 sums0 = { _mm_setzero_ps(), _mm_setzero_ps(), _mm_setzero_ps(), _mm_setzero_ps() };
+    DotSumsSSE2 sums1 = sums0;
+
+    size_t i = 0;
+    for (; i + 16 <= _count; i += 16)
+    {
+        __m128 query0 = _mm_loadu_ps(_query + i);
+        __m128 query1 = _mm_loadu_ps(_query + i + 4);
+        __m128 query2 = _mm_loadu_ps(_query + i + 8);
+        __m128 query3 = _mm_loadu_ps(_query + i + 12);
+        AccumulateSSE2(sums0, row0 + i, query0, query1, query2, query3);
+        if constexpr (RowCount == 2)
+        {
+            AccumulateSSE2(sums1, row1 + i, query0, query1, query2, query3);
+        }
+    }
+    for (; i + 4 <= _count; i += 4)
+    {
+        __m128 query = _mm_loadu_ps(_query + i);
+        sums0.sum0 = _mm_add_ps(sums0.sum0, _mm_mul_ps(_mm_loadu_ps(row0 + i), query));
+        if constexpr (RowCount == 2)
+        {
+            sums1.sum0 = _mm_add_ps(sums1.sum0, _mm_mul_ps(_mm_loadu_ps(row1 + i), query));
+        }
+    }
+
+    _outDots[0] = FinishDotSSE2(sums0, _query, row0, i, _count);
+    if constexpr (RowCount == 2)
+    {
+        _outDots[1] = FinishDotSSE2(sums1, _query, row1, i, _count);
+    }
+}
+
+static float DotSSE2(const float* _a, const float* _b, size_t _count)
+{
+    float dot;
+    DotRowsSSE2<1>(_a, _b, _count, 0, &dot);
+    return dot;
+}
+
+static float DotAccurateSSE2(const float* _a, const float* _b, size_t _count)
+{
+    __m128d sum0 = _mm_setzero_pd();
+    __m128d sum1 = _mm_setzero_pd();
+    __m128d sum2 = _mm_setzero_pd();
+    __m128d sum3 = _mm_setzero_pd();
+    size_t i = 0;
+    for (; i + 8 <= _count; i += 8)
+    {
+        __m128 a0 = _mm_loadu_ps(_a + i);
+        __m128 b0 = _mm_loadu_ps(_b + i);
+        __m128 a1 = _mm_loadu_ps(_a + i + 4);
+        __m128 b1 = _mm_loadu_ps(_b + i + 4);
+        sum0 = _mm_add_pd(sum0, _mm_mul_pd(_mm_cvtps_pd(a0), _mm_cvtps_pd(b0)));
+        sum1 = _mm_add_pd(sum1, _mm_mul_pd(_mm_cvtps_pd(_mm_movehl_ps(a0, a0)), _mm_cvtps_pd(_mm_movehl_ps(b0, b0))));
+        sum2 = _mm_add_pd(sum2, _mm_mul_pd(_mm_cvtps_pd(a1), _mm_cvtps_pd(b1)));
+        sum3 = _mm_add_pd(sum3, _mm_mul_pd(_mm_cvtps_pd(_mm_movehl_ps(a1, a1)), _mm_cvtps_pd(_mm_movehl_ps(b1, b1))));
+    }
+    __m128d sum = _mm_add_pd(_mm_add_pd(sum0, sum1), _mm_add_pd(sum2, sum3));
+    double dot = _mm_cvtsd_f64(_mm_add_sd(sum, _mm_unpackhi_pd(sum, sum)));
+    for (; i < _count; ++i)
+    {
+        dot += (double)_a[i] * _b[i];
+    }
+    return (float)dot;
+}
+
+static void DotBatchSSE2(const float* _query, const float* _rows, size_t _count, size_t _rowCount, size_t _rowStride, float* _outDots)
+{
+    size_t row = 0;
+    for (; row + 2 <= _rowCount; row += 2)
+    {
+        DotRowsSSE2<2>(_query, _rows + row * _rowStride, _count, _rowStride, _outDots + row);
+    }
+    if (row < _rowCount)
+    {
+        DotRowsSSE2<1>(_query, _rows + row * _rowStride, _count, _rowStride, _outDots + row);
+    }
+}
+
+
+
+// ~~~ AVX2 + FMA kernels ~~~
+// The SSE2 kernels eight lanes wide, with each multiply and add fused into one rounding
+
+// One row's four accumulators, as for SSE2
+struct DotSumsAVX2
+{
+    __m256 sum0;
+    __m256 sum1;
+    __m256 sum2;
+    __m256 sum3;
+};
+
+CPU_TARGET_AVX2_FMA
+static inline void AccumulateAVX2(DotSumsAVX2& _sums, const float* _row, __m256 _query0, __m256 _query1, __m256 _query2, __m256 _query3)
+{
+    _sums.sum0 = _mm256_fmadd_ps(_mm256_loadu_ps(_row), _query0, _sums.sum0);
+    _sums.sum1 = _mm256_fmadd_ps(_mm256_loadu_ps(_row + 8), _query1, _sums.sum1);
+    _sums.sum2 = _mm256_fmadd_ps(_mm256_loadu_ps(_row + 16), _query2, _sums.sum2);
+    _sums.sum3 = _mm256_fmadd_ps(_mm256_loadu_ps(_row + 24), _query3, _sums.sum3);
+}
+
+CPU_TARGET_AVX2_FMA
+static inline float FinishDotAVX2(const DotSumsAVX2& _sums, const float* _query, const float* _row, size_t _start, size_t _count)
+{
+    __m256 sum256 = _mm256_add_ps(_mm256_add_ps(_sums.sum0, _sums.sum1), _mm256_add_ps(_sums.sum2, _sums.sum3));
+    __m128 sum = _mm_add_ps(_mm256_castps256_ps128(sum256), _mm256_extractf128_ps(sum256, 1));
+    sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+    sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(1, 1, 1, 1)));
+    float dot = _mm_cvtss_f32(sum);
+    for (size_t i = _start; i < _count; ++i)
+    {
+        dot += _query[i] * _row[i];
+    }
+    return dot;
+}
+
+template <size_t RowCount>
+CPU_TARGET_AVX2_FMA
+static inline void DotRowsAVX2(const float* _query, const float* _rows, size_t _count, size_t _rowStride, float* _outDots)
+{
+    static_assert(RowCount == 1 || RowCount == 2, "DotRowsAVX2 has accumulators for one or two rows");
+    const float* row0 = _rows;
+    const float* row1 = _rows + _rowStride;
+    DotSumsAVX2 sums0 = { _mm256_setzero_ps(), _mm256_setzero_ps(), _mm256_setzero_ps(), _mm256_setzero_ps() };
+    DotSumsAVX2 sums1 = sums0;
+
+    size_t i = 0;
+    for (; i + 32 <= _count; i += 32)
+    {
+        __m256 query0 = _mm256_loadu_ps(_query + i);
+        __m256 query1 = _mm256_loadu_ps(_query + i + 8);
+        __m256 query2 = _mm256_loadu_ps(_query + i + 16);
+        __m256 query3 = _mm256_loadu_ps(_query + i + 24);
+        AccumulateAVX2(sums0, row0 + i, query0, query1, query2, query3);
+        if constexpr (RowCount == 2)
+        {
+            AccumulateAVX2(sums1, row1 + i, query0, query1, query2, query3);
+        }
+    }
+    for (; i + 8 <= _count; i += 8)
+    {
+        __m256 query = _mm256_loadu_ps(_query + i);
+        sums0.sum0 = _mm256_fmadd_ps(_mm256_loadu_ps(row0 + i), query, sums0.sum0);
+        if constexpr (RowCount == 2)
+        {
+            sums1.sum0 = _mm256_fmadd_ps(_mm256_loadu_ps(row1 + i), query, sums1.sum0);
+        }
+    }
+
+    _outDots[0] = FinishDotAVX2(sums0, _query, row0, i, _count);
+    if constexpr (RowCount == 2)
+    {
+        _outDots[1] = FinishDotAVX2(sums1, _query, row1, i, _count);
+    }
+}
+
+CPU_TARGET_AVX2_FMA
+static float DotAVX2(const float* _a, const float* _b, size_t _count)
+{
+    float dot;
+    DotRowsAVX2<1>(_a, _b, _count, 0, &dot);
+    return dot;
+}
+
+CPU_TARGET_AVX2_FMA
+static float DotAccurateAVX2(const float* _a, const float* _b, size_t _count)
+{
+    __m256d sum0 = _mm256_setzero_pd();
+    __m256d sum1 = _mm256_setzero_pd();
+    __m256d sum2 = _mm256_setzero_pd();
+    __m256d sum3 = _mm256_setzero_pd();
+    size_t i = 0;
+    for (; i + 16 <= _count; i += 16)
+    {
+        sum0 = _mm256_fmadd_pd(_mm256_cvtps_pd(_mm_loadu_ps(_a + i)), _mm256_cvtps_pd(_mm_loadu_ps(_b + i)), sum0);
+        sum1 = _mm256_fmadd_pd(_mm256_cvtps_pd(_mm_loadu_ps(_a + i + 4)), _mm256_cvtps_pd(_mm_loadu_ps(_b + i + 4)), sum1);
+        sum2 = _mm256_fmadd_pd(_mm256_cvtps_pd(_mm_loadu_ps(_a + i + 8)), _mm256_cvtps_pd(_mm_loadu_ps(_b + i + 8)), sum2);
+        sum3 = _mm256_fmadd_pd(_mm256_cvtps_pd(_mm_loadu_ps(_a + i + 12)), _mm256_cvtps_pd(_mm_loadu_ps(_b + i + 12)), sum3);
+    }
+    __m256d sum256 = _mm256_add_pd(_mm256_add_pd(sum0, sum1), _mm256_add_pd(sum2, sum3));
+    __m128d sum = _mm_add_pd(_mm256_castpd256_pd128(sum256), _mm256_extractf128_pd(sum256, 1));
+    double dot = _mm_cvtsd_f64(_mm_add_sd(sum, _mm_unpackhi_pd(sum, sum)));
+    for (; i < _count; ++i)
+    {
+        dot += (double)_a[i] * _b[i];
+    }
+    return (float)dot;
+}
+
+CPU_TARGET_AVX2_FMA
+static void DotBatchAVX2(const float* _query, const float* _rows, size_t _count, size_t _rowCount, size_t _rowStride, float* _outDots)
+{
+    size_t row = 0;
+    for (; row + 2 <= _rowCount; row += 2)
+    {
+        DotRowsAVX2<2>(_query, _rows + row * _rowStride, _count, _rowStride, _outDots + row);
+    }
+    if (row < _rowCount)
+    {
+        DotRowsAVX2<1>(_query, _rows + row * _rowStride, _count, _rowStride, _outDots + row);
+    }
+}
+#endif
+
+
+
+// ~~~ Dispatch ~~~
+static const VectorDotKernels SCALAR_DOT_KERNELS = { "Scalar", &DotScalar, &DotAccurateScalar, &DotBatchScalar };
+
+#ifdef CPU_FEATURES_X86
+static const VectorDotKernels SSE2_DOT_KERNELS = { "SSE2", &DotSSE2, &DotAccurateSSE2, &DotBatchSSE2 };
+static const VectorDotKernels AVX2_FMA_DOT_KERNELS = { "AVX2 FMA", &DotAVX2, &DotAccurateAVX2, &DotBatchAVX2 };
+
+static bool IsAVX2FMASupported()
+{
+    return IsAVX2Supported() && IsFMASupported();
+}
+#endif
+
+
+const VectorDotKernels* GetVectorDotKernels(VectorDotKernelSet _set)
+{
+    switch (_set)
+    {
+    case DOT_SCALAR_KERNELS:
+        return &SCALAR_DOT_KERNELS;
+#ifdef CPU_FEATURES_X86
+    case DOT_SSE2_KERNELS:
+        return &SSE2_DOT_KERNELS;
+    case DOT_AVX2_FMA_KERNELS:
+        return IsAVX2FMASupported() ? &AVX2_FMA_DOT_KERNELS : nullptr;
+#endif
+    default:
+        return nullptr;
+    }
+}
+
+
+// @brief The widest kernels this CPU supports. The choice is made once, on the first call.
+static const VectorDotKernels& GetBestKernels()
+{
+#ifdef CPU_FEATURES_X86
+    static const VectorDotKernels& s_kernels = IsAVX2FMASupported() ? AVX2_FMA_DOT_KERNELS : SSE2_DOT_KERNELS;
+#else
+    static const VectorDotKernels& s_kernels = SCALAR_DOT_KERNELS;
+#endif
+    return s_kernels;
+}
+
+
+float DotFloats(const float* _a, const float* _b, size_t _count)
+{
+    return GetBestKernels().dot(_a, _b, _count);
+}
+
+float DotFloatsAccurate(const float* _a, const float* _b, size_t _count)
+{
+    return GetBestKernels().dotAccurate(_a, _b, _count);
+}
+
+void DotFloatsBatch(const float* _query, const float* _rows, size_t _count, size_t _rowCount, size_t _rowStride, float* _outDots)
+{
+    GetBestKernels().dotBatch(_query, _rows, _count, _rowCount, _rowStride, _outDots);
+}